@@ -0,0 +1,222 @@
+#include "pch.h"
+
+#include "../JamEngine/AssetPackWriter.h"
+#include "../JamEngine/AssetPathTable.h"
+
+#include <fstream>
+#include <random>
+
+// 사용법
+// AssetPacker <루트 디렉토리> <출력 .jpack> [--codec none|lz4] [--verify]   루트 디렉토리의 모든 파일을 팩으로 묶음
+// AssetPacker --self-test                                                  임시 디렉토리에 파일을 만들어 묶고 다시 읽어 비교 (실패하면 1 반환)
+
+namespace
+{
+
+NODISCARD bool ReadSourceFile(const fs::path& _path, std::vector<UInt8>& _out_bytes)
+{
+    std::ifstream stream(_path, std::ios::in | std::ios::binary);
+    if (!stream.is_open())
+    {
+        return false;
+    }
+
+    _out_bytes.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    return !stream.bad();
+}
+
+NODISCARD bool WriteSourceFile(const fs::path& _path, const std::span<const UInt8> _bytes)
+{
+    std::error_code errorCode;
+    fs::create_directories(_path.parent_path(), errorCode);
+
+    std::ofstream stream(_path, std::ios::out | std::ios::binary | std::ios::trunc);
+    stream.write(reinterpret_cast<const char*>(_bytes.data()), static_cast<std::streamsize>(_bytes.size()));
+    return stream.good();
+}
+
+// 팩을 다시 열어 모든 항목을 원본 파일과 바이트 단위로 비교 (ID, 내용 해시, 이진 탐색 포함)
+NODISCARD bool VerifyPack(const fs::path& _rootDirectory, const fs::path& _packPath)
+{
+    Ref<AssetPack> pPack = MakeRef<AssetPack>();
+    if (!pPack->Open(_packPath))
+    {
+        Log::Error("Verify - Failed to open pack: {}", _packPath.string());
+        return false;
+    }
+
+    size_t          sourceCount = 0;
+    std::error_code errorCode;
+    for (const fs::directory_entry& entry: fs::recursive_directory_iterator(_rootDirectory, errorCode))
+    {
+        sourceCount += entry.is_regular_file() ? 1 : 0;
+    }
+    if (sourceCount != pPack->GetEntries().size())
+    {
+        Log::Error("Verify - Entry count mismatch: {} files, {} entries", sourceCount, pPack->GetEntries().size());
+        return false;
+    }
+
+    bool               bResult = true;
+    std::vector<UInt8> source;
+    for (const AssetPackEntry& entry: pPack->GetEntries())
+    {
+        const std::string_view key        = pPack->GetEntryPath(entry);
+        const fs::path         sourcePath = _rootDirectory / fs::path(ConvertToWideString(key));
+        if (!ReadSourceFile(sourcePath, source))
+        {
+            Log::Error("Verify - Failed to read source file: {}", sourcePath.string());
+            bResult = false;
+            continue;
+        }
+
+        if (entry.id != CreateAssetIDFromKey(fs::relative(sourcePath, _rootDirectory)) || pPack->Find(entry.id) != &entry)
+        {
+            Log::Error("Verify - Id mismatch: {}", key);
+            bResult = false;
+        }
+
+        if (entry.contentHash != CreateAssetContentHash(source))
+        {
+            Log::Error("Verify - Content hash mismatch: {}", key);
+            bResult = false;
+        }
+
+        auto [file, bRead] = AssetPack::ReadEntry(pPack, entry);
+        if (!bRead || !std::ranges::equal(file.GetData(), source))
+        {
+            Log::Error("Verify - Content mismatch: {}", key);
+            bResult = false;
+        }
+    }
+    return bResult;
+}
+
+NODISCARD bool PackDirectory(const fs::path& _rootDirectory, const fs::path& _packPath, const AssetPackWriteDesc& _desc, const bool _bVerify)
+{
+    AssetPackWriter writer(_rootDirectory);
+    const UInt32    fileCount = writer.AddDirectory(_rootDirectory);
+
+    auto [report, bWritten] = writer.Write(_packPath, _desc);
+    if (!bWritten)
+    {
+        return false;
+    }
+
+    Log::Info("{} - {} files, {} entries ({} compressed), {} -> {} bytes", _packPath.string(), fileCount, report.entryCount, report.compressedEntryCount, report.rawByteWidth, report.fileByteWidth);
+    return !_bVerify || VerifyPack(_rootDirectory, _packPath);
+}
+
+// 압축되는 파일, 압축되지 않는 파일, 빈 파일, 같은 내용의 파일, 하위 디렉토리와 한글 경로를 코덱마다 왕복 검사
+NODISCARD bool RunSelfTest()
+{
+    const fs::path rootDirectory = fs::temp_directory_path() / "AssetPackerSelfTest";
+    const fs::path packPath      = fs::temp_directory_path() / "AssetPackerSelfTest.jpack";
+
+    std::error_code errorCode;
+    fs::remove_all(rootDirectory, errorCode);
+
+    std::vector<UInt8> repeated(256 * 1024);
+    for (size_t i = 0; i < repeated.size(); ++i)
+    {
+        repeated[i] = static_cast<UInt8>((i / 7) % 31);
+    }
+
+    std::mt19937       random(0x4A414D);
+    std::vector<UInt8> noise(64 * 1024 + 3);
+    std::ranges::generate(noise, [&random] { return static_cast<UInt8>(random()); });
+
+    const std::string_view text = R"({ "name": "self test", "entities": [] })";
+
+    bool bResult = WriteSourceFile(rootDirectory / "textures" / "repeated.bin", repeated);
+    bResult &= WriteSourceFile(rootDirectory / "models" / "noise.bin", noise);
+    bResult &= WriteSourceFile(rootDirectory / "empty.txt", {});
+    bResult &= WriteSourceFile(rootDirectory / "scenes" / "nested" / "deep" / "scene.json", std::span(reinterpret_cast<const UInt8*>(text.data()), text.size()));
+    bResult &= WriteSourceFile(rootDirectory / "duplicate" / "repeated_copy.bin", repeated);
+    bResult &= WriteSourceFile(rootDirectory / fs::path(u8"\uD14D\uC2A4\uCC98") / fs::path(u8"\uD55C\uAE00.txt"), std::span(reinterpret_cast<const UInt8*>(text.data()), text.size()));   // "텍스처/한글.txt" (소스 인코딩과 무관하게 이스케이프)
+    if (!bResult)
+    {
+        Log::Error("Self test - Failed to create source files: {}", rootDirectory.string());
+        return false;
+    }
+
+    for (const eCompressionCodec codec: { eCompressionCodec::None, eCompressionCodec::LZ4 })
+    {
+        AssetPackWriteDesc desc;
+        desc.codec     = codec;
+        desc.batchSize = 2;   // 여러 배치로 나누어 기록
+        if (!PackDirectory(rootDirectory, packPath, desc, true))
+        {
+            Log::Error("Self test - Failed with codec: {}", EnumToInt(codec));
+            bResult = false;
+        }
+    }
+
+    fs::remove_all(rootDirectory, errorCode);
+    fs::remove(packPath, errorCode);
+    return bResult;
+}
+
+}   // namespace
+
+// 팩커는 Application 을 만들지 않음 (JAM_MAIN 을 쓰지 않으므로 호출되지 않음)
+Application* CreateApplication(MAYBE_UNUSED const CommandLineArguments& _args)
+{
+    return nullptr;
+}
+
+int main(const int argc, char* argv[])
+{
+    Log::Initialize();
+
+    std::vector<std::string_view> positional;
+    AssetPackWriteDesc            desc;
+    bool                          bVerify   = false;
+    bool                          bSelfTest = false;
+    bool                          bUsage    = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg = argv[i];
+        if (arg == "--verify")
+        {
+            bVerify = true;
+        }
+        else if (arg == "--self-test")
+        {
+            bSelfTest = true;
+        }
+        else if (arg == "--codec" && i + 1 < argc)
+        {
+            const std::string_view codec = argv[++i];
+            desc.codec                   = codec == "none" ? eCompressionCodec::None : eCompressionCodec::LZ4;
+            bUsage |= codec != "none" && codec != "lz4";
+        }
+        else if (arg.starts_with("--"))
+        {
+            bUsage = true;
+        }
+        else
+        {
+            positional.push_back(arg);
+        }
+    }
+
+    bool bResult = false;
+    if (bSelfTest && positional.empty() && !bUsage)
+    {
+        bResult = RunSelfTest();
+        Log::Info("Self test {}", bResult ? "passed" : "failed");
+    }
+    else if (!bSelfTest && positional.size() == 2 && !bUsage)
+    {
+        bResult = PackDirectory(fs::path(positional[0]), fs::path(positional[1]), desc, bVerify);
+    }
+    else
+    {
+        Log::Info("Usage: AssetPacker <root directory> <output .jpack> [--codec none|lz4] [--verify]");
+        Log::Info("       AssetPacker --self-test");
+    }
+
+    Log::Shutdown();
+    return bResult ? 0 : 1;
+}
\ No newline at end of file
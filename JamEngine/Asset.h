@@ -1,4 +1,5 @@
 #pragma once
+#include "AssetFile.h"
 
 namespace jam
 {
@@ -11,6 +12,13 @@ enum class eAssetType
     Texture
 };
 
+// 에셋이 로드되기 전에 먼저 로드되어야 하는 에셋 (모델 -> 머티리얼 텍스처)
+struct AssetDependency
+{
+    eAssetType type = eAssetType::Texture;
+    fs::path   path;
+};
+
 class Asset
 {
 public:
@@ -26,11 +34,34 @@ public:
     virtual bool Save(const fs::path& _path) const                       = 0;
     virtual void Unload()                                                = 0;
 
-    NODISCARD const fs::path&    GetPath() const { return m_path; }
+    // 비동기 로드 (AssetManager::LoadAsync) 의 두 단계
+    // PrepareLoad 는 워커 스레드에서 압축 해제, 디코딩을 처리하며 에셋 매니저나 GPU 에 접근하면 안됨
+    // _file 은 매니저가 마운트된 팩 또는 느슨한 파일에서 연 내용이며 _path 는 키 경로 (형식 판별, 로그)
+    // FinalizeLoad 는 메인 스레드에서 GPU 리소스를 생성함. 기본 구현은 모든 작업을 FinalizeLoad 에서 Load 로 처리 (느슨한 파일만)
+    virtual bool PrepareLoad(MAYBE_UNUSED const fs::path& _path, MAYBE_UNUSED const AssetFile& _file) { return true; }
+    virtual bool FinalizeLoad(AssetManager& _assetMgrRef, const fs::path& _path) { return Load(_assetMgrRef, _path); }
+
+    // 파일 헤더만 읽어 의존하는 에셋을 기록 (워커 스레드에서 같은 _file 로 PrepareLoad 보다 먼저 호출됨)
+    // AssetManager 는 의존 에셋을 본체와 함께 병렬로 로드하고 모두 끝난 뒤에 FinalizeLoad 를 호출함
+    virtual void GatherDependencies(MAYBE_UNUSED const fs::path& _path, MAYBE_UNUSED const AssetFile& _file, MAYBE_UNUSED std::vector<AssetDependency>& _out_dependencies) const {}
+
+    NODISCARD const fs::path&    GetPath() const { return m_path; }   // 중복 제거로 공유되는 에셋은 처음 로드한 키 경로
     NODISCARD virtual eAssetType GetType() const = 0;
 
+    // 에셋이 차지하는 CPU + GPU 메모리 (AssetManager 의 상주 예산에 사용)
+    // 다른 에셋 (모델이 참조하는 텍스처 등) 은 포함하지 않음
+    NODISCARD virtual UInt64 GetResidentByteSize() const { return 0; }
+
 protected:
     fs::path m_path = L"";
+
+private:
+    friend class AssetManager;
+
+    UInt64           m_residentByteSize = 0;   // 컨테이너에 추가될 때 AssetManager 가 기록
+    mutable UInt64   m_lastUseStamp     = 0;   // 마지막으로 매니저를 통해 접근한 시점 (LRU)
+    AssetContentHash m_contentHash;            // 중복 제거가 켜진 매니저가 로드했다면 내용 해시
+    UInt32           m_keyCount = 0;           // 이 에셋을 가리키는 컨테이너 키 수 (내용이 같아 공유되면 2 이상)
 };
 
 }   // namespace jam
@@ -0,0 +1,30 @@
+#include "pch.h"
+
+#include "AssetFile.h"
+
+#include "MappedFile.h"
+
+#include <xxhash.h>
+
+namespace jam
+{
+
+Result<AssetFile> AssetFile::OpenLoose(const fs::path& _path)
+{
+    Ref<MappedFile> pMappedFile = MakeRef<MappedFile>();
+    if (!pMappedFile->Open(_path))
+    {
+        return Fail;
+    }
+
+    const std::span<const UInt8> data = pMappedFile->GetData();
+    return AssetFile(data, std::move(pMappedFile));
+}
+
+AssetContentHash CreateAssetContentHash(const std::span<const UInt8> _data)
+{
+    const XXH128_hash_t hash = XXH3_128bits(_data.data(), _data.size());
+    return { hash.low64, hash.high64 };
+}
+
+}   // namespace jam
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+#include "AssetID.h"
+
+namespace jam
+{
+
+// 에셋 로더에 전달되는 파일 내용 (읽기 전용)
+// 마운트된 팩의 항목은 팩의 메모리 맵을 복사 없이 가리키고, 느슨한 파일은 파일 자체를 메모리 맵으로 열며,
+// 압축된 팩 항목은 해제한 버퍼를 가리킴
+// 복사해도 내용을 공유하며 내용을 소유한 객체 (팩, 매핑, 버퍼) 는 마지막 사본이 사라질 때 해제됨
+class AssetFile
+{
+public:
+    AssetFile() = default;
+    AssetFile(const std::span<const UInt8> _data, Ref<const void> _pOwner)
+        : m_data(_data)
+        , m_pOwner(std::move(_pOwner))
+    {
+    }
+
+    NODISCARD static Result<AssetFile> OpenLoose(const fs::path& _path);   // 파일을 메모리 맵으로 열기
+
+    NODISCARD std::span<const UInt8> GetData() const { return m_data; }
+    NODISCARD size_t                 GetByteWidth() const { return m_data.size(); }
+    NODISCARD bool                   IsOpen() const { return m_pOwner != nullptr; }
+
+private:
+    std::span<const UInt8> m_data;
+    Ref<const void>        m_pOwner;   // m_data 가 가리키는 메모리의 소유자
+};
+
+NODISCARD AssetContentHash CreateAssetContentHash(std::span<const UInt8> _data);   // XXH3 128비트
+
+}   // namespace jam
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+
+namespace jam
+{
+
+// 인턴된 에셋 경로의 64비트 ID (AssetPathTable::Intern)
+// 작업 디렉토리 기준 상대 경로를 '/' 구분자, 소문자로 정규화한 문자열의 XXH3 해시이므로 실행마다 같은 값을 가짐
+// 0 은 유효하지 않은 ID
+struct AssetID
+{
+    UInt64 value = 0;
+
+    NODISCARD constexpr bool IsValid() const { return value != 0; }
+    constexpr bool           operator==(const AssetID&) const = default;
+};
+
+// 에셋 파일 내용의 128비트 XXH3 해시 (CreateAssetContentHash, 팩 항목에 미리 기록됨)
+// 경로가 달라도 내용이 같은 에셋을 하나로 공유하는 데 사용 (AssetManager::SetDeduplication)
+// 0 은 계산되지 않은 해시
+struct AssetContentHash
+{
+    UInt64 low  = 0;
+    UInt64 high = 0;
+
+    NODISCARD constexpr bool IsValid() const { return low != 0 || high != 0; }
+    constexpr bool           operator==(const AssetContentHash&) const = default;
+};
+
+}   // namespace jam
\ No newline at end of file
@@ -5,27 +5,37 @@
 #include "Application.h"
 #include "ModelAsset.h"
 #include "TextureAsset.h"
+#include "ThreadPool.h"
+#include <unordered_set>
 
 namespace
 {
 
 using namespace jam;
 
-// 올바른 키는 work directory 로 부터의 상대 경로
-NODISCARD Result<fs::path> CreateKeyFromPath(const fs::path& _path)
+// _dependency 가 dependents 를 따라 (간접적으로) _pRequest 를 기다리고 있다면 순환 의존
+NODISCARD bool IsWaitingOn(const AssetLoadRequest& _dependency, const Ref<AssetLoadRequest>& _pRequest)
 {
-    // 프로젝트 경로를 기준으로 키 생성
-    fs::path          key     = fs::relative(_path, GetApplication().GetWorkingDirectory());
-    std::wstring_view keyWStr = key.native();
-
-    if (keyWStr.starts_with(L"..") == false && keyWStr.empty() == false)   // 정확한 상대경로인지 확인
+    std::vector<const AssetLoadRequest*>        stack = { _pRequest.get() };
+    std::unordered_set<const AssetLoadRequest*> visited;
+    while (!stack.empty())
     {
-        return key;
-    }
-    else
-    {
-        return Fail;
+        const AssetLoadRequest* pRequest = stack.back();
+        stack.pop_back();
+        if (pRequest == &_dependency)
+        {
+            return true;
+        }
+
+        if (visited.insert(pRequest).second)
+        {
+            for (const Ref<AssetLoadRequest>& pDependent: pRequest->dependents)
+            {
+                stack.push_back(pDependent.get());
+            }
+        }
     }
+    return false;
 }
 
 }   // namespace
@@ -33,10 +43,47 @@ NODISCARD Result<fs::path> CreateKeyFromPath(const fs::path& _path)
 namespace jam
 {
 
+AssetManager::AssetManager(AssetManager&& _other) noexcept
+    : m_pathTable(std::move(_other.m_pathTable))
+    , m_pAsyncContext(std::move(_other.m_pAsyncContext))
+    , m_useStamp(_other.m_useStamp)
+    , m_bDeduplication(_other.m_bDeduplication)
+{
+    std::ranges::move(_other.m_containers, m_containers);
+    std::ranges::copy(_other.m_residencies, m_residencies);
+    std::ranges::move(_other.m_contentTables, m_contentTables);
+    if (m_pAsyncContext)
+    {
+        m_pAsyncContext->pOwner = this;   // 진행 중인 로드는 새 매니저에서 마무리
+    }
+}
+
+AssetManager& AssetManager::operator=(AssetManager&& _other) noexcept
+{
+    if (this != &_other)
+    {
+        std::ranges::move(_other.m_containers, m_containers);
+        std::ranges::copy(_other.m_residencies, m_residencies);
+        std::ranges::move(_other.m_contentTables, m_contentTables);
+        m_pathTable      = std::move(_other.m_pathTable);
+        m_pAsyncContext  = std::move(_other.m_pAsyncContext);
+        m_useStamp       = _other.m_useStamp;
+        m_bDeduplication = _other.m_bDeduplication;
+        if (m_pAsyncContext)
+        {
+            m_pAsyncContext->pOwner = this;
+        }
+    }
+    return *this;
+}
+
 void AssetManager::Clear(const eAssetType _type)
 {
     JAM_ASSERT(IsValidEnum(_type), "AssetManager::Reset() - Invalid asset type");
     m_containers[EnumToInt(_type)].clear();
+    m_contentTables[EnumToInt(_type)].clear();
+    m_residencies[EnumToInt(_type)].residentByteSize = 0;
+    CancelPendingLoads_(_type);
 }
 
 void AssetManager::ClearAll()
@@ -45,16 +92,35 @@ void AssetManager::ClearAll()
     {
         container.clear();   // Reset each asset type container
     }
+
+    for (ContentTable& contentTable: m_contentTables)
+    {
+        contentTable.clear();
+    }
+
+    for (Residency& residency: m_residencies)
+    {
+        residency.residentByteSize = 0;
+    }
+
+    for (size_t i = 0; i < EnumCount<eAssetType>(); ++i)
+    {
+        CancelPendingLoads_(static_cast<eAssetType>(i));
+    }
 }
 
 Result<Ref<Asset>> AssetManager::GetOrLoad(const eAssetType _type, const fs::path& _path)
 {
-    Container& container = GetContainer_(_type);
-    auto       it        = container.find(_path);
+    auto [id, bResult] = m_pathTable.Intern(_path);   // 키 생성
+    if (!bResult)                                     // invalid path
+    {
+        JAM_ERROR("AssetManager::GetOrLoad() - Invalid asset path: {}", _path.string());
+        return Fail;
+    }
 
-    if (it != container.end())   // 찾았을 경우 기존 에셋 리턴
+    if (const Ref<Asset> pAsset = Find_(_type, id))   // 찾았을 경우 기존 에셋 리턴
     {
-        return it->second;
+        return pAsset;
     }
     else   // 찾지 못했을 경우 로드
     {
@@ -62,21 +128,59 @@ Result<Ref<Asset>> AssetManager::GetOrLoad(const eAssetType _type, const fs::pat
     }
 }
 
+Result<Ref<Asset>> AssetManager::GetOrLoad(const eAssetType _type, const AssetID _id)
+{
+    if (const Ref<Asset> pAsset = Find_(_type, _id))
+    {
+        return pAsset;
+    }
+
+    // 언로드된 에셋이라면 인턴된 키 경로로 다시 로드
+    const fs::path* pKey = m_pathTable.FindKey(_id);
+    if (!pKey)
+    {
+        JAM_ERROR("AssetManager::GetOrLoad() - Unknown asset id: {:016x}", _id.value);
+        return Fail;
+    }
+    const fs::path key = *pKey;   // 로드 중 다른 경로가 인턴되면 테이블이 재배치될 수 있음
+    return Load(_type, key);
+}
+
 Result<Ref<Asset>> AssetManager::Load(const eAssetType _type, const fs::path& _path)
 {
-    auto [key, bResult] = CreateKeyFromPath(_path);   // 키 생성
+    auto [id, bResult] = m_pathTable.Intern(_path);   // 키 생성
     if (!bResult)                                     // invalid path
     {
         JAM_ERROR("AssetManager::Load() - Invalid asset path: {}", _path.string());
         return Fail;
     }
 
-    Container& container = GetContainer_(_type);          // 타입 컨테이너
-    auto       iterator  = container.find(key);           // 키로 컨테이너에서 찾기
-    bool       bExists   = iterator != container.end();   // 키가 이미 존재하는지 확인
-    Ref<Asset> pAsset    = bExists ? iterator->second : CreateAsset_(_type);
+    // 새 에셋은 비동기 로드와 같은 경로로 요청하고 (팩 우선, 의존 에셋 병렬 로드) 워커를 기다려서 지금 마무리
+    // 진행 중인 비동기 로드가 있다면 그 요청을 마무리함
+    Container& container = GetContainer_(_type);   // 타입 컨테이너
+    const auto iterator  = container.find(id);     // 키로 컨테이너에서 찾기
+    if (iterator == container.end())
+    {
+        const Ref<AssetLoadRequest> pRequest = RequestLoad_(_type, _path);
+        FinalizeLoad_(pRequest, true);
+        if (pRequest->state.load(std::memory_order_acquire) != eAssetLoadState::Loaded)
+        {
+            JAM_ERROR("AssetManager::Load() - Failed to load asset from path: {}", _path.string());
+            return Fail;
+        }
+        return pRequest->pAsset;
+    }
+
+    // 이미 존재하는 에셋은 느슨한 파일에서 덮어쓴다 (에디터의 다시 로드)
+    // 다른 키와 공유 중인 에셋은 새 에셋으로 로드한 뒤 이 키만 교체
+    const fs::path key     = *m_pathTable.FindKey(id);   // 에셋의 Load 가 다른 경로를 인턴할 수 있으므로 복사
+    Ref<Asset>     pAsset  = iterator->second;
+    const bool     bShared = pAsset->m_keyCount > 1;
+    if (bShared)
+    {
+        pAsset = CreateAsset_(_type);
+    }
 
-    // 로드 (만약 이미 존재하는 에셋이라면 덮어쓴다.)
     if (!pAsset->Load(*this, key))
     {
         // 로드 실패
@@ -84,24 +188,70 @@ Result<Ref<Asset>> AssetManager::Load(const eAssetType _type, const fs::path& _p
         return Fail;
     }
 
-    // 로드 완료 이벤트 전송
-    if (bExists)
+    if (bShared)
     {
-        AssetModifiedEvent event(_type, _path);   // 수정 이벤트 전송
-        GetApplication().DispatchEvent(event);
+        RemoveKey_(_type, id);
+        AddKey_(_type, id, pAsset, AssetContentHash());
     }
-    else   // 존재하지 않음 - 새로 생성 이벤트 전송 + 컨테이너에 추가
+    else   // 내용이 바뀌었을 수 있으므로 더 이상 공유하지 않음
     {
-        container[key] = pAsset;              // 새로운 에셋을 컨테이너에 추가
-        AssetLoadEvent event(_type, _path);   // 생성 이벤트 전송
-        GetApplication().DispatchEvent(event);
+        ForgetContentHash_(_type, *pAsset);
     }
+
+    // 수정 이벤트 전송
+    AssetModifiedEvent event(_type, _path);
+    GetApplication().DispatchEvent(event);
+
+    // 상주 메모리 갱신 (pAsset 을 참조하고 있으므로 방금 로드한 에셋은 언로드되지 않음)
+    UpdateResidency_(_type, *pAsset);
+    EvictOverBudget_(_type);
     return pAsset;   // Return the loaded or existing asset
 }
 
+AssetHandle<Asset> AssetManager::LoadAsync(const eAssetType _type, const fs::path& _path)
+{
+    return AssetHandle<Asset>(RequestLoad_(_type, _path));
+}
+
+size_t AssetManager::GetPendingLoadCount() const
+{
+    if (!m_pAsyncContext)
+    {
+        return 0;
+    }
+
+    size_t pendingCount = 0;
+    for (const PendingLoads& pendingLoads: m_pAsyncContext->pendingLoads)
+    {
+        pendingCount += pendingLoads.size();
+    }
+    return pendingCount;
+}
+
+void AssetManager::FinishPendingLoads()
+{
+    // 마무리 중에 의존 에셋이 요청될 수 있으므로 대기 목록이 빌 때까지 반복
+    while (GetPendingLoadCount() > 0)
+    {
+        std::vector<Ref<AssetLoadRequest>> pendingRequests;
+        for (const PendingLoads& pendingLoads: m_pAsyncContext->pendingLoads)
+        {
+            for (const Ref<AssetLoadRequest>& pRequest: pendingLoads | std::views::values)
+            {
+                pendingRequests.push_back(pRequest);
+            }
+        }
+
+        for (const Ref<AssetLoadRequest>& pRequest: pendingRequests)
+        {
+            FinalizeLoad_(pRequest, true);
+        }
+    }
+}
+
 bool AssetManager::Unload(const eAssetType _type, const fs::path& _path)
 {
-    auto [key, bResult] = CreateKeyFromPath(_path);   // 키 생성
+    auto [id, bResult] = m_pathTable.Intern(_path);   // 키 생성
     if (bResult == false)                             // invalid path
     {
         JAM_ERROR("AssetManager::Reset() - Invalid asset path: {}", _path.string());
@@ -109,7 +259,7 @@ bool AssetManager::Unload(const eAssetType _type, const fs::path& _path)
     }
 
     Container& container = GetContainer_(_type);          // 타입 컨테이너
-    auto       iterator  = container.find(key);           // 에셋 탐색
+    auto       iterator  = container.find(id);            // 에셋 탐색
     bool       bExists   = iterator != container.end();   // 키가 존재하는지 확인
 
     if (bExists == false)   // 발견하지 못함
@@ -118,12 +268,8 @@ bool AssetManager::Unload(const eAssetType _type, const fs::path& _path)
         return false;
     }
 
-    // 언로드
-    const Ref<Asset>& pAsset = iterator->second;
-    pAsset->Unload();
-
-    // 컨테이너에서 제거
-    container.erase(iterator);
+    // 컨테이너에서 제거 후 다른 키가 공유하고 있지 않다면 언로드
+    RemoveKey_(_type, id);
 
     // 제거 이벤트 전송
     AssetUnloadEvent event(_type, _path);
@@ -133,20 +279,25 @@ bool AssetManager::Unload(const eAssetType _type, const fs::path& _path)
 
 bool AssetManager::Contain(const eAssetType _type, const fs::path& _path) const
 {
-    auto [key, bResult] = CreateKeyFromPath(_path);   // 키 생성
+    auto [id, bResult] = m_pathTable.Intern(_path);   // 키 생성
     if (bResult == false)
     {
         return false;
     }
 
     // 키가 존재하는지 탐색
+    return Contain(_type, id);
+}
+
+bool AssetManager::Contain(const eAssetType _type, const AssetID _id) const
+{
     const Container& container = GetContainer_(_type);
-    return container.contains(key);
+    return container.contains(_id);
 }
 
 Result<Ref<Asset>> AssetManager::Get(const eAssetType _type, const fs::path& _path) const
 {
-    auto [key, bResult] = CreateKeyFromPath(_path);   // 키 생성
+    auto [id, bResult] = m_pathTable.Intern(_path);   // 키 생성
     if (bResult == false)                             // invalid path
     {
         JAM_ERROR("AssetManager::Get() - Invalid asset path: {}", _path.string());
@@ -154,11 +305,9 @@ Result<Ref<Asset>> AssetManager::Get(const eAssetType _type, const fs::path& _pa
     }
 
     // 키가 올바른 경우
-    const Container& container = GetContainer_(_type);   // 타입 컨테이너
-    auto             iterator  = container.find(key);
-    if (iterator != container.end())   // 찾았을 경우
+    if (const Ref<Asset> pAsset = Find_(_type, id))   // 찾았을 경우
     {
-        return iterator->second;   // 에셋 리턴
+        return pAsset;   // 에셋 리턴
     }
     else   // 찾지 못했을 경우
     {
@@ -167,6 +316,72 @@ Result<Ref<Asset>> AssetManager::Get(const eAssetType _type, const fs::path& _pa
     }
 }
 
+Result<Ref<Asset>> AssetManager::Get(const eAssetType _type, const AssetID _id) const
+{
+    if (const Ref<Asset> pAsset = Find_(_type, _id))
+    {
+        return pAsset;
+    }
+    else
+    {
+        JAM_ERROR("AssetManager::Get() - Asset not found for id: {:016x}", _id.value);
+        return Fail;
+    }
+}
+
+Result<fs::path> AssetManager::GetAssetPath(const AssetID _id) const
+{
+    if (const fs::path* pKey = m_pathTable.FindKey(_id))
+    {
+        return *pKey;
+    }
+    return Fail;
+}
+
+void AssetManager::SetResidencyBudget(const eAssetType _type, const UInt64 _byteBudget)
+{
+    JAM_ASSERT(IsValidEnum(_type), "AssetManager::SetResidencyBudget() - Invalid asset type");
+    m_residencies[EnumToInt(_type)].byteBudget = _byteBudget;
+    EvictOverBudget_(_type);
+}
+
+bool AssetManager::MountPack(const fs::path& _packPath)
+{
+    Ref<AssetPack> pPack = MakeRef<AssetPack>();
+    if (!pPack->Open(_packPath))
+    {
+        JAM_ERROR("AssetManager::MountPack() - Failed to mount pack: {}", _packPath.string());
+        return false;
+    }
+
+    Log::Info("Asset pack mounted: {} ({} entries)", _packPath.string(), pPack->GetEntries().size());
+    s_mountedPacks.push_back(std::move(pPack));
+    return true;
+}
+
+bool AssetManager::UnmountPack(const fs::path& _packPath)
+{
+    const auto iterator = std::ranges::find(s_mountedPacks, _packPath, &AssetPack::GetPath);
+    if (iterator == s_mountedPacks.end())
+    {
+        JAM_ERROR("AssetManager::UnmountPack() - Pack is not mounted: {}", _packPath.string());
+        return false;
+    }
+
+    s_mountedPacks.erase(iterator);
+    return true;
+}
+
+UInt64 AssetManager::EnforceResidencyBudgets()
+{
+    UInt64 evictedByteSize = 0;
+    for (size_t i = 0; i < EnumCount<eAssetType>(); ++i)
+    {
+        evictedByteSize += EvictOverBudget_(static_cast<eAssetType>(i));
+    }
+    return evictedByteSize;
+}
+
 Ref<Asset> AssetManager::CreateAsset_(const eAssetType _type) const
 {
     switch (_type)
@@ -177,6 +392,446 @@ Ref<Asset> AssetManager::CreateAsset_(const eAssetType _type) const
     JAM_CRASH("Unsupported asset type: {}", EnumToInt(_type));
 }
 
+Ref<Asset> AssetManager::Find_(const eAssetType _type, const AssetID _id) const
+{
+    const Container& container = GetContainer_(_type);
+    const auto       iterator  = container.find(_id);
+    if (iterator == container.end())
+    {
+        return nullptr;
+    }
+
+    Touch_(*iterator->second);
+    return iterator->second;
+}
+
+Ref<AssetLoadRequest> AssetManager::RequestLoad_(const eAssetType _type, const fs::path& _path)
+{
+    Ref<AssetLoadRequest> pRequest = MakeRef<AssetLoadRequest>();
+    pRequest->type                 = _type;
+    pRequest->path                 = _path;
+
+    auto [id, bResult] = m_pathTable.Intern(_path);   // 키 생성
+    if (!bResult)                                     // invalid path
+    {
+        JAM_ERROR("AssetManager::LoadAsync() - Invalid asset path: {}", _path.string());
+        pRequest->state = eAssetLoadState::Failed;
+        return pRequest;
+    }
+
+    // 이미 로드된 에셋
+    if (Ref<Asset> pAsset = Find_(_type, id))
+    {
+        pRequest->pAsset = std::move(pAsset);
+        pRequest->state  = eAssetLoadState::Loaded;
+        return pRequest;
+    }
+
+    // 같은 키의 요청이 진행 중이라면 공유
+    if (Ref<AssetLoadRequest> pPendingRequest = FindPendingLoad_(_type, id))
+    {
+        return pPendingRequest;
+    }
+    pRequest->id  = id;
+    pRequest->key = *m_pathTable.FindKey(id);
+
+    if (!m_pAsyncContext)
+    {
+        m_pAsyncContext         = MakeRef<AsyncLoadContext>();
+        m_pAsyncContext->pOwner = this;
+    }
+    pRequest->pAsset       = CreateAsset_(_type);
+    pRequest->bDeduplicate = m_bDeduplication;
+    m_pAsyncContext->pendingLoads[EnumToInt(_type)][id] = pRequest;
+
+    // 파일 읽기 (FileIOService, 팩 항목) -> 워커 스레드: 의존 에셋 수집 -> 메인 스레드에 의존 에셋 요청 제출 -> PrepareLoad -> 메인 스레드에 마무리 제출
+    // 읽기는 큐 깊이만큼 동시에 진행되며 워커 스레드는 읽기가 끝난 파일만 처리함
+    // 작업은 요청이 끝날 때까지 대기 목록 밖에서 보관되므로 요청은 약하게 참조함 (취소된 요청은 버림)
+    const std::weak_ptr<AssetLoadRequest> pWeakRequest = pRequest;
+    const std::weak_ptr<AsyncLoadContext> pWeakContext = m_pAsyncContext;
+    const Ref<std::promise<bool>>         pPrepared    = MakeRef<std::promise<bool>>();
+    pRequest->prepareResult                            = pPrepared->get_future().share();
+
+    auto prepareJob = [pWeakRequest, pWeakContext, pPrepared](const Result<AssetFile>& _file)
+    {
+        const Ref<AssetLoadRequest> pLoadRequest = pWeakRequest.lock();
+        if (!pLoadRequest)   // 취소된 뒤 핸들도 모두 사라짐
+        {
+            pPrepared->set_value(false);
+            return;
+        }
+
+        // 헤더만 읽으므로 본체를 로드하는 동안 의존 에셋도 다른 워커에서 로드됨
+        auto [file, bRead] = _file;
+        if (bRead)
+        {
+            pLoadRequest->pAsset->GatherDependencies(pLoadRequest->key, file, pLoadRequest->dependencies);
+        }
+
+        // 내용 해시 (팩 항목에 기록되어 있지 않은 경우). prepareResult 가 준비되기 전에 기록되므로 마무리 단계에서 읽을 수 있음
+        if (bRead && pLoadRequest->bDeduplicate && !pLoadRequest->contentHash.IsValid())
+        {
+            pLoadRequest->contentHash = CreateAssetContentHash(file.GetData());
+        }
+        if (!pLoadRequest->dependencies.empty())
+        {
+            GetApplication().SubmitCommand(
+                [pLoadRequest, pWeakContext]
+                {
+                    if (const Ref<AsyncLoadContext> pContext = pWeakContext.lock())
+                    {
+                        pContext->pOwner->RequestDependencies_(pLoadRequest);
+                    }
+                });
+        }
+
+        pPrepared->set_value(bRead && pLoadRequest->pAsset->PrepareLoad(pLoadRequest->key, file));
+        GetApplication().SubmitCommand(
+            [pLoadRequest, pWeakContext]
+            {
+                if (const Ref<AsyncLoadContext> pContext = pWeakContext.lock())
+                {
+                    pContext->pOwner->FinalizeLoad_(pLoadRequest, false);
+                }
+                else   // 매니저가 먼저 파괴됨
+                {
+                    pLoadRequest->state = eAssetLoadState::Failed;
+                }
+            });
+    };
+
+    // 콜백은 완료 스레드에서 호출되므로 준비 작업은 워커 스레드로 넘김
+    auto readCallback = [prepareJob](Result<AssetFile> _file)
+    {
+        ThreadPool::GetGlobal().Submit(
+            [prepareJob, file = std::move(_file)]
+            {
+                prepareJob(file);
+            });
+    };
+    ReadAssetFile_(s_mountedPacks, *pRequest, std::move(readCallback));
+    return pRequest;
+}
+
+Ref<AssetLoadRequest> AssetManager::FindPendingLoad_(const eAssetType _type, const AssetID _id) const
+{
+    if (!m_pAsyncContext)
+    {
+        return nullptr;
+    }
+
+    const PendingLoads& pendingLoads = m_pAsyncContext->pendingLoads[EnumToInt(_type)];
+    const auto          iterator     = pendingLoads.find(_id);
+    return iterator != pendingLoads.end() ? iterator->second : nullptr;
+}
+
+void AssetManager::RequestDependencies_(const Ref<AssetLoadRequest>& _pRequest)
+{
+    // dependencies 는 워커가 이 함수를 부르는 커맨드를 제출하기 전 (혹은 prepareResult 가 준비되기 전) 에 기록됨
+    if (_pRequest->bDependenciesRequested || _pRequest->state.load(std::memory_order_acquire) != eAssetLoadState::Pending)
+    {
+        return;
+    }
+    _pRequest->bDependenciesRequested = true;
+
+    _pRequest->dependencyRequests.reserve(_pRequest->dependencies.size());
+    for (const AssetDependency& dependency: _pRequest->dependencies)
+    {
+        _pRequest->dependencyRequests.push_back(RequestLoad_(dependency.type, dependency.path));
+    }
+}
+
+void AssetManager::FinalizeLoad_(const Ref<AssetLoadRequest>& _pRequest, const bool _bWait)
+{
+    // 이미 끝났거나 (동기 로드, 취소) 위쪽 호출에서 마무리 중이거나 의존 요청을 기다리는 중
+    if (_pRequest->state.load(std::memory_order_acquire) != eAssetLoadState::Pending || _pRequest->bFinalizing || (!_bWait && _pRequest->pendingDependencyCount > 0))
+    {
+        return;
+    }
+
+    // 커맨드로 호출되었다면 이미 끝났으며, 동기 로드에서 호출되었다면 워커를 기다림
+    const bool bPrepared = _pRequest->prepareResult.get();
+    RequestDependencies_(_pRequest);
+
+    // 의존 요청이 먼저 끝나야 함 (위상 순서)
+    // 기다린다면 직접 마무리하고, 아니라면 의존 요청에 등록해 두었다가 마지막 의존 요청이 끝날 때 다시 호출됨
+    _pRequest->bFinalizing = true;
+    for (const Ref<AssetLoadRequest>& pDependency: _pRequest->dependencyRequests)
+    {
+        if (pDependency->state.load(std::memory_order_acquire) != eAssetLoadState::Pending)
+        {
+            continue;
+        }
+
+        if (_bWait)
+        {
+            FinalizeLoad_(pDependency, true);
+        }
+        else if (IsWaitingOn(*pDependency, _pRequest))
+        {
+            // 등록하면 서로의 완료를 영원히 기다리므로 이 간선은 끊고 먼저 마무리 (기다리는 경로의 bFinalizing 과 같은 결과)
+            Log::Warn("AssetManager::LoadAsync() - Circular dependency ignored: {} -> {}", _pRequest->path.string(), pDependency->path.string());
+        }
+        else
+        {
+            pDependency->dependents.push_back(_pRequest);
+            ++_pRequest->pendingDependencyCount;
+        }
+    }
+    _pRequest->bFinalizing = false;
+    if (!_bWait && _pRequest->pendingDependencyCount > 0)
+    {
+        return;
+    }
+
+    m_pAsyncContext->pendingLoads[EnumToInt(_pRequest->type)].erase(_pRequest->id);
+
+    // 내용이 같은 에셋이 이미 있다면 디코딩한 결과를 버리고 공유 (GPU 리소스를 다시 만들지 않음)
+    Ref<Asset> pSharedAsset = bPrepared ? FindSharedAsset_(_pRequest->type, _pRequest->contentHash) : nullptr;
+    if (!pSharedAsset && (!bPrepared || !_pRequest->pAsset->FinalizeLoad(*this, _pRequest->key)))
+    {
+        JAM_ERROR("AssetManager::LoadAsync() - Failed to load asset from path: {}", _pRequest->path.string());
+        _pRequest->state.store(eAssetLoadState::Failed, std::memory_order_release);
+    }
+    else
+    {
+        if (pSharedAsset)
+        {
+            _pRequest->pAsset = std::move(pSharedAsset);
+        }
+        AddKey_(_pRequest->type, _pRequest->id, _pRequest->pAsset, _pRequest->contentHash);
+        _pRequest->state.store(eAssetLoadState::Loaded, std::memory_order_release);
+
+        AssetLoadEvent event(_pRequest->type, _pRequest->path);   // 생성 이벤트 전송
+        GetApplication().DispatchEvent(event);
+
+        UpdateResidency_(_pRequest->type, *_pRequest->pAsset);   // 공유 에셋은 크기가 그대로이므로 접근 시점만 갱신됨
+        EvictOverBudget_(_pRequest->type);
+    }
+
+    _pRequest->dependencyRequests.clear();   // 의존 에셋은 이제 에셋 자신이 참조함
+    NotifyDependents_(_pRequest);
+}
+
+void AssetManager::NotifyDependents_(const Ref<AssetLoadRequest>& _pRequest)
+{
+    // 실패한 의존 요청도 완료로 취급 (텍스처가 없는 모델은 그대로 로드됨)
+    const std::vector<Ref<AssetLoadRequest>> dependents = std::exchange(_pRequest->dependents, {});
+    for (const Ref<AssetLoadRequest>& pDependent: dependents)
+    {
+        if (--pDependent->pendingDependencyCount == 0)
+        {
+            FinalizeLoad_(pDependent, false);
+        }
+    }
+}
+
+void AssetManager::CancelPendingLoads_(const eAssetType _type)
+{
+    if (!m_pAsyncContext)
+    {
+        return;
+    }
+
+    // 워커는 계속 실행되지만 마무리 단계에서 결과를 버림
+    // 다른 타입의 요청이 기다리고 있을 수 있으므로 대기 목록을 비운 뒤에 알림
+    PendingLoads&                      pendingLoads = m_pAsyncContext->pendingLoads[EnumToInt(_type)];
+    std::vector<Ref<AssetLoadRequest>> cancelledRequests;
+    for (const Ref<AssetLoadRequest>& pRequest: pendingLoads | std::views::values)
+    {
+        pRequest->state.store(eAssetLoadState::Failed, std::memory_order_release);
+        cancelledRequests.push_back(pRequest);
+    }
+    pendingLoads.clear();
+
+    for (const Ref<AssetLoadRequest>& pRequest: cancelledRequests)
+    {
+        pRequest->dependencyRequests.clear();
+        NotifyDependents_(pRequest);
+    }
+}
+
+void AssetManager::ReadAssetFile_(const std::span<const Ref<const AssetPack>> _packs, AssetLoadRequest& _request, FileIOService::ReadCallback _callback)
+{
+    // 나중에 마운트한 팩 (패치) 이 우선
+    for (const Ref<const AssetPack>& pPack: _packs | std::views::reverse)
+    {
+        if (const AssetPackEntry* pEntry = pPack->Find(_request.id))
+        {
+            // 쿠킹할 때 기록된 해시를 사용 (콜백이 바로 호출될 수 있으므로 읽기 전에 기록)
+            if (_request.bDeduplicate)
+            {
+                _request.contentHash = pEntry->contentHash;
+            }
+            AssetPack::ReadEntryAsync(pPack, *pEntry, std::move(_callback));
+            return;
+        }
+    }
+
+    // 큰 느슨한 파일 (.jmodel 등) 은 메모리 맵으로 열어 복사 없이 로더에 전달 (페이지는 워커가 디코딩할 때 읽힘)
+    // 작은 파일은 FileIOService 로 큐 깊이만큼 동시에 읽음. 크기를 알 수 없다면 FileIOService 가 오류를 보고함
+    std::error_code errorCode;
+    const UInt64    byteWidth = fs::file_size(_request.key, errorCode);
+    if (!errorCode && byteWidth >= k_mappedLooseFileByteWidth)
+    {
+        _callback(AssetFile::OpenLoose(_request.key));
+        return;
+    }
+    FileIOService::GetGlobal().Read(_request.key, std::move(_callback));
+}
+
+Ref<Asset> AssetManager::FindSharedAsset_(const eAssetType _type, const AssetContentHash& _contentHash) const
+{
+    if (!_contentHash.IsValid())
+    {
+        return nullptr;
+    }
+
+    const ContentTable& contentTable = m_contentTables[EnumToInt(_type)];
+    const auto          iterator     = contentTable.find(_contentHash);
+    return iterator != contentTable.end() ? iterator->second.lock() : nullptr;
+}
+
+void AssetManager::AddKey_(const eAssetType _type, const AssetID _id, const Ref<Asset>& _pAsset, const AssetContentHash& _contentHash)
+{
+    GetContainer_(_type)[_id] = _pAsset;
+    ++_pAsset->m_keyCount;
+    if (_contentHash.IsValid())
+    {
+        _pAsset->m_contentHash                          = _contentHash;
+        m_contentTables[EnumToInt(_type)][_contentHash] = _pAsset;
+    }
+}
+
+bool AssetManager::RemoveKey_(const eAssetType _type, const AssetID _id)
+{
+    Container& container = GetContainer_(_type);
+    const auto iterator  = container.find(_id);
+    JAM_ASSERT(iterator != container.end(), "AssetManager::RemoveKey_() - Asset not found");
+
+    const Ref<Asset> pAsset = std::move(iterator->second);
+    container.erase(_id);
+    if (pAsset->m_keyCount > 1)   // 다른 키가 공유 중
+    {
+        --pAsset->m_keyCount;
+        return false;
+    }
+
+    pAsset->m_keyCount = 0;
+    ForgetContentHash_(_type, *pAsset);
+    ReleaseResidency_(_type, *pAsset);
+    pAsset->Unload();
+    return true;
+}
+
+void AssetManager::ForgetContentHash_(const eAssetType _type, Asset& _asset)
+{
+    if (!_asset.m_contentHash.IsValid())
+    {
+        return;
+    }
+
+    ContentTable& contentTable = m_contentTables[EnumToInt(_type)];
+    const auto    iterator     = contentTable.find(_asset.m_contentHash);
+    if (iterator != contentTable.end() && iterator->second.lock().get() == &_asset)
+    {
+        contentTable.erase(iterator);
+    }
+    _asset.m_contentHash = AssetContentHash();
+}
+
+AssetDeduplicationStats AssetManager::GetDeduplicationStats(const eAssetType _type) const
+{
+    JAM_ASSERT(IsValidEnum(_type), "AssetManager::GetDeduplicationStats() - Invalid asset type");
+
+    AssetDeduplicationStats stats;
+    for (const std::weak_ptr<Asset>& pWeakAsset: m_contentTables[EnumToInt(_type)] | std::views::values)
+    {
+        const Ref<Asset> pAsset = pWeakAsset.lock();
+        if (pAsset && pAsset->m_keyCount > 1)
+        {
+            ++stats.sharedAssetCount;
+            stats.sharedKeyCount += pAsset->m_keyCount - 1;
+            stats.savedByteSize += static_cast<UInt64>(pAsset->m_keyCount - 1) * pAsset->m_residentByteSize;
+        }
+    }
+    return stats;
+}
+
+void AssetManager::Touch_(const Asset& _asset) const
+{
+    _asset.m_lastUseStamp = ++m_useStamp;
+}
+
+void AssetManager::UpdateResidency_(const eAssetType _type, Asset& _asset)
+{
+    Residency& residency = m_residencies[EnumToInt(_type)];
+    residency.residentByteSize -= _asset.m_residentByteSize;
+    _asset.m_residentByteSize = _asset.GetResidentByteSize();
+    residency.residentByteSize += _asset.m_residentByteSize;
+    Touch_(_asset);
+}
+
+void AssetManager::ReleaseResidency_(const eAssetType _type, Asset& _asset)
+{
+    m_residencies[EnumToInt(_type)].residentByteSize -= _asset.m_residentByteSize;
+    _asset.m_residentByteSize = 0;
+}
+
+UInt64 AssetManager::EvictOverBudget_(const eAssetType _type)
+{
+    Residency& residency = m_residencies[EnumToInt(_type)];
+    if (residency.byteBudget == 0 || residency.residentByteSize <= residency.byteBudget)
+    {
+        return 0;
+    }
+
+    // 매니저만 참조하는 에셋이 후보 (컴포넌트, 머티리얼, 로드 핸들이 참조 중인 에셋은 사용 중)
+    auto isEvictable = [](const Ref<Asset>& _pAsset) {
+        return _pAsset.use_count() == static_cast<long>(std::max(_pAsset->m_keyCount, 1u));   // 공유 에셋은 키마다 하나씩 참조됨
+    };
+
+    Container&                              container = GetContainer_(_type);
+    std::vector<std::pair<UInt64, AssetID>> candidates;   // (마지막 접근 시점, ID)
+    for (const auto& [id, pAsset]: container)
+    {
+        if (isEvictable(pAsset))
+        {
+            candidates.emplace_back(pAsset->m_lastUseStamp, id);
+        }
+    }
+    std::ranges::sort(candidates);
+
+    UInt64 evictedByteSize = 0;
+    for (const AssetID id: candidates | std::views::values)
+    {
+        if (residency.residentByteSize <= residency.byteBudget)
+        {
+            break;
+        }
+
+        // 제거 이벤트 핸들러가 에셋을 지우거나 다시 참조했을 수 있음
+        const auto iterator = container.find(id);
+        if (iterator == container.end() || !isEvictable(iterator->second))
+        {
+            continue;
+        }
+
+        // 공유 에셋의 키들은 접근 시점이 같으므로 연속으로 제거되며 마지막 키에서 해제됨
+        const UInt64 residentByteSize = iterator->second->m_residentByteSize;
+        if (RemoveKey_(_type, id))
+        {
+            evictedByteSize += residentByteSize;
+        }
+
+        AssetUnloadEvent event(_type, *m_pathTable.FindKey(id));   // 제거 이벤트 전송
+        GetApplication().DispatchEvent(event);
+    }
+
+    // 사용 중인 에셋만으로 예산을 넘는 경우는 그대로 둠
+    return evictedByteSize;
+}
+
 AssetManager::Container& AssetManager::GetContainer_(const eAssetType _type)
 {
     return m_containers[EnumToInt(_type)];
@@ -1,22 +1,92 @@
 #pragma once
 #include "Asset.h"
+#include "AssetPack.h"
+#include "AssetPathTable.h"
 #include "EnumUtilities.h"
 
+#include <atomic>
+#include <future>
+#include <unordered_map>
+
 namespace jam
 {
 
+enum class eAssetLoadState : UInt8
+{
+    Pending = 0,   // 워커 스레드에서 로드 중이거나 메인 스레드의 마무리를 기다리는 중
+    Loaded,
+    Failed,        // 로드 실패 혹은 Clear 로 취소됨
+};
+
+// AssetManager::LoadAsync 로 요청한 로드 하나. 같은 키에 대한 요청은 이 객체를 공유함
+// 요청들은 의존 그래프를 이루며 (모델 -> 텍스처) 의존하는 요청이 모두 끝난 뒤에 마무리됨
+struct AssetLoadRequest
+{
+    eAssetType                   type  = eAssetType::Model;
+    fs::path                     path;                               // 요청한 경로 (이벤트에 전달)
+    fs::path                     key;                                // 정규화된 키 경로 (로드에 사용)
+    AssetID                      id;                                 // 컨테이너 키
+    Ref<Asset>                   pAsset;                             // 요청 시점에 생성되며 로드가 끝나면 컨테이너에 추가됨
+    std::shared_future<bool>     prepareResult;                      // 워커 스레드의 Asset::PrepareLoad 결과 (파일 읽기가 끝난 뒤)
+    std::atomic<eAssetLoadState> state = eAssetLoadState::Pending;   // 메인 스레드에서만 바뀜
+
+    bool             bDeduplicate = false;   // 요청 시점의 AssetManager::IsDeduplicationEnabled()
+    AssetContentHash contentHash;            // 팩 항목의 해시 혹은 워커 스레드가 PrepareLoad 전에 계산한 해시
+
+    std::vector<AssetDependency> dependencies;   // 워커 스레드가 Asset::GatherDependencies 로 기록
+
+    // 의존 그래프 (메인 스레드 전용)
+    std::vector<Ref<AssetLoadRequest>> dependencyRequests;            // 끝나면 비워짐
+    std::vector<Ref<AssetLoadRequest>> dependents;                    // 이 요청이 끝나기를 기다리는 요청
+    UInt32                             pendingDependencyCount = 0;
+    bool                               bDependenciesRequested = false;
+    bool                               bFinalizing            = false;   // 순환 의존 방지
+};
+
+// 비동기 로드 핸들
+// 에셋 객체는 요청 직후부터 참조할 수 있지만 GPU 리소스는 IsLoaded() 가 true 가 된 이후에 유효함
+// 중복 제거로 다른 키의 에셋을 공유하게 되면 마무리될 때 요청의 에셋이 교체되므로 로드가 끝난 뒤 GetAsset() 을 다시 호출해야 함
+template<typename T>
+class AssetHandle
+{
+public:
+    AssetHandle() = default;
+    explicit AssetHandle(Ref<const AssetLoadRequest> _pRequest)
+        : m_pRequest(std::move(_pRequest))
+    {
+    }
+
+    NODISCARD eAssetLoadState GetState() const { return m_pRequest ? m_pRequest->state.load(std::memory_order_acquire) : eAssetLoadState::Failed; }
+    NODISCARD bool            IsLoaded() const { return GetState() == eAssetLoadState::Loaded; }
+    NODISCARD bool            IsFailed() const { return GetState() == eAssetLoadState::Failed; }
+    NODISCARD bool            IsDone() const { return GetState() != eAssetLoadState::Pending; }
+
+    NODISCARD Ref<T>                             GetAsset() const { return m_pRequest ? std::static_pointer_cast<T>(m_pRequest->pAsset) : nullptr; }
+    NODISCARD const Ref<const AssetLoadRequest>& GetRequest() const { return m_pRequest; }
+
+private:
+    Ref<const AssetLoadRequest> m_pRequest;
+};
+
+struct AssetDeduplicationStats
+{
+    UInt32 sharedAssetCount = 0;   // 둘 이상의 키가 공유하는 에셋 수
+    UInt32 sharedKeyCount   = 0;   // 공유 에셋을 가리키는 키 중 처음 로드한 키를 제외한 수 (로드, 업로드를 생략한 키)
+    UInt64 savedByteSize    = 0;   // 공유하지 않았다면 더 필요했을 상주 메모리 (Asset::GetResidentByteSize)
+};
+
 class AssetManager
 {
 public:
-    using Container = std::unordered_map<fs::path, Ref<Asset>>;
+    using Container = FlatIDMap<Ref<Asset>>;
 
     AssetManager()  = default;
     ~AssetManager() = default;
 
-    AssetManager(const AssetManager&)                = delete;
-    AssetManager& operator=(const AssetManager&)     = delete;
-    AssetManager(AssetManager&&) noexcept            = default;
-    AssetManager& operator=(AssetManager&&) noexcept = default;
+    AssetManager(const AssetManager&)            = delete;
+    AssetManager& operator=(const AssetManager&) = delete;
+    AssetManager(AssetManager&& _other) noexcept;
+    AssetManager& operator=(AssetManager&& _other) noexcept;
 
     template<typename T>
     Result<Ref<T>> Load(const fs::path& _path)
@@ -50,6 +120,29 @@ public:
         }
     }
 
+    template<typename T>
+    NODISCARD Result<Ref<T>> GetOrLoad(const AssetID _id)
+    {
+        static_assert(std::is_base_of_v<Asset, T>, "T must inherit from Asset.");
+        auto [pAsset, bResult] = GetOrLoad(T::s_type, _id);
+        if (bResult)
+        {
+            return std::static_pointer_cast<T>(pAsset);
+        }
+        return Fail;
+    }
+
+    // 파일 읽기는 FileIOService 로, 디코딩은 워커 스레드에서, GPU 리소스 생성은 Application::SubmitCommand 로 메인 스레드에서 처리
+    // 이미 로드된 에셋은 바로 완료된 핸들을, 진행 중인 키는 같은 요청을 공유하는 핸들을 반환
+    // 워커는 먼저 Asset::GatherDependencies 로 의존 에셋을 찾아 요청하므로 의존 그래프 전체가 병렬로 로드됨
+    // 의존 에셋이 모두 끝난 뒤에 마무리되어 컨테이너에 추가되고 AssetLoadEvent 가 전송됨. 메인 스레드에서만 호출해야 함
+    template<typename T>
+    NODISCARD AssetHandle<T> LoadAsync(const fs::path& _path)
+    {
+        static_assert(std::is_base_of_v<Asset, T>, "T must inherit from Asset.");
+        return AssetHandle<T>(LoadAsync(T::s_type, _path).GetRequest());
+    }
+
     template<typename T>
     NODISCARD Result<Ref<T>> Get(const fs::path& _path) const
     {
@@ -66,6 +159,18 @@ public:
         }
     }
 
+    template<typename T>
+    NODISCARD Result<Ref<T>> Get(const AssetID _id) const
+    {
+        static_assert(std::is_base_of_v<Asset, T>, "T must inherit from Asset.");
+        auto [pAsset, bResult] = Get(T::s_type, _id);
+        if (bResult)
+        {
+            return std::static_pointer_cast<T>(pAsset);
+        }
+        return Fail;
+    }
+
     template<typename T>
     bool Unload(const fs::path& _path)
     {
@@ -80,8 +185,19 @@ public:
         return Contain(T::s_type, _path);
     }
 
+    template<typename T>
+    NODISCARD bool Contain(const AssetID _id) const
+    {
+        static_assert(std::is_base_of_v<Asset, T>, "T must inherit from Asset.");
+        return Contain(T::s_type, _id);
+    }
+
+    // 경로를 인턴한 ID (처음 보는 경로만 정규화됨). ID 로 찾는 함수들은 할당 없이 컨테이너를 탐색함
+    NODISCARD Result<AssetID>  GetAssetID(const fs::path& _path) const { return m_pathTable.Intern(_path); }
+    NODISCARD Result<fs::path> GetAssetPath(AssetID _id) const;   // 정규화된 키 경로
+
     NODISCARD const Container& GetContainer(const eAssetType _type) const { return GetContainer_(_type); }
-    NODISCARD Container&       GetContainerRef(const eAssetType _type) { return GetContainer_(_type); }
+    NODISCARD Container&       GetContainerRef(const eAssetType _type) { return GetContainer_(_type); }   // 직접 수정한 에셋은 상주 메모리 합에 반영되지 않음
 
     NODISCARD size_t GetAssetCount(const eAssetType _type) const
     {
@@ -100,20 +216,109 @@ public:
     }
 
     NODISCARD Result<Ref<Asset>> GetOrLoad(eAssetType _type, const fs::path& _path);
-    Result<Ref<Asset>>           Load(eAssetType _type, const fs::path& _path);
+    Result<Ref<Asset>>           Load(eAssetType _type, const fs::path& _path);   // LoadAsync 후 기다려서 마무리함. 이미 존재하는 에셋은 느슨한 파일에서 다시 로드
+    NODISCARD AssetHandle<Asset> LoadAsync(eAssetType _type, const fs::path& _path);
     NODISCARD Result<Ref<Asset>> Get(eAssetType _type, const fs::path& _path) const;
     bool                         Unload(eAssetType _type, const fs::path& _path);
     NODISCARD bool               Contain(eAssetType _type, const fs::path& _path) const;
 
+    NODISCARD Result<Ref<Asset>> GetOrLoad(eAssetType _type, AssetID _id);
+    NODISCARD Result<Ref<Asset>> Get(eAssetType _type, AssetID _id) const;
+    NODISCARD bool               Contain(eAssetType _type, AssetID _id) const;
+
+    NODISCARD size_t GetPendingLoadCount() const;
+    void             FinishPendingLoads();   // 진행 중인 모든 비동기 로드를 기다려서 의존 순서대로 마무리 (씬 로드)
+
+    // 상주 메모리 예산 (Asset::GetResidentByteSize 의 타입별 합, 0 이라면 무제한)
+    // 예산을 넘으면 매니저만 참조하는 에셋을 가장 오래 접근하지 않은 순서로 언로드 (AssetUnloadEvent 전송)
+    // 언로드된 에셋은 다음 GetOrLoad / LoadAsync 에서 다시 로드됨
+    // 컨테이너에 추가될 때 검사하며, 참조가 풀린 에셋을 위해 매 프레임 EnforceResidencyBudgets() 를 호출해야 함 (SceneLayer)
+    void             SetResidencyBudget(eAssetType _type, UInt64 _byteBudget);
+    NODISCARD UInt64 GetResidencyBudget(eAssetType _type) const { return m_residencies[EnumToInt(_type)].byteBudget; }
+    NODISCARD UInt64 GetResidentByteSize(eAssetType _type) const { return m_residencies[EnumToInt(_type)].residentByteSize; }
+    UInt64           EnforceResidencyBudgets();   // 해제한 바이트 수 반환
+
     void ClearAll();
     void Clear(eAssetType _type);
 
+    // 내용 해시 기반 중복 제거 (기본값 꺼짐)
+    // 켜져 있다면 로드할 때 파일 내용의 128비트 해시 (팩 항목에 기록된 해시 혹은 워커 스레드에서 계산) 를 구하고
+    // 같은 타입에 내용이 같은 에셋이 이미 있다면 GPU 리소스를 만들지 않고 그 에셋을 새 키로도 공유함 (경로 API 는 그대로)
+    // 공유 에셋은 마지막 키가 언로드될 때 해제되며 상주 메모리에는 한 번만 포함됨
+    // 공유 중인 키를 느슨한 파일에서 다시 로드 (Load) 하면 다른 키에 영향을 주지 않도록 새 에셋으로 분리됨
+    void                              SetDeduplication(const bool _bEnable) { m_bDeduplication = _bEnable; }
+    NODISCARD bool                    IsDeduplicationEnabled() const { return m_bDeduplication; }
+    NODISCARD AssetDeduplicationStats GetDeduplicationStats(eAssetType _type) const;
+
+    // 팩 파일 마운트 (모든 AssetManager 가 공유, 메인 스레드 전용)
+    // 로드할 때 나중에 마운트한 팩부터 키를 찾고 어느 팩에도 없다면 느슨한 파일을 읽음
+    // 진행 중인 로드는 요청 시점의 팩 목록을 사용하며 로더가 참조하는 동안 팩은 언마운트되어도 해제되지 않음
+    static bool             MountPack(const fs::path& _packPath);
+    static bool             UnmountPack(const fs::path& _packPath);
+    NODISCARD static size_t GetMountedPackCount() { return s_mountedPacks.size(); }
+
 private:
+    using PendingLoads = FlatIDMap<Ref<AssetLoadRequest>>;
+
+    // 비동기 로드 상태. 워커가 제출한 마무리 커맨드는 weak_ptr 로 참조하므로 매니저가 먼저 파괴되어도 안전함
+    struct AsyncLoadContext
+    {
+        AssetManager* pOwner = nullptr;   // 이동 시 갱신
+        PendingLoads  pendingLoads[EnumCount<eAssetType>()];
+    };
+
     NODISCARD Ref<Asset>       CreateAsset_(eAssetType _type) const;
+    NODISCARD Ref<Asset>       Find_(eAssetType _type, AssetID _id) const;   // 찾았다면 접근 시점 갱신
     NODISCARD Container&       GetContainer_(eAssetType _type);
     NODISCARD const Container& GetContainer_(eAssetType _type) const;
 
-    Container m_containers[EnumCount<eAssetType>()];
+    NODISCARD Ref<AssetLoadRequest> RequestLoad_(eAssetType _type, const fs::path& _path);
+    NODISCARD Ref<AssetLoadRequest> FindPendingLoad_(eAssetType _type, AssetID _id) const;
+    void                            RequestDependencies_(const Ref<AssetLoadRequest>& _pRequest);
+    void                            FinalizeLoad_(const Ref<AssetLoadRequest>& _pRequest, bool _bWait);   // _bWait: 워커와 의존 요청을 기다림
+    void                            NotifyDependents_(const Ref<AssetLoadRequest>& _pRequest);
+    void                            CancelPendingLoads_(eAssetType _type);
+
+    // 팩에 있다면 팩 항목을, 없다면 느슨한 파일을 비동기로 읽음 (중복 제거 요청이라면 팩 항목의 내용 해시를 기록)
+    // k_mappedLooseFileByteWidth 이상의 느슨한 파일은 메모리 맵으로 열어 바로 콜백을 호출함
+    constexpr static UInt64 k_mappedLooseFileByteWidth = 4ull * 1024ull * 1024ull;   // 4MB
+
+    static void ReadAssetFile_(std::span<const Ref<const AssetPack>> _packs, AssetLoadRequest& _request, FileIOService::ReadCallback _callback);
+
+    // 컨테이너 키 관리 (중복 제거로 여러 키가 같은 에셋을 가리킬 수 있음)
+    NODISCARD Ref<Asset> FindSharedAsset_(eAssetType _type, const AssetContentHash& _contentHash) const;
+    void                 AddKey_(eAssetType _type, AssetID _id, const Ref<Asset>& _pAsset, const AssetContentHash& _contentHash);
+    bool                 RemoveKey_(eAssetType _type, AssetID _id);   // 마지막 키였다면 에셋을 언로드하고 true 반환
+    void                 ForgetContentHash_(eAssetType _type, Asset& _asset);
+
+    struct Residency
+    {
+        UInt64 byteBudget       = 0;   // 0 이라면 무제한
+        UInt64 residentByteSize = 0;
+    };
+
+    void   Touch_(const Asset& _asset) const;
+    void   UpdateResidency_(eAssetType _type, Asset& _asset);   // 로드 / 다시 로드 후 크기 갱신
+    void   ReleaseResidency_(eAssetType _type, Asset& _asset);
+    UInt64 EvictOverBudget_(eAssetType _type);
+
+    Container              m_containers[EnumCount<eAssetType>()];
+    mutable AssetPathTable m_pathTable;       // Get / Contain 에서도 처음 보는 경로는 인턴됨
+    Ref<AsyncLoadContext>  m_pAsyncContext;   // 첫 LoadAsync 에서 생성
+
+    Residency      m_residencies[EnumCount<eAssetType>()];
+    mutable UInt64 m_useStamp = 0;   // 접근할 때마다 증가 (Asset::m_lastUseStamp)
+
+    struct ContentHashHasher
+    {
+        size_t operator()(const AssetContentHash& _hash) const { return static_cast<size_t>(_hash.low); }
+    };
+    using ContentTable = std::unordered_map<AssetContentHash, std::weak_ptr<Asset>, ContentHashHasher>;
+
+    bool         m_bDeduplication = false;
+    ContentTable m_contentTables[EnumCount<eAssetType>()];   // 내용 해시 -> 상주 중인 에셋 (키가 하나 이상 남은 동안)
+
+    inline static std::vector<Ref<const AssetPack>> s_mountedPacks;   // 마운트 순서
 };
 
 }   // namespace jam
\ No newline at end of file
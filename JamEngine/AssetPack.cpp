@@ -0,0 +1,175 @@
+#include "pch.h"
+
+#include "AssetPack.h"
+
+#include "ThreadPool.h"
+
+#include <xxhash.h>
+
+namespace
+{
+
+using namespace jam;
+
+NODISCARD bool IsValidEntry(const AssetPackEntry& _entry, const size_t _fileByteWidth, const size_t _pathTableByteWidth)
+{
+    if (!_entry.id.IsValid() || _entry.offset > _fileByteWidth || _entry.storedByteWidth > _fileByteWidth - _entry.offset)
+    {
+        return false;
+    }
+
+    if (static_cast<size_t>(_entry.pathOffset) + _entry.pathByteWidth > _pathTableByteWidth)
+    {
+        return false;
+    }
+
+    const eCompressionCodec codec = static_cast<eCompressionCodec>(_entry.codec);
+    if (codec == eCompressionCodec::None)
+    {
+        return _entry.rawByteWidth == _entry.storedByteWidth;
+    }
+    return GetCompressionCodec(codec) != nullptr;
+}
+
+NODISCARD Result<AssetFile> DecompressEntry(const AssetPack& _pack, const AssetPackEntry& _entry, const std::span<const UInt8> _stored)
+{
+    Ref<UInt8[]>           pBuffer(new UInt8[static_cast<size_t>(_entry.rawByteWidth)]);
+    const std::span<UInt8> raw(pBuffer.get(), static_cast<size_t>(_entry.rawByteWidth));
+    if (!GetCompressionCodec(static_cast<eCompressionCodec>(_entry.codec))->Decompress(_stored, raw))
+    {
+        JAM_ERROR("AssetPack::ReadEntry() - Failed to decompress '{}' in pack file: {}", _pack.GetEntryPath(_entry), _pack.GetPath().string());
+        return Fail;
+    }
+    return AssetFile(raw, std::move(pBuffer));
+}
+
+}   // namespace
+
+namespace jam
+{
+
+bool AssetPack::Open(const fs::path& _path)
+{
+    Close();
+    if (!m_file.Open(_path))
+    {
+        return false;
+    }
+
+    // 헤더
+    const std::span<const UInt8> file = m_file.GetData();
+    AssetPackHeader              header;
+    if (file.size() < sizeof(AssetPackHeader))
+    {
+        JAM_ERROR("AssetPack::Open() - File is too small: {}", _path.string());
+        Close();
+        return false;
+    }
+    std::memcpy(&header, file.data(), sizeof(AssetPackHeader));
+
+    if (header.magic != k_assetPackMagic || header.version != k_assetPackVersion)
+    {
+        JAM_ERROR("AssetPack::Open() - Unsupported pack file (magic {:08x}, version {}): {}", header.magic, header.version, _path.string());
+        Close();
+        return false;
+    }
+
+    // 항목 테이블은 헤더 바로 뒤, 경로 문자열 테이블은 항목 테이블 바로 뒤
+    const UInt64 entryTableByteWidth = static_cast<UInt64>(header.entryCount) * sizeof(AssetPackEntry);
+    if (header.pathTableOffset != sizeof(AssetPackHeader) + entryTableByteWidth || header.pathTableOffset > file.size() || header.pathTableByteWidth > file.size() - header.pathTableOffset)
+    {
+        JAM_ERROR("AssetPack::Open() - Table range exceeds file size: {}", _path.string());
+        Close();
+        return false;
+    }
+
+    const std::span<const UInt8> tables = file.subspan(sizeof(AssetPackHeader), static_cast<size_t>(entryTableByteWidth + header.pathTableByteWidth));
+    if (XXH3_64bits(tables.data(), tables.size()) != header.tableChecksum)
+    {
+        JAM_ERROR("AssetPack::Open() - Table checksum mismatch: {}", _path.string());
+        Close();
+        return false;
+    }
+
+    // 매핑은 페이지 단위로 정렬되고 헤더 크기는 8 의 배수이므로 항목 테이블을 그대로 참조할 수 있음
+    m_entries   = { reinterpret_cast<const AssetPackEntry*>(tables.data()), header.entryCount };
+    m_pathTable = { reinterpret_cast<const char*>(tables.data() + entryTableByteWidth), static_cast<size_t>(header.pathTableByteWidth) };
+
+    // 잘린 파일, 정렬되지 않은 테이블 검사 (Find 는 이진 탐색)
+    for (size_t i = 0; i < m_entries.size(); ++i)
+    {
+        const AssetPackEntry& entry = m_entries[i];
+        if (!IsValidEntry(entry, file.size(), m_pathTable.size()) || (i > 0 && m_entries[i - 1].id.value >= entry.id.value))
+        {
+            JAM_ERROR("AssetPack::Open() - Invalid entry {} in pack file: {}", i, _path.string());
+            Close();
+            return false;
+        }
+    }
+
+    m_path = _path;
+    return true;
+}
+
+void AssetPack::Close()
+{
+    m_file.Close();
+    m_entries   = {};
+    m_pathTable = {};
+    m_path.clear();
+}
+
+const AssetPackEntry* AssetPack::Find(const AssetID _id) const
+{
+    const auto iterator = std::ranges::lower_bound(m_entries, _id.value, std::less<>(), [](const AssetPackEntry& _entry) { return _entry.id.value; });
+    if (iterator == m_entries.end() || iterator->id != _id)
+    {
+        return nullptr;
+    }
+    return &*iterator;
+}
+
+std::string_view AssetPack::GetEntryPath(const AssetPackEntry& _entry) const
+{
+    return m_pathTable.substr(_entry.pathOffset, _entry.pathByteWidth);
+}
+
+Result<AssetFile> AssetPack::ReadEntry(const Ref<const AssetPack>& _pPack, const AssetPackEntry& _entry)
+{
+    JAM_ASSERT(_pPack && _pPack->IsOpen(), "AssetPack::ReadEntry() - Pack is not open");
+
+    const std::span<const UInt8> stored = _pPack->m_file.GetData().subspan(static_cast<size_t>(_entry.offset), static_cast<size_t>(_entry.storedByteWidth));
+    if (static_cast<eCompressionCodec>(_entry.codec) == eCompressionCodec::None)   // 복사 없음
+    {
+        return AssetFile(stored, _pPack);
+    }
+    return DecompressEntry(*_pPack, _entry, stored);
+}
+
+void AssetPack::ReadEntryAsync(const Ref<const AssetPack>& _pPack, const AssetPackEntry& _entry, FileIOService::ReadCallback _callback)
+{
+    JAM_ASSERT(_pPack && _pPack->IsOpen(), "AssetPack::ReadEntryAsync() - Pack is not open");
+
+    if (static_cast<eCompressionCodec>(_entry.codec) == eCompressionCodec::None || _entry.storedByteWidth == 0)
+    {
+        _callback(ReadEntry(_pPack, _entry));
+        return;
+    }
+
+    // 완료 스레드를 막지 않도록 해제는 워커 스레드에서
+    FileIOService::GetGlobal().Read(
+        _pPack->GetPath(),
+        [_pPack, _entry, callback = std::move(_callback)](Result<AssetFile> _stored) mutable
+        {
+            ThreadPool::GetGlobal().Submit(
+                [pPack = std::move(_pPack), _entry, callback = std::move(callback), stored = std::move(_stored)]
+                {
+                    auto [file, bRead] = stored;
+                    callback(bRead ? DecompressEntry(*pPack, _entry, file.GetData()) : Result<AssetFile>(Fail));
+                });
+        },
+        _entry.offset,
+        _entry.storedByteWidth);
+}
+
+}   // namespace jam
\ No newline at end of file
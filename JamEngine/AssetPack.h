@@ -0,0 +1,75 @@
+#pragma once
+#include "AssetFile.h"
+#include "AssetID.h"
+#include "Compression.h"
+#include "FileIOService.h"
+#include "MappedFile.h"
+
+namespace jam
+{
+
+// .jpack 파일 레이아웃 (리틀 엔디언)
+// [AssetPackHeader][AssetPackEntry * entryCount][경로 문자열 테이블 (UTF-8)][페이로드 ...]
+// 항목은 id 오름차순으로 정렬되어 있으므로 이진 탐색으로 찾으며 페이로드는 payloadAlignment 로 정렬됨
+// 항목마다 압축 여부를 고를 수 있으며 무압축 항목은 매핑된 메모리를 그대로 로더에 전달함 (AssetFile)
+
+constexpr UInt32 k_assetPackMagic            = 0x4B41504A;   // "JPAK" (little endian)
+constexpr UInt32 k_assetPackVersion          = 2;   // 2: 항목에 내용 해시 추가
+constexpr UInt32 k_assetPackDefaultAlignment = 64;   // 페이로드 정렬 (모델 스트림 정렬의 배수)
+
+struct AssetPackHeader
+{
+    UInt32 magic              = k_assetPackMagic;
+    UInt32 version            = k_assetPackVersion;
+    UInt32 entryCount         = 0;   // 항목 테이블은 헤더 바로 뒤
+    UInt32 payloadAlignment   = k_assetPackDefaultAlignment;
+    UInt64 pathTableOffset    = 0;   // 파일 시작부터 경로 문자열 테이블까지의 오프셋
+    UInt64 pathTableByteWidth = 0;
+    UInt64 tableChecksum      = 0;   // 항목 테이블 + 경로 문자열 테이블의 XXH3
+};
+static_assert(sizeof(AssetPackHeader) == 40, "AssetPackHeader layout must be stable");
+
+struct AssetPackEntry
+{
+    AssetID          id;                    // CreateAssetIDFromKey(키 경로)
+    UInt64           offset          = 0;   // 파일 시작부터 페이로드까지의 오프셋
+    UInt64           storedByteWidth = 0;   // 팩에 저장된 크기
+    UInt64           rawByteWidth    = 0;   // 해제 후 크기 (무압축이라면 storedByteWidth 와 같음)
+    AssetContentHash contentHash;           // 원본 내용의 해시 (로드할 때 다시 계산하지 않음)
+    UInt32           pathOffset      = 0;   // 경로 문자열 테이블 내의 오프셋
+    UInt16           pathByteWidth   = 0;
+    UInt8            codec           = 0;   // eCompressionCodec
+    UInt8            reserved        = 0;
+};
+static_assert(sizeof(AssetPackEntry) == 56, "AssetPackEntry layout must be stable");
+
+// 읽기 전용 팩 파일 (AssetManager::MountPack)
+// 파일 전체를 메모리 맵으로 열고 헤더와 항목 테이블만 검증하며 페이로드는 읽을 때까지 건드리지 않음
+// 열린 뒤에는 상태가 바뀌지 않으므로 여러 워커 스레드에서 동시에 읽을 수 있음
+class AssetPack
+{
+public:
+    bool Open(const fs::path& _path);
+    void Close();
+
+    NODISCARD const AssetPackEntry*           Find(AssetID _id) const;   // 없다면 nullptr
+    NODISCARD std::span<const AssetPackEntry> GetEntries() const { return m_entries; }
+    NODISCARD std::string_view                GetEntryPath(const AssetPackEntry& _entry) const;   // 키 경로 (UTF-8)
+    NODISCARD const fs::path&                 GetPath() const { return m_path; }
+    NODISCARD bool                            IsOpen() const { return m_file.IsOpen(); }
+
+    // 항목 내용. 무압축 항목은 팩의 메모리를 가리키며 (_pPack 을 소유자로 공유) 압축 항목은 호출한 스레드에서 해제함
+    NODISCARD static Result<AssetFile> ReadEntry(const Ref<const AssetPack>& _pPack, const AssetPackEntry& _entry);
+
+    // 비동기로 읽기. 무압축 항목은 호출한 스레드에서 바로 콜백을 호출하고
+    // 압축 항목은 저장된 바이트를 FileIOService 로 읽은 뒤 (페이지 폴트 대신 큐 깊이만큼 동시에 읽음) ThreadPool 에서 해제하고 콜백을 호출함
+    static void ReadEntryAsync(const Ref<const AssetPack>& _pPack, const AssetPackEntry& _entry, FileIOService::ReadCallback _callback);
+
+private:
+    fs::path                        m_path;
+    MappedFile                      m_file;
+    std::span<const AssetPackEntry> m_entries;
+    std::string_view                m_pathTable;
+};
+
+}   // namespace jam
\ No newline at end of file
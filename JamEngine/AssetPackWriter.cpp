@@ -0,0 +1,249 @@
+#include "pch.h"
+
+#include "AssetPackWriter.h"
+
+#include "AssetPathTable.h"
+#include "StringUtilities.h"
+#include "ThreadPool.h"
+
+#include <bit>
+#include <fstream>
+#include <xxhash.h>
+
+namespace
+{
+
+using namespace jam;
+
+// 워커 스레드에서 읽고 압축한 항목 하나
+struct EncodedPayload
+{
+    AssetFile          file;          // 원본 (무압축 항목은 그대로 기록)
+    std::vector<UInt8> compressed;    // codec 이 None 이 아닐 때만 사용
+    AssetContentHash   contentHash;   // 원본의 해시
+    eCompressionCodec  codec   = eCompressionCodec::None;
+    bool               bResult = false;
+};
+
+NODISCARD UInt64 AlignPayloadOffset(const UInt64 _offset, const UInt32 _alignment)
+{
+    return (_offset + (_alignment - 1)) & ~static_cast<UInt64>(_alignment - 1);
+}
+
+NODISCARD EncodedPayload EncodePayload(const fs::path& _path, const ICompressionCodec* _pCodec, const float _minCompressionGain)
+{
+    EncodedPayload payload;
+
+    // 빈 파일은 매핑할 수 없으므로 빈 항목으로 기록
+    std::error_code errorCode;
+    if (fs::file_size(_path, errorCode) == 0 && !errorCode)
+    {
+        payload.contentHash = CreateAssetContentHash({});
+        payload.bResult     = true;
+        return payload;
+    }
+
+    auto [file, bOpened] = AssetFile::OpenLoose(_path);
+    if (!bOpened)
+    {
+        return payload;
+    }
+    payload.file        = std::move(file);
+    payload.contentHash = CreateAssetContentHash(payload.file.GetData());
+
+    if (_pCodec && payload.file.GetData().size() <= _pCodec->GetMaxRawByteWidth())   // 코덱의 한계를 넘는 파일은 원본으로 기록
+    {
+        const std::span<const UInt8> raw = payload.file.GetData();
+        payload.compressed.resize(_pCodec->GetMaxCompressedSize(raw.size()));
+
+        auto [compressedSize, bCompressed] = _pCodec->Compress(raw, payload.compressed, CompressionStreamDesc());
+        if (bCompressed && static_cast<double>(compressedSize) <= static_cast<double>(raw.size()) * (1.0 - _minCompressionGain))
+        {
+            payload.compressed.resize(compressedSize);
+            payload.codec = _pCodec->GetType();
+        }
+        else   // 이미 압축된 파일
+        {
+            payload.compressed = std::vector<UInt8>();
+        }
+    }
+
+    payload.bResult = true;
+    return payload;
+}
+
+}   // namespace
+
+namespace jam
+{
+
+AssetPackWriter::AssetPackWriter(fs::path _rootDirectory)
+    : m_rootDirectory(std::move(_rootDirectory))
+{
+}
+
+bool AssetPackWriter::AddFile(const fs::path& _path)
+{
+    // 키는 AssetPathTable 과 같은 규칙 (루트 디렉토리 기준 상대 경로)
+    const fs::path key = fs::relative(_path, m_rootDirectory);
+    if (key.empty() || key.native().starts_with(L".."))
+    {
+        JAM_ERROR("AssetPackWriter::AddFile() - File is outside of the root directory: {}", _path.string());
+        return false;
+    }
+
+    const AssetID id        = CreateAssetIDFromKey(key);
+    std::string   keyString = ConvertToString(key.generic_wstring());
+    if (keyString.size() > std::numeric_limits<UInt16>::max())
+    {
+        JAM_ERROR("AssetPackWriter::AddFile() - Path is too long: {}", _path.string());
+        return false;
+    }
+
+    if (const auto iterator = m_sourceIndices.find(id); iterator != m_sourceIndices.end())
+    {
+        const Source& source = m_sources[iterator->second];
+        if (ToLower(source.key) == ToLower(keyString))   // 이미 추가된 파일
+        {
+            return true;
+        }
+
+        JAM_ERROR("AssetPackWriter::AddFile() - Asset id collision between '{}' and '{}'", source.key, keyString);
+        return false;
+    }
+
+    m_sourceIndices[id] = m_sources.size();
+    m_sources.emplace_back(id, std::move(keyString), _path);
+    return true;
+}
+
+UInt32 AssetPackWriter::AddDirectory(const fs::path& _directory)
+{
+    UInt32          addedCount = 0;
+    std::error_code errorCode;
+    for (const fs::directory_entry& entry: fs::recursive_directory_iterator(_directory, errorCode))
+    {
+        if (entry.is_regular_file() && AddFile(entry.path()))
+        {
+            ++addedCount;
+        }
+    }
+
+    if (errorCode)
+    {
+        JAM_ERROR("AssetPackWriter::AddDirectory() - Failed to iterate directory: {} ({})", _directory.string(), errorCode.message());
+    }
+    return addedCount;
+}
+
+Result<AssetPackWriteReport> AssetPackWriter::Write(const fs::path& _path, const AssetPackWriteDesc& _desc) const
+{
+    JAM_ASSERT(std::has_single_bit(_desc.payloadAlignment), "AssetPackWriter::Write() - Payload alignment must be a power of two");
+
+    const ICompressionCodec* pCodec = _desc.codec != eCompressionCodec::None ? GetCompressionCodec(_desc.codec) : nullptr;
+    if (_desc.codec != eCompressionCodec::None && !pCodec)
+    {
+        JAM_ERROR("AssetPackWriter::Write() - Compression codec is not registered: {}", EnumToInt(_desc.codec));
+        return Fail;
+    }
+
+    // 항목 테이블과 경로 문자열 테이블 (ID 순으로 정렬, 오프셋은 페이로드를 기록하면서 채움)
+    std::vector<const Source*> sources;
+    sources.reserve(m_sources.size());
+    for (const Source& source: m_sources)
+    {
+        sources.push_back(&source);
+    }
+    std::ranges::sort(sources, std::less<>(), [](const Source* _pSource) { return _pSource->id.value; });
+
+    std::vector<AssetPackEntry> entries(sources.size());
+    std::string                 pathTable;
+    for (size_t i = 0; i < sources.size(); ++i)
+    {
+        entries[i].id            = sources[i]->id;
+        entries[i].pathOffset    = static_cast<UInt32>(pathTable.size());
+        entries[i].pathByteWidth = static_cast<UInt16>(sources[i]->key.size());
+        pathTable += sources[i]->key;
+    }
+
+    AssetPackHeader header;
+    header.entryCount         = static_cast<UInt32>(entries.size());
+    header.payloadAlignment   = _desc.payloadAlignment;
+    header.pathTableOffset    = sizeof(AssetPackHeader) + entries.size() * sizeof(AssetPackEntry);
+    header.pathTableByteWidth = pathTable.size();
+
+    std::fstream stream(_path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!stream.is_open())
+    {
+        JAM_ERROR("AssetPackWriter::Write() - Failed to open file: {}", _path.string());
+        return Fail;
+    }
+
+    // 테이블 자리는 비워두고 페이로드부터 기록
+    const std::vector<char> padding(std::max<size_t>(header.pathTableOffset, _desc.payloadAlignment), 0);
+    stream.write(padding.data(), static_cast<std::streamsize>(header.pathTableOffset));
+    stream.write(pathTable.data(), static_cast<std::streamsize>(pathTable.size()));
+
+    AssetPackWriteReport report;
+    UInt64               offset    = header.pathTableOffset + header.pathTableByteWidth;
+    const UInt32         batchSize = std::max(_desc.batchSize, 1u);
+    for (size_t batchBegin = 0; batchBegin < sources.size(); batchBegin += batchSize)
+    {
+        const UInt32                batchCount = static_cast<UInt32>(std::min<size_t>(batchSize, sources.size() - batchBegin));
+        std::vector<EncodedPayload> payloads(batchCount);
+        ThreadPool::GetGlobal().ParallelFor(batchCount, [&](const UInt32 _index) {
+            payloads[_index] = EncodePayload(sources[batchBegin + _index]->path, pCodec, _desc.minCompressionGain);
+        });
+
+        // 파일 순서대로 기록
+        for (UInt32 i = 0; i < batchCount; ++i)
+        {
+            const EncodedPayload& payload = payloads[i];
+            AssetPackEntry&       entry   = entries[batchBegin + i];
+            if (!payload.bResult)
+            {
+                JAM_ERROR("AssetPackWriter::Write() - Failed to read file: {}", sources[batchBegin + i]->path.string());
+                return Fail;
+            }
+
+            const UInt64 alignedOffset = AlignPayloadOffset(offset, _desc.payloadAlignment);
+            stream.write(padding.data(), static_cast<std::streamsize>(alignedOffset - offset));
+
+            const std::span<const UInt8> stored = payload.codec != eCompressionCodec::None ? std::span<const UInt8>(payload.compressed) : payload.file.GetData();
+            stream.write(reinterpret_cast<const char*>(stored.data()), static_cast<std::streamsize>(stored.size()));
+
+            entry.offset          = alignedOffset;
+            entry.storedByteWidth = stored.size();
+            entry.rawByteWidth    = payload.file.GetByteWidth();
+            entry.contentHash     = payload.contentHash;
+            entry.codec           = EnumToInt(payload.codec);
+            offset                = alignedOffset + stored.size();
+
+            report.rawByteWidth += entry.rawByteWidth;
+            report.compressedEntryCount += payload.codec != eCompressionCodec::None ? 1 : 0;
+        }
+    }
+
+    // 테이블 기록
+    XXH3_state_t* pState = XXH3_createState();
+    XXH3_64bits_reset(pState);
+    XXH3_64bits_update(pState, entries.data(), entries.size() * sizeof(AssetPackEntry));
+    XXH3_64bits_update(pState, pathTable.data(), pathTable.size());
+    header.tableChecksum = XXH3_64bits_digest(pState);
+    XXH3_freeState(pState);
+
+    stream.seekp(0);
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(AssetPackHeader));
+    stream.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(AssetPackEntry)));
+    if (!stream.flush())
+    {
+        JAM_ERROR("AssetPackWriter::Write() - Failed to write file: {}", _path.string());
+        return Fail;
+    }
+
+    report.entryCount    = header.entryCount;
+    report.fileByteWidth = offset;
+    return report;
+}
+
+}   // namespace jam
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+#include "AssetPack.h"
+#include "FlatIDMap.h"
+
+namespace jam
+{
+
+struct AssetPackWriteDesc
+{
+    eCompressionCodec codec              = eCompressionCodec::LZ4;   // None 이라면 모든 항목을 무압축으로 저장
+    float             minCompressionGain = 0.1f;   // 이 비율 이상 줄어들지 않는 항목은 무압축 (이미 압축된 이미지, 청크 모델)
+    UInt32            payloadAlignment   = k_assetPackDefaultAlignment;   // 2 의 거듭제곱
+    UInt32            batchSize          = 64;   // 한 번에 병렬로 압축하는 파일 수 (메모리 사용량 제한)
+};
+
+struct AssetPackWriteReport
+{
+    UInt32 entryCount           = 0;
+    UInt32 compressedEntryCount = 0;
+    UInt64 rawByteWidth         = 0;   // 원본 파일 크기의 합
+    UInt64 fileByteWidth        = 0;   // 팩 파일 크기 (테이블, 정렬 포함)
+};
+
+// 파일들을 하나의 팩 파일로 묶음 (쿠킹)
+// 키 경로는 실행 시의 작업 디렉토리가 될 루트 디렉토리 기준 상대 경로이며 AssetManager 의 키와 같은 AssetID 로 기록됨
+// 원본 파일은 메모리 맵으로 읽고 배치 단위로 병렬 압축한 뒤 순서대로 기록하므로 출력은 스레드 수와 무관하게 같음
+class AssetPackWriter
+{
+public:
+    explicit AssetPackWriter(fs::path _rootDirectory);
+
+    bool   AddFile(const fs::path& _path);             // 루트 디렉토리 밖의 파일이거나 ID 가 충돌하면 실패
+    UInt32 AddDirectory(const fs::path& _directory);   // 하위 디렉토리의 모든 파일, 추가한 파일 수 반환
+
+    NODISCARD Result<AssetPackWriteReport> Write(const fs::path& _path, const AssetPackWriteDesc& _desc = AssetPackWriteDesc()) const;
+    NODISCARD size_t                       GetFileCount() const { return m_sources.size(); }
+
+private:
+    struct Source
+    {
+        AssetID     id;
+        std::string key;   // UTF-8, '/' 구분자
+        fs::path    path;
+    };
+
+    fs::path            m_rootDirectory;
+    std::vector<Source> m_sources;
+    FlatIDMap<size_t>   m_sourceIndices;   // ID -> m_sources 인덱스 (중복 추가, 충돌 검사)
+};
+
+}   // namespace jam
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include "pch.h"
+
+#include "AssetPathTable.h"
+
+#include "Application.h"
+#include "StringUtilities.h"
+
+#include <xxhash.h>
+
+namespace
+{
+
+using namespace jam;
+
+// 올바른 키는 work directory 로 부터의 상대 경로
+NODISCARD Result<fs::path> CreateKeyFromPath(const fs::path& _path)
+{
+    // 프로젝트 경로를 기준으로 키 생성
+    fs::path          key     = fs::relative(_path, GetApplication().GetWorkingDirectory());
+    std::wstring_view keyWStr = key.native();
+
+    if (keyWStr.starts_with(L"..") == false && keyWStr.empty() == false)   // 정확한 상대경로인지 확인
+    {
+        return key;
+    }
+    else
+    {
+        return Fail;
+    }
+}
+
+// 대소문자와 구분자가 달라도 같은 파일이라면 같은 문자열
+NODISCARD std::wstring NormalizeKey(const fs::path& _key)
+{
+    return ToLower(_key.generic_wstring());
+}
+
+// wchar_t 의 크기는 플랫폼마다 다르므로 UTF-8 로 변환해서 해시 (팩 파일에 기록되는 ID)
+NODISCARD AssetID CreateIDFromNormalizedKey(const std::wstring_view _normalizedKey)
+{
+    const std::string utf8Key = ConvertToString(_normalizedKey);
+    const UInt64      hash    = XXH3_64bits(utf8Key.data(), utf8Key.size());
+    return AssetID { hash != 0 ? hash : 1 };   // 0 은 유효하지 않은 ID
+}
+
+}   // namespace
+
+namespace jam
+{
+
+AssetID CreateAssetIDFromKey(const fs::path& _key)
+{
+    return CreateIDFromNormalizedKey(NormalizeKey(_key));
+}
+
+Result<AssetID> AssetPathTable::Intern(const fs::path& _path)
+{
+    // 이미 본 입력
+    const std::wstring_view input = _path.native();
+    if (const auto iterator = m_idsByInput.find(input); iterator != m_idsByInput.end())
+    {
+        if (!iterator->second.IsValid())
+        {
+            return Fail;
+        }
+        return iterator->second;
+    }
+
+    // 처음 보는 입력 - 정규화 후 ID 생성
+    AssetID id;
+    if (auto [key, bResult] = CreateKeyFromPath(_path); bResult)
+    {
+        const std::wstring normalizedKey = NormalizeKey(key);
+        id                               = CreateIDFromNormalizedKey(normalizedKey);
+
+        fs::path& keyRef = m_keysById[id];
+        if (keyRef.empty())
+        {
+            keyRef = std::move(key);
+        }
+        else if (NormalizeKey(keyRef) != normalizedKey)   // 64비트 해시 충돌
+        {
+            JAM_ERROR("AssetPathTable::Intern() - Asset id collision between '{}' and '{}'", keyRef.string(), key.string());
+            id = AssetID();
+        }
+    }
+    m_idsByInput.emplace(input, id);
+
+    if (!id.IsValid())
+    {
+        return Fail;
+    }
+    return id;
+}
+
+const fs::path* AssetPathTable::FindKey(const AssetID _id) const
+{
+    const auto iterator = m_keysById.find(_id);
+    return iterator != m_keysById.end() ? &iterator->second : nullptr;
+}
+
+}   // namespace jam
\ No newline at end of file
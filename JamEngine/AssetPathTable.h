@@ -0,0 +1,34 @@
+#pragma once
+#include "FlatIDMap.h"
+
+namespace jam
+{
+
+// 정규화된 키 경로 (작업 디렉토리 기준 상대 경로) 의 ID
+// 대소문자와 구분자를 무시한 UTF-8 문자열의 해시이므로 플랫폼과 실행에 무관하게 같음 (AssetPackWriter)
+NODISCARD AssetID CreateAssetIDFromKey(const fs::path& _key);
+
+// 에셋 경로 -> AssetID 인턴 테이블 (AssetManager 가 소유, 메인 스레드 전용)
+// 정규화 (작업 디렉토리 기준 fs::relative) 는 처음 보는 입력 경로에서 한 번만 수행되며
+// 이후에는 입력 문자열 그대로 캐시에서 찾으므로 할당이 없음
+class AssetPathTable
+{
+public:
+    // 작업 디렉토리 밖의 경로라면 실패
+    NODISCARD Result<AssetID> Intern(const fs::path& _path);
+
+    NODISCARD const fs::path* FindKey(AssetID _id) const;   // 정규화된 키 경로 (작업 디렉토리 기준 상대 경로), 없다면 nullptr
+    NODISCARD size_t          GetInternedCount() const { return m_keysById.size(); }
+
+private:
+    struct InputHash
+    {
+        using is_transparent = void;
+        NODISCARD size_t operator()(const std::wstring_view _input) const { return std::hash<std::wstring_view>()(_input); }
+    };
+
+    std::unordered_map<std::wstring, AssetID, InputHash, std::equal_to<>> m_idsByInput;   // 입력 경로 -> ID (올바르지 않은 경로는 유효하지 않은 ID)
+    FlatIDMap<fs::path>                                                   m_keysById;
+};
+
+}   // namespace jam
\ No newline at end of file
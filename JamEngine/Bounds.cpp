@@ -0,0 +1,247 @@
+#include "pch.h"
+
+#include "Bounds.h"
+
+#include <array>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define JAM_BOUNDS_SIMD 1
+#include <immintrin.h>
+#else
+#define JAM_BOUNDS_SIMD 0
+#endif
+
+namespace
+{
+
+using namespace jam;
+
+constexpr size_t k_unpackBlockSize = 64;   // 패킹된 위치를 복원하는 단위
+
+// strided float3 위치 스트림의 min/max
+// SSE 경로는 위치마다 16 바이트를 읽으므로 stride 가 16 보다 작다면 마지막 정점은 스칼라로 처리
+void AccumulateMinMax(const UInt8* _pPositions, const size_t _count, const size_t _stride, Vec3& _min, Vec3& _max)
+{
+    size_t i = 0;
+#if JAM_BOUNDS_SIMD
+    const size_t simdCount = _stride >= sizeof(float) * 4 ? _count : (_count > 0 ? _count - 1 : 0);
+    __m128       minV      = _mm_setr_ps(_min.x, _min.y, _min.z, 0.f);
+    __m128       maxV      = _mm_setr_ps(_max.x, _max.y, _max.z, 0.f);
+    for (; i < simdCount; ++i)
+    {
+        const __m128 position = _mm_loadu_ps(reinterpret_cast<const float*>(_pPositions + i * _stride));
+        minV                  = _mm_min_ps(minV, position);
+        maxV                  = _mm_max_ps(maxV, position);
+    }
+
+    alignas(16) float minValues[4];
+    alignas(16) float maxValues[4];
+    _mm_store_ps(minValues, minV);
+    _mm_store_ps(maxValues, maxV);
+    _min = Vec3(minValues[0], minValues[1], minValues[2]);
+    _max = Vec3(maxValues[0], maxValues[1], maxValues[2]);
+#endif
+
+    for (; i < _count; ++i)
+    {
+        const Vec3& position = *reinterpret_cast<const Vec3*>(_pPositions + i * _stride);
+        _min                 = Vec3::Min(_min, position);
+        _max                 = Vec3::Max(_max, position);
+    }
+}
+
+// strided float3 위치 스트림에서 _center 까지의 최대 제곱 거리
+NODISCARD float AccumulateMaxDistanceSquare(const UInt8* _pPositions, const size_t _count, const size_t _stride, const Vec3& _center, float _maxDistanceSquare)
+{
+    size_t i = 0;
+#if JAM_BOUNDS_SIMD
+    const size_t simdCount = _stride >= sizeof(float) * 4 ? _count : (_count > 0 ? _count - 1 : 0);
+    const __m128 centerV   = _mm_setr_ps(_center.x, _center.y, _center.z, 0.f);
+    const __m128 xyzMask   = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+    __m128       maxV      = _mm_set_ss(_maxDistanceSquare);
+    for (; i < simdCount; ++i)
+    {
+        const __m128 position = _mm_loadu_ps(reinterpret_cast<const float*>(_pPositions + i * _stride));
+        const __m128 offset   = _mm_and_ps(_mm_sub_ps(position, centerV), xyzMask);
+        const __m128 square   = _mm_mul_ps(offset, offset);
+        const __m128 sum      = _mm_add_ps(square, _mm_movehl_ps(square, square));                // (x + z, y, ...)
+        maxV                  = _mm_max_ss(maxV, _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1)));   // x + z + y
+    }
+    _maxDistanceSquare = _mm_cvtss_f32(maxV);
+#endif
+
+    for (; i < _count; ++i)
+    {
+        const Vec3& position = *reinterpret_cast<const Vec3*>(_pPositions + i * _stride);
+        _maxDistanceSquare   = std::max(_maxDistanceSquare, Vec3::DistanceSquared(position, _center));
+    }
+    return _maxDistanceSquare;
+}
+
+// 위치 스트림을 찾아 _func(pPositions, count, stride) 로 전달
+// float3 위치는 스트림을 그대로 사용하고 그 외 포맷은 블록 단위로 복원
+template<typename Func>
+void ForEachPositionBlock(const std::span<const UInt8> _vertices, const eVertexType _vertexType, const VertexQuantization& _quantization, Func&& _func)
+{
+    const UInt32 stride = GetVertexStride(_vertexType);
+    const size_t count  = _vertices.size() / stride;
+
+    const std::span<const VertexElementDesc> elements = GetVertexElements(_vertexType);
+    const auto                               iter     = std::ranges::find(elements, eVertexAttribute::Position, &VertexElementDesc::attribute);
+    if (iter != elements.end() && iter->format == eVertexFormat::Float3)
+    {
+        _func(_vertices.data() + iter->offset, count, stride);
+        return;
+    }
+
+    std::array<VertexAttribute, k_unpackBlockSize> block;
+    for (size_t begin = 0; begin < count; begin += block.size())
+    {
+        const size_t blockCount = std::min(block.size(), count - begin);
+        UnpackVertices(_vertexType, _vertices.data() + begin * stride, std::span(block.data(), blockCount), _quantization);
+        _func(reinterpret_cast<const UInt8*>(&block[0].position), blockCount, sizeof(VertexAttribute));
+    }
+}
+
+NODISCARD Bounds ComputeStridedBounds(const UInt8* _pPositions, const size_t _count, const size_t _stride)
+{
+    Bounds bounds;
+    if (_count == 0)
+    {
+        return bounds;
+    }
+
+    AccumulateMinMax(_pPositions, _count, _stride, bounds.min, bounds.max);
+    bounds.center = (bounds.min + bounds.max) * 0.5f;
+    bounds.radius = std::sqrt(AccumulateMaxDistanceSquare(_pPositions, _count, _stride, bounds.center, 0.f));
+    return bounds;
+}
+
+}   // namespace
+
+namespace jam
+{
+
+void Bounds::Merge(const Bounds& _other)
+{
+    if (!_other.IsValid())
+    {
+        return;
+    }
+
+    if (!IsValid())
+    {
+        *this = _other;
+        return;
+    }
+
+    min = Vec3::Min(min, _other.min);
+    max = Vec3::Max(max, _other.max);
+
+    // 두 구를 감싸는 구
+    Vec3        sphereCenter = center;
+    float       sphereRadius = radius;
+    const Vec3  offset       = _other.center - center;
+    const float distance     = offset.Length();
+    if (distance + radius <= _other.radius)
+    {
+        sphereCenter = _other.center;
+        sphereRadius = _other.radius;
+    }
+    else if (distance + _other.radius > radius)
+    {
+        sphereRadius = (distance + radius + _other.radius) * 0.5f;
+        sphereCenter = center + offset * ((sphereRadius - radius) / distance);
+    }
+
+    // 합친 AABB 를 감싸는 구가 더 작을 수 있음
+    const float boxRadius = GetExtents().Length();
+    if (boxRadius < sphereRadius)
+    {
+        center = (min + max) * 0.5f;
+        radius = boxRadius;
+    }
+    else
+    {
+        center = sphereCenter;
+        radius = sphereRadius;
+    }
+}
+
+Bounds Bounds::Transform(const Mat4& _transform) const
+{
+    if (!IsValid())
+    {
+        return *this;
+    }
+
+    // 행 벡터 규약 (v * M) - 축마다 min/max 중 기여가 작은 쪽과 큰 쪽을 더함
+    Bounds      result;
+    const float rows[3][3]   = {
+        { _transform._11, _transform._12, _transform._13 },
+        { _transform._21, _transform._22, _transform._23 },
+        { _transform._31, _transform._32, _transform._33 }
+    };
+    const float minValues[3] = { min.x, min.y, min.z };
+    const float maxValues[3] = { max.x, max.y, max.z };
+    float       resultMin[3] = { _transform._41, _transform._42, _transform._43 };
+    float       resultMax[3] = { _transform._41, _transform._42, _transform._43 };
+
+    float maxScaleSquare = 0.f;
+    for (int row = 0; row < 3; ++row)
+    {
+        float scaleSquare = 0.f;
+        for (int column = 0; column < 3; ++column)
+        {
+            const float element = rows[row][column];
+            const float a       = element * minValues[row];
+            const float b       = element * maxValues[row];
+            resultMin[column] += std::min(a, b);
+            resultMax[column] += std::max(a, b);
+            scaleSquare += element * element;
+        }
+        maxScaleSquare = std::max(maxScaleSquare, scaleSquare);
+    }
+
+    result.min    = Vec3(resultMin[0], resultMin[1], resultMin[2]);
+    result.max    = Vec3(resultMax[0], resultMax[1], resultMax[2]);
+    result.center = Vec3::Transform(center, _transform);
+    result.radius = radius * std::sqrt(maxScaleSquare);
+    return result;
+}
+
+Bounds ComputeBounds(const std::span<const VertexAttribute> _vertices)
+{
+    if (_vertices.empty())
+    {
+        return {};
+    }
+    return ComputeStridedBounds(reinterpret_cast<const UInt8*>(&_vertices[0].position), _vertices.size(), sizeof(VertexAttribute));
+}
+
+Bounds ComputeBounds(const std::span<const Vec3> _positions)
+{
+    return ComputeStridedBounds(reinterpret_cast<const UInt8*>(_positions.data()), _positions.size(), sizeof(Vec3));
+}
+
+Bounds ComputeBounds(const std::span<const UInt8> _vertices, const eVertexType _vertexType, const VertexQuantization& _quantization)
+{
+    Bounds bounds;
+    ForEachPositionBlock(_vertices, _vertexType, _quantization, [&bounds](const UInt8* _pPositions, const size_t _count, const size_t _stride) {
+        AccumulateMinMax(_pPositions, _count, _stride, bounds.min, bounds.max);
+    });
+    if (!bounds.IsValid())
+    {
+        return bounds;
+    }
+
+    bounds.center           = (bounds.min + bounds.max) * 0.5f;
+    float maxDistanceSquare = 0.f;
+    ForEachPositionBlock(_vertices, _vertexType, _quantization, [&bounds, &maxDistanceSquare](const UInt8* _pPositions, const size_t _count, const size_t _stride) {
+        maxDistanceSquare = AccumulateMaxDistanceSquare(_pPositions, _count, _stride, bounds.center, maxDistanceSquare);
+    });
+    bounds.radius = std::sqrt(maxDistanceSquare);
+    return bounds;
+}
+
+}   // namespace jam
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+#include "Vertex.h"
+
+namespace jam
+{
+
+// 축 정렬 경계 상자 + 경계 구 (모델 공간)
+// 경계 구의 중심은 AABB 중심이며 반지름은 중심에서 가장 먼 정점까지의 거리
+struct Bounds
+{
+    Vec3  min    = Vec3(std::numeric_limits<float>::max());
+    Vec3  max    = Vec3(std::numeric_limits<float>::lowest());
+    Vec3  center = Vec3::Zero;
+    float radius = 0.f;
+
+    NODISCARD bool IsValid() const { return min.x <= max.x; }   // 정점이 하나도 없다면 false
+    NODISCARD Vec3 GetExtents() const { return (max - min) * 0.5f; }
+
+    // 합집합. 경계 구는 두 구를 감싸는 구와 합친 AABB 를 감싸는 구 중 작은 쪽
+    void Merge(const Bounds& _other);
+
+    // 변환된 공간의 경계 (AABB 는 변환된 상자를 감싸는 AABB, 반지름은 가장 큰 축 배율로 늘림)
+    NODISCARD Bounds Transform(const Mat4& _transform) const;
+
+    bool operator==(const Bounds& _other) const = default;
+};
+
+// 정점 위치의 경계 (SIMD min/max)
+NODISCARD Bounds ComputeBounds(std::span<const VertexAttribute> _vertices);
+NODISCARD Bounds ComputeBounds(std::span<const Vec3> _positions);
+
+// GPU 레이아웃으로 패킹된 스트림 (양자화 위치는 복원한 값 기준)
+NODISCARD Bounds ComputeBounds(std::span<const UInt8> _vertices, eVertexType _vertexType, const VertexQuantization& _quantization = {});
+
+}   // namespace jam
\ No newline at end of file
@@ -19,27 +19,42 @@ Result<std::vector<UInt8>> BufferReader::ReadBuffer(ID3D11Buffer* _pBuffer)
     JAM_ASSERT(_pBuffer != nullptr, "BufferReader::ReadBuffer - Invalid buffer pointer.");
     D3D11_BUFFER_DESC desc;
     _pBuffer->GetDesc(&desc);
-    return ReadBuffer_(_pBuffer, desc.ByteWidth);
+    return ReadBuffer_(_pBuffer, 0, desc.ByteWidth);
 }
 
 Result<std::vector<UInt8>> BufferReader::ReadBuffer(const Buffer& _buffer)
 {
-    return ReadBuffer_(_buffer.Get(), _buffer.GetByteWidth());
+    return ReadBuffer_(_buffer.Get(), 0, _buffer.GetByteWidth());
 }
 
-Result<std::vector<UInt8>> BufferReader::ReadBuffer_(ID3D11Buffer* _pBuffer, const UInt32 _bufferByteWidth)
+Result<std::vector<UInt8>> BufferReader::ReadBuffer(const Buffer& _buffer, const UInt32 _offset, const UInt32 _byteWidth)
+{
+    JAM_ASSERT(_offset + _byteWidth <= _buffer.GetByteWidth(), "BufferReader::ReadBuffer - Region exceeds buffer size.");
+    return ReadBuffer_(_buffer.Get(), _offset, _byteWidth);
+}
+
+Result<std::vector<UInt8>> BufferReader::ReadBuffer_(ID3D11Buffer* _pBuffer, const UInt32 _offset, const UInt32 _byteWidth)
 {
     JAM_ASSERT(_pBuffer != nullptr, "BufferReader::ReadBuffer_ - Invalid buffer pointer.");
 
     // reallocate
-    if (m_stagingBuffer.GetByteWidth() < _bufferByteWidth)
+    if (m_stagingBuffer.GetByteWidth() < _byteWidth)
     {
-        m_stagingBuffer.Initialize(_bufferByteWidth);
+        m_stagingBuffer.Initialize(_byteWidth);
     }
 
-    ID3D11DeviceContext* ctx = Renderer::GetDeviceContext();
-    ctx->CopySubresourceRegion(m_stagingBuffer.Get(), 0, 0, 0, 0, _pBuffer, 0, nullptr);
-    return m_stagingBuffer.ReadData();
+    const D3D11_BOX      srcBox = { _offset, 0, 0, _offset + _byteWidth, 1, 1 };
+    ID3D11DeviceContext* ctx    = Renderer::GetDeviceContext();
+    ctx->CopySubresourceRegion(m_stagingBuffer.Get(), 0, 0, 0, 0, _pBuffer, 0, &srcBox);
+
+    // 스테이징 버퍼가 더 클 수 있으므로 요청한 크기만 남김
+    auto [data, bResult] = m_stagingBuffer.ReadData();
+    if (!bResult)
+    {
+        return Fail;
+    }
+    data.resize(_byteWidth);
+    return std::move(data);
 }
 
 }
\ No newline at end of file
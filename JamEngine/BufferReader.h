@@ -10,9 +10,10 @@ public:
     void      ReserveBuffer(UInt32 _byteWidth);
     NODISCARD Result<std::vector<UInt8>> ReadBuffer(ID3D11Buffer* _pBuffer);
     NODISCARD Result<std::vector<UInt8>> ReadBuffer(const Buffer& _buffer);
+    NODISCARD Result<std::vector<UInt8>> ReadBuffer(const Buffer& _buffer, UInt32 _offset, UInt32 _byteWidth);   // 일부 구간만 읽음
 
 private:
-    NODISCARD Result<std::vector<UInt8>> ReadBuffer_(ID3D11Buffer* _pBuffer, UInt32 _bufferByteWidth);
+    NODISCARD Result<std::vector<UInt8>> ReadBuffer_(ID3D11Buffer* _pBuffer, UInt32 _offset, UInt32 _byteWidth);
 
     StagingBuffer m_stagingBuffer;   // staging buffer for reading
 };
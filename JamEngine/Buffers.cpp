@@ -19,6 +19,19 @@ void Buffer::CopyFrom(const Buffer& _other) const
     ctx->CopyResource(Get(), _other.Get());
 }
 
+void Buffer::CopyRegionFrom(const Buffer& _other, const UInt32 _srcOffset, const UInt32 _byteWidth, const UInt32 _dstOffset) const
+{
+    JAM_ASSERT(_other.Get(), "Source buffer is null");
+    JAM_ASSERT(Get(), "Destination buffer is null");
+    JAM_ASSERT(_srcOffset + _byteWidth <= _other.m_byteWidth, "Source region exceeds buffer size");
+    JAM_ASSERT(_dstOffset + _byteWidth <= m_byteWidth, "Destination region exceeds buffer size");
+    JAM_ASSERT(m_access != eResourceAccess::Immutable, "Cannot copy to an immutable buffer");
+
+    const D3D11_BOX      srcBox = { _srcOffset, 0, 0, _srcOffset + _byteWidth, 1, 1 };
+    ID3D11DeviceContext* ctx    = Renderer::GetDeviceContext();
+    ctx->CopySubresourceRegion(Get(), 0, _dstOffset, 0, 0, _other.Get(), 0, &srcBox);
+}
+
 void Buffer::Upload(const UInt32 _dataByteWidth, const void* _pData, const UInt32 _offset) const
 {
     JAM_ASSERT(_pData, "Data pointer is null");
@@ -39,6 +52,17 @@ void Buffer::Upload(const UInt32 _dataByteWidth, const void* _pData, const UInt3
     }
 }
 
+void Buffer::UploadRegion(const UInt32 _dataByteWidth, const void* _pData, const UInt32 _offset) const
+{
+    JAM_ASSERT(_pData, "Data pointer is null");
+    JAM_ASSERT(_offset + _dataByteWidth <= m_byteWidth, "Data byte width exceeds buffer size");
+    JAM_ASSERT(m_access == eResourceAccess::GPUWriteable, "Buffer must be GPU writeable");
+
+    const D3D11_BOX      dstBox = { _offset, 0, 0, _offset + _dataByteWidth, 1, 1 };
+    ID3D11DeviceContext* ctx    = Renderer::GetDeviceContext();
+    ctx->UpdateSubresource(Get(), 0, &dstBox, _pData, 0, 0);
+}
+
 UInt32 Buffer::Reset()
 {
     UInt32 refCount = m_buffer.Reset();
@@ -78,23 +102,24 @@ void VertexBuffer::Bind() const
     Renderer::BindVertexBuffer(m_buffer.Get(), m_stride);
 }
 
-void IndexBuffer::Initialize(const UInt32 _indexCount, const eResourceAccess _access, const std::optional<IndexBufferInitData>& _initData)
+void IndexBuffer::Initialize(const UInt32 _indexCount, const eResourceAccess _access, const std::optional<IndexBufferInitData>& _initData, const eIndexFormat _format)
 {
+    m_format = _format;
     if (_initData)
     {
         BufferInitData initData;
         initData.pData = _initData->pData;
-        Initialize_(sizeof(Index) * _indexCount, D3D11_BIND_INDEX_BUFFER, _access, initData);
+        Initialize_(GetIndexStride(_format) * _indexCount, D3D11_BIND_INDEX_BUFFER, _access, initData);
     }
     else
     {
-        Initialize_(sizeof(Index) * _indexCount, D3D11_BIND_INDEX_BUFFER, _access, std::nullopt);
+        Initialize_(GetIndexStride(_format) * _indexCount, D3D11_BIND_INDEX_BUFFER, _access, std::nullopt);
     }
 }
 
 void IndexBuffer::Bind() const
 {
-    Renderer::BindIndexBuffer(m_buffer.Get());
+    Renderer::BindIndexBuffer(m_buffer.Get(), static_cast<DXGI_FORMAT>(m_format));
 }
 
 void ConstantBuffer::Initialize(const UInt32 _byteWidth, const std::optional<BufferInitData>& _initData)
@@ -10,7 +10,9 @@ class Buffer
 public:
     // utility
     void CopyFrom(const Buffer& _other) const;
+    void CopyRegionFrom(const Buffer& _other, UInt32 _srcOffset, UInt32 _byteWidth, UInt32 _dstOffset) const;
     void Upload(UInt32 _dataByteWidth, const void* _pData, UInt32 _offset = 0) const;
+    void UploadRegion(UInt32 _dataByteWidth, const void* _pData, UInt32 _offset) const;   // GPUWriteable 버퍼의 일부만 갱신
 
     // getters
     NODISCARD ID3D11Buffer* const* GetAddressOf() const { return m_buffer.GetAddressOf(); }
@@ -53,18 +55,34 @@ private:
     UInt32 m_stride = 0;   // vertex stride in bytes, used for binding
 };
 
-// index buffer wrapper - 32-bit index (fixed)
+NODISCARD constexpr UInt32 GetIndexStride(const eIndexFormat _format)
+{
+    return _format == eIndexFormat::UInt16 ? sizeof(UInt16) : sizeof(UInt32);
+}
+
+// 정점 수로 표현 가능한 가장 좁은 인덱스 포맷
+NODISCARD constexpr eIndexFormat SelectIndexFormat(const size_t _vertexCount)
+{
+    return _vertexCount <= std::numeric_limits<UInt16>::max() + 1ull ? eIndexFormat::UInt16 : eIndexFormat::UInt32;
+}
+
+// index buffer wrapper - 16-bit or 32-bit index
 class IndexBuffer : public Buffer
 {
 public:
     void Initialize(UInt32                                    _indexCount,
                     eResourceAccess                           _access,
-                    const std::optional<IndexBufferInitData>& _initData = std::nullopt);
+                    const std::optional<IndexBufferInitData>& _initData = std::nullopt,
+                    eIndexFormat                              _format   = eIndexFormat::UInt32);
 
     void Bind() const;
 
-    NODISCARD constexpr UInt32 GetStride() const { return sizeof(UInt32); }
-    NODISCARD UInt32           GetIndexCount() const { return m_byteWidth / GetStride(); }
+    NODISCARD eIndexFormat GetIndexFormat() const { return m_format; }
+    NODISCARD UInt32       GetStride() const { return GetIndexStride(m_format); }
+    NODISCARD UInt32       GetIndexCount() const { return m_byteWidth / GetStride(); }
+
+private:
+    eIndexFormat m_format = eIndexFormat::UInt32;
 };
 
 // constant buffer wrapper - dynamic buffer
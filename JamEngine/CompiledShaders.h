@@ -1,5 +1,5 @@
 // Auto-generated shader header file
-// Compiled shaders count: 37
+// Compiled shaders count: 41
 
 #pragma once
 
@@ -30,6 +30,12 @@ extern const size_t        k_pbrLightingPSSize;
 extern const unsigned char k_pbrVS[];
 extern const size_t        k_pbrVSSize;
 
+extern const unsigned char k_pbrCompactVS[];
+extern const size_t        k_pbrCompactVSSize;
+
+extern const unsigned char k_pbrQuantizedVS[];
+extern const size_t        k_pbrQuantizedVSSize;
+
 extern const unsigned char k_samplingPS[];
 extern const size_t        k_samplingPSSize;
 
@@ -42,6 +48,12 @@ extern const size_t        k_shadowMappingCasterShaderVSSize;
 extern const unsigned char k_omniDirectionalAndCascadeShadowMappingCasterShaderVS[];
 extern const size_t        k_omniDirectionalAndCascadeShadowMappingCasterShaderVSSize;
 
+extern const unsigned char k_shadowMappingCasterShaderQuantizedVS[];
+extern const size_t        k_shadowMappingCasterShaderQuantizedVSSize;
+
+extern const unsigned char k_omniDirectionalAndCascadeShadowMappingCasterShaderQuantizedVS[];
+extern const size_t        k_omniDirectionalAndCascadeShadowMappingCasterShaderQuantizedVSSize;
+
 extern const unsigned char k_omniDirectionalShaderMappingCasterShaderGS[];
 extern const size_t        k_omniDirectionalShaderMappingCasterShaderGSSize;
 
@@ -113,6 +113,7 @@ struct ModelComponent : ISerializableComponent<ModelComponent>, IEditableCompone
     void           DrawEditor(EditorLayer* _pEditorLayer, Scene* _pScene, const Entity& _ownerEntity);
 
     Ref<ModelAsset> modelAsset;
+    UInt32          lodLevel = 0;   // LodSelector 가 매 프레임 갱신 (직렬화하지 않음)
 };
 
 }   // namespace jam
\ No newline at end of file
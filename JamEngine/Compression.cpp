@@ -0,0 +1,108 @@
+#include "pch.h"
+
+#include "Compression.h"
+
+#include "GeometryCodec.h"
+
+#include <array>
+#include <lz4.h>
+
+namespace
+{
+
+using namespace jam;
+
+class NoneCodec final : public ICompressionCodec
+{
+public:
+    NODISCARD eCompressionCodec GetType() const override { return eCompressionCodec::None; }
+    NODISCARD size_t            GetMaxCompressedSize(const size_t _rawByteWidth) const override { return _rawByteWidth; }
+
+    NODISCARD Result<size_t> Compress(const std::span<const UInt8> _src, const std::span<UInt8> _dst, MAYBE_UNUSED const CompressionStreamDesc& _desc) const override
+    {
+        JAM_ASSERT(_dst.size() >= _src.size(), "NoneCodec::Compress() - Destination is too small");
+        std::memcpy(_dst.data(), _src.data(), _src.size());
+        return _src.size();
+    }
+
+    bool Decompress(const std::span<const UInt8> _src, const std::span<UInt8> _dst) const override
+    {
+        if (_src.size() != _dst.size())
+        {
+            return false;
+        }
+        std::memcpy(_dst.data(), _src.data(), _src.size());
+        return true;
+    }
+};
+
+class LZ4Codec final : public ICompressionCodec
+{
+public:
+    NODISCARD eCompressionCodec GetType() const override { return eCompressionCodec::LZ4; }
+    NODISCARD size_t            GetMaxCompressedSize(const size_t _rawByteWidth) const override { return static_cast<size_t>(LZ4_compressBound(static_cast<int>(_rawByteWidth))); }
+    NODISCARD size_t            GetMaxRawByteWidth() const override { return LZ4_MAX_INPUT_SIZE; }   // LZ4 는 int 크기를 사용
+
+    NODISCARD Result<size_t> Compress(const std::span<const UInt8> _src, const std::span<UInt8> _dst, MAYBE_UNUSED const CompressionStreamDesc& _desc) const override
+    {
+        const int size = LZ4_compress_default(reinterpret_cast<const char*>(_src.data()),
+                                              reinterpret_cast<char*>(_dst.data()),
+                                              static_cast<int>(_src.size()),
+                                              static_cast<int>(_dst.size()));
+        if (size <= 0)
+        {
+            return Fail;
+        }
+        return static_cast<size_t>(size);
+    }
+
+    bool Decompress(const std::span<const UInt8> _src, const std::span<UInt8> _dst) const override
+    {
+        // safe 버전 - 손상된 입력에도 _dst 범위를 벗어나지 않음
+        const int size = LZ4_decompress_safe(reinterpret_cast<const char*>(_src.data()),
+                                             reinterpret_cast<char*>(_dst.data()),
+                                             static_cast<int>(_src.size()),
+                                             static_cast<int>(_dst.size()));
+        return size >= 0 && static_cast<size_t>(size) == _dst.size();
+    }
+};
+
+using CodecRegistry = std::array<Scope<ICompressionCodec>, EnumCount<eCompressionCodec>()>;
+
+NODISCARD CodecRegistry& GetCodecRegistry()
+{
+    static CodecRegistry s_registry = []
+    {
+        CodecRegistry registry;
+        registry[EnumToInt(eCompressionCodec::None)]     = MakeScope<NoneCodec>();
+        registry[EnumToInt(eCompressionCodec::LZ4)]      = MakeScope<LZ4Codec>();
+        registry[EnumToInt(eCompressionCodec::Geometry)] = CreateGeometryCodec();
+        return registry;
+    }();
+    return s_registry;
+}
+
+}   // namespace
+
+namespace jam
+{
+
+const ICompressionCodec* GetCompressionCodec(const eCompressionCodec _codec)
+{
+    if (!IsValidEnum(_codec))
+    {
+        JAM_ERROR("GetCompressionCodec() - Invalid codec: {}", EnumToInt(_codec));
+        return nullptr;
+    }
+    return GetCodecRegistry()[EnumToInt(_codec)].get();
+}
+
+void RegisterCompressionCodec(Scope<ICompressionCodec>&& _pCodec)
+{
+    JAM_ASSERT(_pCodec, "RegisterCompressionCodec() - Codec is null");
+    const eCompressionCodec codec = _pCodec->GetType();
+    JAM_ASSERT(IsValidEnum(codec), "RegisterCompressionCodec() - Invalid codec type");
+    GetCodecRegistry()[EnumToInt(codec)] = std::move(_pCodec);   // 로드 중에 교체하면 안됨
+}
+
+}   // namespace jam
\ No newline at end of file
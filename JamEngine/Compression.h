@@ -0,0 +1,49 @@
+#pragma once
+
+namespace jam
+{
+
+enum class eCompressionCodec : UInt8
+{
+    None = 0,   // 무압축 (복사)
+    LZ4,        // 빠른 LZ 계열 코덱
+    Geometry,   // 정점 / 인덱스 필터 + LZ4 (GeometryCodec.h)
+};
+
+enum class eCompressionStream : UInt8
+{
+    Raw = 0,   // 구조를 알 수 없는 바이트
+    Vertex,    // elementByteWidth = 정점 stride
+    Index,     // elementByteWidth = 인덱스 크기 (2, 4), 삼각형 리스트에서 가장 효율적
+};
+
+// 압축할 스트림의 구조. 구조를 사용하지 않는 코덱은 무시함
+struct CompressionStreamDesc
+{
+    eCompressionStream stream           = eCompressionStream::Raw;
+    UInt32             elementByteWidth = 1;
+};
+
+// 압축 코덱 인터페이스
+// 구현은 상태를 갖지 않아야 하며 여러 스레드에서 동시에 호출될 수 있음
+class ICompressionCodec
+{
+public:
+    virtual ~ICompressionCodec() = default;
+
+    NODISCARD virtual eCompressionCodec GetType() const                                 = 0;
+    NODISCARD virtual size_t            GetMaxCompressedSize(size_t _rawByteWidth) const = 0;
+    NODISCARD virtual size_t            GetMaxRawByteWidth() const { return std::numeric_limits<size_t>::max(); }   // 한 번에 압축할 수 있는 최대 크기
+
+    // 압축된 크기를 반환. _dst 는 GetMaxCompressedSize() 이상이어야 함
+    NODISCARD virtual Result<size_t> Compress(std::span<const UInt8> _src, std::span<UInt8> _dst, const CompressionStreamDesc& _desc) const = 0;
+
+    // _dst 의 크기는 원본 크기와 정확히 같아야 함
+    virtual bool Decompress(std::span<const UInt8> _src, std::span<UInt8> _dst) const = 0;
+};
+
+// 코덱 레지스트리. 기본으로 None, LZ4, Geometry 가 등록되어 있으며 다른 구현으로 교체할 수 있음
+NODISCARD const ICompressionCodec* GetCompressionCodec(eCompressionCodec _codec);
+void                               RegisterCompressionCodec(Scope<ICompressionCodec>&& _pCodec);
+
+}   // namespace jam
\ No newline at end of file
@@ -27,5 +27,6 @@ constexpr std::wstring_view k_jamScenesDirectory   = L"scenes";
 constexpr std::wstring_view k_jamAssetsDirectory   = L"assets";
 constexpr std::wstring_view k_jamModelDirectory    = L"models";
 constexpr std::wstring_view k_jamTextureDirectory  = L"textures";
+constexpr std::wstring_view k_jamDerivedDirectory  = L"derived";   // 임포트 캐시 등 재생성 가능한 데이터
 
 }   // namespace jam
\ No newline at end of file
@@ -0,0 +1,308 @@
+#include "pch.h"
+
+#include "FileIOService.h"
+
+#include "ThreadPool.h"
+#include "WindowsUtilities.h"
+
+#include <future>
+
+namespace
+{
+
+using namespace jam;
+
+constexpr UInt32    k_maxReadByteWidth = 1u << 30;   // ReadFile 한 번에 요청하는 최대 크기 (DWORD)
+constexpr ULONG_PTR k_shutdownKey      = 1;          // 완료 스레드 종료 패킷
+
+}   // namespace
+
+namespace jam
+{
+
+// 읽기 요청 하나. 완료 포트에 등록된 동안에는 완료 스레드가 소유함
+struct FileIOService::Operation
+{
+    OVERLAPPED   overlapped = {};   // 완료 포트가 돌려주는 포인터 (CONTAINING_RECORD 로 요청을 찾음)
+    fs::path     path;
+    UInt64       offset        = 0;
+    UInt64       byteWidth     = 0;   // Start_ 에서 k_wholeFile 을 실제 크기로 바꿈
+    UInt64       readByteWidth = 0;   // 지금까지 읽은 크기
+    HANDLE       hFile         = INVALID_HANDLE_VALUE;
+    Ref<UInt8[]> pBuffer;
+    ReadCallback callback;
+};
+
+FileIOService::FileIOService(const UInt32 _queueDepth)
+    : m_queueDepth(std::max(_queueDepth, 1u))
+{
+    m_hCompletionPort = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+    if (!m_hCompletionPort)
+    {
+        JAM_ERROR("FileIOService - Failed to create I/O completion port, falling back to blocking reads on the thread pool ({})", GetSystemLastErrorMessage());
+        return;
+    }
+    m_completionThread = std::thread(&FileIOService::CompletionLoop_, this);
+}
+
+FileIOService::~FileIOService()
+{
+    WaitIdle();
+    if (m_hCompletionPort)
+    {
+        PostQueuedCompletionStatus(m_hCompletionPort, 0, k_shutdownKey, nullptr);
+        m_completionThread.join();
+        CloseHandle(m_hCompletionPort);
+    }
+}
+
+void FileIOService::Read(const fs::path& _path, ReadCallback _callback, const UInt64 _offset, const UInt64 _byteWidth)
+{
+    JAM_ASSERT(_callback, "FileIOService::Read() - Callback cannot be null");
+
+    Scope<Operation> pOperation = MakeScope<Operation>();
+    pOperation->path            = _path;
+    pOperation->offset          = _offset;
+    pOperation->byteWidth       = _byteWidth;
+    pOperation->callback        = std::move(_callback);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queuedOperations.push_back(std::move(pOperation));
+        ++m_pendingCount;
+    }
+    Pump_();
+}
+
+Result<AssetFile> FileIOService::ReadAndWait(const fs::path& _path, const UInt64 _offset, const UInt64 _byteWidth)
+{
+    // 콜백이 set_value 를 끝내기 전에 대기가 풀릴 수 있으므로 promise 는 공유 포인터로 관리
+    auto                           pPromise = MakeRef<std::promise<Result<AssetFile>>>();
+    std::future<Result<AssetFile>> future   = pPromise->get_future();
+    Read(
+        _path,
+        [pPromise](Result<AssetFile> _result)
+        {
+            pPromise->set_value(std::move(_result));
+        },
+        _offset,
+        _byteWidth);
+    return future.get();
+}
+
+void FileIOService::WaitIdle()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idleCondition.wait(lock,
+                         [this]
+                         {
+                             return m_pendingCount == 0;
+                         });
+}
+
+FileIOService& FileIOService::GetGlobal()
+{
+    static FileIOService s_globalService;
+    return s_globalService;
+}
+
+void FileIOService::Pump_()
+{
+    // 열기에 실패한 요청은 바로 끝나므로 큐 깊이가 찰 때까지 반복
+    while (true)
+    {
+        Scope<Operation> pOperation;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_queuedOperations.empty() || m_inFlightCount >= m_queueDepth)
+            {
+                return;
+            }
+            pOperation = std::move(m_queuedOperations.front());
+            m_queuedOperations.pop_front();
+            ++m_inFlightCount;
+        }
+
+        if (!m_hCompletionPort)   // 완료 포트가 없다면 워커 스레드에서 동기로 읽음 (큐 깊이는 그대로 적용)
+        {
+            ThreadPool::GetGlobal().Submit(
+                [this, pOperation = std::move(pOperation)]() mutable
+                {
+                    const bool bResult = ReadBlocking_(*pOperation);
+                    Finish_(std::move(pOperation), bResult);
+                    Pump_();
+                });
+        }
+        else if (Start_(*pOperation))
+        {
+            static_cast<void>(pOperation.release());   // 완료 패킷이 올 때까지 완료 포트가 소유
+        }
+        else
+        {
+            Finish_(std::move(pOperation), false);
+        }
+    }
+}
+
+bool FileIOService::Open_(Operation& _operation, const DWORD _flags)
+{
+    // 파일 열기
+    _operation.hFile = CreateFileW(_operation.path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN | _flags, nullptr);
+    if (_operation.hFile == INVALID_HANDLE_VALUE)
+    {
+        JAM_ERROR("FileIOService::Read() - Failed to open file: {} ({})", _operation.path.string(), GetSystemLastErrorMessage());
+        return false;
+    }
+
+    // 읽을 구간
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(_operation.hFile, &fileSize))
+    {
+        JAM_ERROR("FileIOService::Read() - Failed to get file size: {} ({})", _operation.path.string(), GetSystemLastErrorMessage());
+        return false;
+    }
+
+    const UInt64 fileByteWidth = static_cast<UInt64>(fileSize.QuadPart);
+    if (_operation.offset > fileByteWidth || (_operation.byteWidth != k_wholeFile && _operation.byteWidth > fileByteWidth - _operation.offset))
+    {
+        JAM_ERROR("FileIOService::Read() - Read range exceeds file size: {}", _operation.path.string());
+        return false;
+    }
+    if (_operation.byteWidth == k_wholeFile)
+    {
+        _operation.byteWidth = fileByteWidth - _operation.offset;
+    }
+
+    _operation.pBuffer = Ref<UInt8[]>(new UInt8[static_cast<size_t>(_operation.byteWidth)]);
+    return true;
+}
+
+bool FileIOService::Start_(Operation& _operation)
+{
+    if (!Open_(_operation, FILE_FLAG_OVERLAPPED))
+    {
+        return false;
+    }
+
+    // 완료 포트에 연결 (완료 패킷의 OVERLAPPED 포인터로 요청을 찾음)
+    if (!CreateIoCompletionPort(_operation.hFile, m_hCompletionPort, 0, 0))
+    {
+        JAM_ERROR("FileIOService::Read() - Failed to associate file with completion port: {} ({})", _operation.path.string(), GetSystemLastErrorMessage());
+        return false;
+    }
+
+    if (_operation.byteWidth == 0)   // 읽을 것이 없음 - 완료 패킷만 보냄
+    {
+        return PostQueuedCompletionStatus(m_hCompletionPort, 0, 0, &_operation.overlapped) != FALSE;
+    }
+    return IssueRead_(_operation);
+}
+
+bool FileIOService::IssueRead_(Operation& _operation)
+{
+    const UInt64 offset    = _operation.offset + _operation.readByteWidth;
+    const DWORD  byteWidth = static_cast<DWORD>(std::min<UInt64>(_operation.byteWidth - _operation.readByteWidth, k_maxReadByteWidth));
+
+    // 동기적으로 끝나더라도 완료 패킷은 전송됨
+    _operation.overlapped            = {};
+    _operation.overlapped.Offset     = static_cast<DWORD>(offset);
+    _operation.overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+    if (!ReadFile(_operation.hFile, _operation.pBuffer.get() + _operation.readByteWidth, byteWidth, nullptr, &_operation.overlapped) && GetLastError() != ERROR_IO_PENDING)
+    {
+        JAM_ERROR("FileIOService::Read() - Failed to read file: {} ({})", _operation.path.string(), GetSystemLastErrorMessage());
+        return false;
+    }
+    return true;
+}
+
+bool FileIOService::ReadBlocking_(Operation& _operation)
+{
+    if (!Open_(_operation, 0))
+    {
+        return false;
+    }
+
+    // 동기 핸들도 OVERLAPPED 로 오프셋을 지정할 수 있음 (호출이 끝나면 읽기도 끝남)
+    while (_operation.readByteWidth < _operation.byteWidth)
+    {
+        const UInt64 offset        = _operation.offset + _operation.readByteWidth;
+        const DWORD  byteWidth     = static_cast<DWORD>(std::min<UInt64>(_operation.byteWidth - _operation.readByteWidth, k_maxReadByteWidth));
+        DWORD        readByteWidth = 0;
+
+        _operation.overlapped            = {};
+        _operation.overlapped.Offset     = static_cast<DWORD>(offset);
+        _operation.overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+        if (!ReadFile(_operation.hFile, _operation.pBuffer.get() + _operation.readByteWidth, byteWidth, &readByteWidth, &_operation.overlapped) || readByteWidth == 0)
+        {
+            JAM_ERROR("FileIOService::Read() - Failed to read file: {} ({})", _operation.path.string(), GetSystemLastErrorMessage());
+            return false;
+        }
+        _operation.readByteWidth += readByteWidth;
+    }
+    return true;
+}
+
+void FileIOService::Finish_(Scope<Operation>&& _pOperation, const bool _bResult)
+{
+    if (_pOperation->hFile != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(_pOperation->hFile);
+        _pOperation->hFile = INVALID_HANDLE_VALUE;
+    }
+
+    if (_bResult)
+    {
+        const std::span<const UInt8> data(_pOperation->pBuffer.get(), static_cast<size_t>(_pOperation->byteWidth));
+        _pOperation->callback(AssetFile(data, std::move(_pOperation->pBuffer)));
+    }
+    else
+    {
+        _pOperation->callback(Fail);
+    }
+    _pOperation.reset();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        --m_inFlightCount;
+        --m_pendingCount;
+    }
+    m_idleCondition.notify_all();
+}
+
+void FileIOService::CompletionLoop_()
+{
+    while (true)
+    {
+        DWORD       byteWidth   = 0;
+        ULONG_PTR   key         = 0;
+        OVERLAPPED* pOverlapped = nullptr;
+        const BOOL  bResult     = GetQueuedCompletionStatus(m_hCompletionPort, &byteWidth, &key, &pOverlapped, INFINITE);
+        if (pOverlapped == nullptr)
+        {
+            if (key == k_shutdownKey)
+            {
+                return;
+            }
+            continue;
+        }
+
+        Scope<Operation> pOperation(CONTAINING_RECORD(pOverlapped, Operation, overlapped));   // Operation 은 표준 레이아웃이 아니므로 멤버 위치로 역산
+        if (!bResult)
+        {
+            JAM_ERROR("FileIOService::Read() - Failed to read file: {} ({})", pOperation->path.string(), GetSystemLastErrorMessage());
+        }
+
+        // 큰 구간은 나누어 읽음 (0 바이트 완료는 파일이 도중에 줄어든 경우)
+        pOperation->readByteWidth += byteWidth;
+        if (bResult && byteWidth > 0 && pOperation->readByteWidth < pOperation->byteWidth && IssueRead_(*pOperation))
+        {
+            static_cast<void>(pOperation.release());
+            continue;
+        }
+
+        const bool bCompleted = bResult && pOperation->readByteWidth == pOperation->byteWidth;
+        Finish_(std::move(pOperation), bCompleted);
+        Pump_();   // 끝난 자리만큼 대기 중인 요청을 시작
+    }
+}
+
+}   // namespace jam
\ No newline at end of file
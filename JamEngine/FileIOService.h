@@ -0,0 +1,66 @@
+#pragma once
+#include "AssetFile.h"
+
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+namespace jam
+{
+
+// 비동기 파일 읽기 서비스
+// 요청은 큐에 쌓이고 최대 큐 깊이만큼 동시에 진행됨 (Win32 overlapped I/O + 완료 포트)
+// 읽는 동안 스레드를 점유하지 않으므로 작은 파일을 많이 읽을 때 디스크 큐를 채워 처리량을 높임
+// 완료 포트를 만들 수 없다면 ThreadPool 워커에서 동기로 읽음 (같은 큐 깊이, 같은 콜백 규칙)
+// 엔진 전역에서 공유하는 서비스는 GetGlobal() 로 접근합니다. (첫 호출 시 생성)
+class FileIOService
+{
+public:
+    // 읽기 결과. 실패했다면 Fail
+    // 완료 스레드에서 호출되므로 (열기에 실패했다면 요청한 스레드) 디코딩 같은 무거운 작업은 ThreadPool 로 넘겨야 함
+    using ReadCallback = std::function<void(Result<AssetFile>)>;
+
+    constexpr static UInt64 k_wholeFile         = std::numeric_limits<UInt64>::max();
+    constexpr static UInt32 k_defaultQueueDepth = 64;
+
+    explicit FileIOService(UInt32 _queueDepth = k_defaultQueueDepth);
+    ~FileIOService();   // 진행 중인 읽기가 모두 끝날 때까지 대기
+
+    FileIOService(const FileIOService&)                = delete;
+    FileIOService& operator=(const FileIOService&)     = delete;
+    FileIOService(FileIOService&&) noexcept            = delete;
+    FileIOService& operator=(FileIOService&&) noexcept = delete;
+
+    // 파일의 [_offset, _offset + _byteWidth) 구간을 읽음 (k_wholeFile 이라면 끝까지). 해당 함수는 thread-safe 합니다
+    void Read(const fs::path& _path, ReadCallback _callback, UInt64 _offset = 0, UInt64 _byteWidth = k_wholeFile);
+
+    // 읽기를 요청하고 끝날 때까지 대기 (완료 스레드나 완료 콜백 안에서 호출하면 안됨)
+    NODISCARD Result<AssetFile> ReadAndWait(const fs::path& _path, UInt64 _offset = 0, UInt64 _byteWidth = k_wholeFile);
+
+    void             WaitIdle();   // 요청한 모든 읽기가 끝날 때까지 대기
+    NODISCARD UInt32 GetQueueDepth() const { return m_queueDepth; }
+
+    NODISCARD static FileIOService& GetGlobal();
+
+private:
+    struct Operation;
+
+    void Pump_();                                                  // 큐 깊이까지 대기 중인 요청을 시작
+    bool Open_(Operation& _operation, DWORD _flags);               // 파일을 열고 구간 검사, 버퍼 할당
+    bool Start_(Operation& _operation);                            // 파일을 열고 첫 읽기를 요청
+    bool IssueRead_(Operation& _operation);                        // 남은 구간의 다음 읽기를 요청
+    bool ReadBlocking_(Operation& _operation);                     // 완료 포트가 없을 때 워커 스레드에서 전체 구간을 읽음
+    void Finish_(Scope<Operation>&& _pOperation, bool _bResult);   // 콜백 호출, 진행 수 감소
+    void CompletionLoop_();
+
+    HANDLE                       m_hCompletionPort = nullptr;   // nullptr 이라면 ThreadPool 로 대체
+    std::thread                  m_completionThread;
+    UInt32                       m_queueDepth;
+    std::deque<Scope<Operation>> m_queuedOperations;
+    UInt32                       m_inFlightCount = 0;   // 완료 포트에 등록되었거나 워커에서 읽는 중인 요청 수
+    UInt32                       m_pendingCount  = 0;   // 끝나지 않은 모든 요청 수
+    std::mutex                   m_mutex;
+    std::condition_variable      m_idleCondition;
+};
+
+}   // namespace jam
\ No newline at end of file
@@ -0,0 +1,215 @@
+#pragma once
+#include "AssetID.h"
+
+namespace jam
+{
+
+// AssetID 를 키로 하는 open addressing 해시 맵 (선형 탐사, backward shift 삭제)
+// 키가 이미 해시이므로 하위 비트를 그대로 버킷으로 사용하며 빈 슬롯은 유효하지 않은 ID 로 표시함
+// std::unordered_map 과 같은 이름의 인터페이스를 제공하지만 새 키의 삽입과 삭제는 모든 반복자와 참조를 무효화함
+template<typename T>
+class FlatIDMap
+{
+public:
+    using value_type = std::pair<AssetID, T>;
+
+    template<bool bConst>
+    class Iterator
+    {
+    public:
+        using iterator_concept  = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::pair<AssetID, T>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<bConst, const value_type*, value_type*>;
+        using reference         = std::conditional_t<bConst, const value_type&, value_type&>;
+
+        Iterator() = default;
+        Iterator(const pointer _pSlot, const pointer _pEnd)
+            : m_pSlot(_pSlot)
+            , m_pEnd(_pEnd)
+        {
+            SkipEmpty_();
+        }
+
+        operator Iterator<true>() const
+            requires(!bConst)
+        {
+            return Iterator<true>(m_pSlot, m_pEnd);
+        }
+
+        NODISCARD reference operator*() const { return *m_pSlot; }
+        NODISCARD pointer   operator->() const { return m_pSlot; }
+
+        Iterator& operator++()
+        {
+            ++m_pSlot;
+            SkipEmpty_();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator prev = *this;
+            ++*this;
+            return prev;
+        }
+
+        NODISCARD bool operator==(const Iterator& _other) const { return m_pSlot == _other.m_pSlot; }
+
+    private:
+        void SkipEmpty_()
+        {
+            while (m_pSlot != m_pEnd && !m_pSlot->first.IsValid())
+            {
+                ++m_pSlot;
+            }
+        }
+
+        pointer m_pSlot = nullptr;
+        pointer m_pEnd  = nullptr;
+    };
+
+    using iterator       = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    NODISCARD iterator       begin() { return iterator(m_slots.data(), m_slots.data() + m_slots.size()); }
+    NODISCARD iterator       end() { return iterator(m_slots.data() + m_slots.size(), m_slots.data() + m_slots.size()); }
+    NODISCARD const_iterator begin() const { return const_iterator(m_slots.data(), m_slots.data() + m_slots.size()); }
+    NODISCARD const_iterator end() const { return const_iterator(m_slots.data() + m_slots.size(), m_slots.data() + m_slots.size()); }
+
+    NODISCARD size_t size() const { return m_size; }
+    NODISCARD bool   empty() const { return m_size == 0; }
+
+    NODISCARD iterator find(const AssetID _id)
+    {
+        const size_t index = FindIndex_(_id);
+        return index != k_npos ? iterator(m_slots.data() + index, m_slots.data() + m_slots.size()) : end();
+    }
+
+    NODISCARD const_iterator find(const AssetID _id) const
+    {
+        const size_t index = FindIndex_(_id);
+        return index != k_npos ? const_iterator(m_slots.data() + index, m_slots.data() + m_slots.size()) : end();
+    }
+
+    NODISCARD bool contains(const AssetID _id) const { return FindIndex_(_id) != k_npos; }
+
+    // 없다면 기본값으로 삽입 (이미 있는 키라면 반복자와 참조가 유지됨)
+    T& operator[](const AssetID _id)
+    {
+        JAM_ASSERT(_id.IsValid(), "FlatIDMap - Invalid asset id");
+        if (const size_t index = FindIndex_(_id); index != k_npos)
+        {
+            return m_slots[index].second;
+        }
+
+        if ((m_size + 1) * k_maxLoadDenominator > m_slots.size() * k_maxLoadNumerator)
+        {
+            Rehash_(std::max(m_slots.size() * 2, k_minCapacity));
+        }
+
+        const size_t mask  = m_slots.size() - 1;
+        size_t       index = GetBucket_(_id);
+        while (m_slots[index].first.IsValid())
+        {
+            index = (index + 1) & mask;
+        }
+        m_slots[index].first = _id;
+        ++m_size;
+        return m_slots[index].second;
+    }
+
+    // 뒤따르는 슬롯을 당겨 빈 슬롯을 메우므로 묘비 (tombstone) 가 남지 않음
+    size_t erase(const AssetID _id)
+    {
+        size_t hole = FindIndex_(_id);
+        if (hole == k_npos)
+        {
+            return 0;
+        }
+
+        const size_t mask = m_slots.size() - 1;
+        for (size_t next = (hole + 1) & mask; m_slots[next].first.IsValid(); next = (next + 1) & mask)
+        {
+            // next 의 원래 버킷이 (hole, next] 밖에 있다면 hole 로 당길 수 있음
+            const size_t home = GetBucket_(m_slots[next].first);
+            if (((next - home) & mask) >= ((next - hole) & mask))
+            {
+                m_slots[hole] = std::move(m_slots[next]);
+                hole          = next;
+            }
+        }
+        m_slots[hole] = value_type();
+        --m_size;
+        return 1;
+    }
+
+    void clear()
+    {
+        std::ranges::fill(m_slots, value_type());
+        m_size = 0;
+    }
+
+    void reserve(const size_t _count)
+    {
+        size_t capacity = std::max(m_slots.size(), k_minCapacity);
+        while (_count * k_maxLoadDenominator > capacity * k_maxLoadNumerator)
+        {
+            capacity *= 2;
+        }
+        if (capacity != m_slots.size())
+        {
+            Rehash_(capacity);
+        }
+    }
+
+private:
+    static constexpr size_t k_npos               = std::numeric_limits<size_t>::max();
+    static constexpr size_t k_minCapacity        = 16;
+    static constexpr size_t k_maxLoadNumerator   = 3;   // 최대 부하율 3/4
+    static constexpr size_t k_maxLoadDenominator = 4;
+
+    NODISCARD size_t GetBucket_(const AssetID _id) const { return static_cast<size_t>(_id.value) & (m_slots.size() - 1); }
+
+    NODISCARD size_t FindIndex_(const AssetID _id) const
+    {
+        if (m_slots.empty() || !_id.IsValid())
+        {
+            return k_npos;
+        }
+
+        const size_t mask = m_slots.size() - 1;
+        for (size_t index = GetBucket_(_id); m_slots[index].first.IsValid(); index = (index + 1) & mask)
+        {
+            if (m_slots[index].first == _id)
+            {
+                return index;
+            }
+        }
+        return k_npos;
+    }
+
+    void Rehash_(const size_t _capacity)
+    {
+        std::vector<value_type> prevSlots = std::exchange(m_slots, std::vector<value_type>(_capacity));
+        const size_t            mask      = _capacity - 1;
+        for (value_type& slot: prevSlots)
+        {
+            if (slot.first.IsValid())
+            {
+                size_t index = GetBucket_(slot.first);
+                while (m_slots[index].first.IsValid())
+                {
+                    index = (index + 1) & mask;
+                }
+                m_slots[index] = std::move(slot);
+            }
+        }
+    }
+
+    std::vector<value_type> m_slots;   // 크기는 0 이거나 2 의 거듭제곱
+    size_t                  m_size = 0;
+};
+
+}   // namespace jam
\ No newline at end of file
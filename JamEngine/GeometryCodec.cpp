@@ -0,0 +1,536 @@
+#include "pch.h"
+
+#include "GeometryCodec.h"
+
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <lz4.h>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define JAM_GEOMETRY_CODEC_SIMD 1
+#include <immintrin.h>
+#else
+#define JAM_GEOMETRY_CODEC_SIMD 0
+#endif
+
+namespace
+{
+
+using namespace jam;
+
+constexpr size_t k_blockByteWidth  = 64 * 1024;   // 필터 / LZ4 단위 (L2 에 들어가는 크기)
+constexpr UInt32 k_maxTriangleCode = 9;           // 0: 정점 3개, 1 ~ 9: 이전 삼각형의 모서리 * 3 + 현재 삼각형의 모서리
+
+// 페이로드 레이아웃: GeometryStreamHeader, GeometryBlockHeader[blockCount], 블록 데이터
+struct GeometryStreamHeader
+{
+    UInt8  stream            = 0;   // eCompressionStream
+    UInt8  reserved          = 0;
+    UInt16 elementByteWidth  = 0;
+    UInt32 blockElementCount = 0;   // 블록당 원소 수 (인덱스는 3의 배수)
+};
+static_assert(sizeof(GeometryStreamHeader) == 8, "GeometryStreamHeader layout must be stable");
+
+struct GeometryBlockHeader
+{
+    UInt32 storedByteWidth   = 0;   // LZ4 로 압축된 크기
+    UInt32 filteredByteWidth = 0;   // LZ4 해제 후 (필터된) 크기
+};
+static_assert(sizeof(GeometryBlockHeader) == 8, "GeometryBlockHeader layout must be stable");
+
+NODISCARD bool IsValidElementByteWidth(const eCompressionStream _stream, const UInt32 _elementByteWidth)
+{
+    switch (_stream)
+    {
+        case eCompressionStream::Raw:
+            return _elementByteWidth == 1;
+        case eCompressionStream::Vertex:
+            return _elementByteWidth > 0 && _elementByteWidth <= std::numeric_limits<UInt16>::max();
+        case eCompressionStream::Index:
+            return _elementByteWidth == sizeof(UInt16) || _elementByteWidth == sizeof(UInt32);
+        default:
+            return false;
+    }
+}
+
+NODISCARD UInt32 GetBlockElementCount(const eCompressionStream _stream, const UInt32 _elementByteWidth)
+{
+    const UInt32 elementCount = std::max(static_cast<UInt32>(k_blockByteWidth / _elementByteWidth), 1u);
+    return _stream == eCompressionStream::Index ? elementCount / 3 * 3 : elementCount;
+}
+
+NODISCARD size_t GetTriangleCodeByteWidth(const size_t _indexCount)
+{
+    return (_indexCount / 3 + 1) / 2;   // 삼각형마다 4비트
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// 정점 필터: 바이트 평면 + 바이트 차분
+
+void FilterVertexBlock(const UInt8* _pVertices, const size_t _count, const UInt32 _stride, UInt8* _pOut)
+{
+    for (UInt32 plane = 0; plane < _stride; ++plane)
+    {
+        UInt8* pPlane = _pOut + plane * _count;
+        UInt8  prev   = 0;
+        for (size_t i = 0; i < _count; ++i)
+        {
+            const UInt8 value = _pVertices[i * _stride + plane];
+            pPlane[i]         = static_cast<UInt8>(value - prev);
+            prev              = value;
+        }
+    }
+}
+
+// 평면 하나의 [_begin, _count) 구간을 복원. _pVertices 는 평면의 바이트 위치가 적용된 포인터
+void UnfilterVertexPlane(const UInt8* _pPlane, const size_t _begin, const size_t _count, const UInt32 _stride, UInt8* _pVertices)
+{
+    UInt8 prev = _begin > 0 ? _pVertices[(_begin - 1) * _stride] : 0;
+    for (size_t i = _begin; i < _count; ++i)
+    {
+        prev                    = static_cast<UInt8>(prev + _pPlane[i]);
+        _pVertices[i * _stride] = prev;
+    }
+}
+
+#if JAM_GEOMETRY_CODEC_SIMD
+// 16 바이트 누적합. _carry 는 모든 바이트가 이전 블록의 마지막 누적값이며 이번 마지막 값으로 갱신됨
+NODISCARD __m128i PrefixSumBytes(__m128i _values, __m128i& _carry)
+{
+    _values = _mm_add_epi8(_values, _mm_slli_si128(_values, 1));
+    _values = _mm_add_epi8(_values, _mm_slli_si128(_values, 2));
+    _values = _mm_add_epi8(_values, _mm_slli_si128(_values, 4));
+    _values = _mm_add_epi8(_values, _mm_slli_si128(_values, 8));
+    _values = _mm_add_epi8(_values, _carry);
+
+    __m128i last = _mm_srli_si128(_values, 15);
+    last         = _mm_unpacklo_epi8(last, last);
+    last         = _mm_unpacklo_epi16(last, last);
+    _carry       = _mm_shuffle_epi32(last, 0);
+    return _values;
+}
+#endif
+
+// 평면 4개씩 정점 16개 단위로 누적합을 구한 뒤 4바이트 단위로 전치하여 기록
+void UnfilterVertexBlock(const UInt8* _pPlanes, const size_t _count, const UInt32 _stride, UInt8* _pVertices)
+{
+    UInt32 plane = 0;
+#if JAM_GEOMETRY_CODEC_SIMD
+    const size_t simdCount = _count & ~static_cast<size_t>(15);
+    for (; plane + 4 <= _stride; plane += 4)
+    {
+        const UInt8* pPlane     = _pPlanes + plane * _count;
+        __m128i      carries[4] = { _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128() };
+        for (size_t i = 0; i < simdCount; i += 16)
+        {
+            const __m128i bytes0 = PrefixSumBytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pPlane + i)), carries[0]);
+            const __m128i bytes1 = PrefixSumBytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pPlane + _count + i)), carries[1]);
+            const __m128i bytes2 = PrefixSumBytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pPlane + _count * 2 + i)), carries[2]);
+            const __m128i bytes3 = PrefixSumBytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pPlane + _count * 3 + i)), carries[3]);
+
+            const __m128i low01  = _mm_unpacklo_epi8(bytes0, bytes1);
+            const __m128i high01 = _mm_unpackhi_epi8(bytes0, bytes1);
+            const __m128i low23  = _mm_unpacklo_epi8(bytes2, bytes3);
+            const __m128i high23 = _mm_unpackhi_epi8(bytes2, bytes3);
+
+            __m128i quads[4] = { _mm_unpacklo_epi16(low01, low23), _mm_unpackhi_epi16(low01, low23), _mm_unpacklo_epi16(high01, high23), _mm_unpackhi_epi16(high01, high23) };
+
+            // 레지스터에서 바로 4바이트씩 기록 (배열을 거치면 store forwarding 으로 느려짐)
+            UInt8* pDst = _pVertices + i * _stride + plane;
+            for (size_t quad = 0; quad < 4; ++quad)
+            {
+                for (size_t word = 0; word < 4; ++word)
+                {
+                    const Int32 value = _mm_cvtsi128_si32(quads[quad]);
+                    std::memcpy(pDst + (quad * 4 + word) * _stride, &value, sizeof(Int32));
+                    quads[quad] = _mm_srli_si128(quads[quad], 4);
+                }
+            }
+        }
+
+        // 16개 단위로 나누어 떨어지지 않는 나머지 정점
+        for (UInt32 tailPlane = plane; tailPlane < plane + 4; ++tailPlane)
+        {
+            UnfilterVertexPlane(_pPlanes + tailPlane * _count, simdCount, _count, _stride, _pVertices + tailPlane);
+        }
+    }
+#endif
+
+    for (; plane < _stride; ++plane)
+    {
+        UnfilterVertexPlane(_pPlanes + plane * _count, 0, _count, _stride, _pVertices + plane);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// 인덱스 필터: 모서리 공유 코드 + zigzag 차분
+
+// _next (지금까지 나온 가장 큰 인덱스 + 1) 에 대한 차분. 새 정점이 순서대로 등장하면 0 이 반복됨
+template<typename T>
+NODISCARD T EncodeIndexValue(const T _index, T& _next)
+{
+    using Signed       = std::make_signed_t<T>;
+    const Signed delta = static_cast<Signed>(static_cast<T>(_index - _next));
+    if (_index >= _next)
+    {
+        _next = static_cast<T>(_index + 1);
+    }
+    return static_cast<T>(static_cast<T>(delta << 1) ^ static_cast<T>(delta >> (sizeof(T) * 8 - 1)));
+}
+
+template<typename T>
+NODISCARD T DecodeIndexValue(const T _value, T& _next)
+{
+    const T delta = static_cast<T>((_value >> 1) ^ static_cast<T>(0 - (_value & 1)));
+    const T index = static_cast<T>(_next + delta);
+    if (index >= _next)
+    {
+        _next = static_cast<T>(index + 1);
+    }
+    return index;
+}
+
+// 현재 삼각형이 이전 삼각형의 모서리를 뒤집어 공유하는지 (같은 감기 방향의 인접 삼각형)
+// 공유한다면 코드 (1 ~ 9) 와 나머지 정점의 위치를 반환
+template<typename T>
+NODISCARD UInt32 FindSharedEdge(const T (&_prev)[3], const T* _pTriangle, UInt32& _out_corner)
+{
+    for (UInt32 edge = 0; edge < 3; ++edge)
+    {
+        const T first  = _prev[(edge + 1) % 3];
+        const T second = _prev[edge];
+        for (UInt32 corner = 0; corner < 3; ++corner)
+        {
+            if (_pTriangle[corner] == first && _pTriangle[(corner + 1) % 3] == second)
+            {
+                _out_corner = (corner + 2) % 3;
+                return 1 + edge * 3 + corner;
+            }
+        }
+    }
+    return 0;
+}
+
+// 필터된 블록: [삼각형 코드 (4비트씩)][값의 바이트 평면]
+template<typename T>
+void FilterIndexBlock(const T* _pIndices, const size_t _count, std::vector<T>& _values, std::vector<UInt8>& _out)
+{
+    const size_t triangleCount = _count / 3;
+    const size_t codeByteWidth = GetTriangleCodeByteWidth(_count);
+    _out.assign(codeByteWidth, 0);
+    _values.clear();
+
+    T prev[3] = {};
+    T next    = 0;
+    for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+    {
+        const T*     pTriangle = _pIndices + triangle * 3;
+        UInt32       corner    = 0;
+        const UInt32 code      = FindSharedEdge(prev, pTriangle, corner);
+        if (code == 0)
+        {
+            for (UInt32 i = 0; i < 3; ++i)
+            {
+                _values.push_back(EncodeIndexValue(pTriangle[i], next));
+            }
+        }
+        else
+        {
+            _values.push_back(EncodeIndexValue(pTriangle[corner], next));
+        }
+
+        _out[triangle / 2] |= static_cast<UInt8>(code << ((triangle & 1) * 4));
+        std::copy_n(pTriangle, 3, prev);
+    }
+
+    // 삼각형을 이루지 않는 나머지 인덱스
+    for (size_t i = triangleCount * 3; i < _count; ++i)
+    {
+        _values.push_back(EncodeIndexValue(_pIndices[i], next));
+    }
+
+    const size_t valueCount = _values.size();
+    _out.resize(codeByteWidth + valueCount * sizeof(T));
+    for (size_t byte = 0; byte < sizeof(T); ++byte)
+    {
+        UInt8* pPlane = _out.data() + codeByteWidth + byte * valueCount;
+        for (size_t i = 0; i < valueCount; ++i)
+        {
+            pPlane[i] = static_cast<UInt8>(_values[i] >> (byte * 8));
+        }
+    }
+}
+
+template<typename T>
+NODISCARD bool UnfilterIndexBlock(const std::span<const UInt8> _filtered, T* _pIndices, const size_t _count)
+{
+    const size_t triangleCount = _count / 3;
+    const size_t codeByteWidth = GetTriangleCodeByteWidth(_count);
+    if (_filtered.size() < codeByteWidth || (_filtered.size() - codeByteWidth) % sizeof(T) != 0)
+    {
+        return false;
+    }
+
+    const UInt8* pCodes     = _filtered.data();
+    const UInt8* pPlanes    = _filtered.data() + codeByteWidth;
+    const size_t valueCount = (_filtered.size() - codeByteWidth) / sizeof(T);
+    size_t       cursor     = 0;
+    T            next       = 0;
+
+    auto readIndex = [&]() -> T {
+        T value = pPlanes[cursor];
+        for (size_t byte = 1; byte < sizeof(T); ++byte)
+        {
+            value |= static_cast<T>(static_cast<T>(pPlanes[byte * valueCount + cursor]) << (byte * 8));
+        }
+        ++cursor;
+        return DecodeIndexValue(value, next);
+    };
+
+    T prev[3] = {};
+    for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+    {
+        T*           pTriangle = _pIndices + triangle * 3;
+        const UInt32 code      = (pCodes[triangle / 2] >> ((triangle & 1) * 4)) & 0xF;
+        if (code == 0)
+        {
+            if (cursor + 3 > valueCount)
+            {
+                return false;
+            }
+            pTriangle[0] = readIndex();
+            pTriangle[1] = readIndex();
+            pTriangle[2] = readIndex();
+        }
+        else
+        {
+            if (code > k_maxTriangleCode || cursor + 1 > valueCount)
+            {
+                return false;
+            }
+            const UInt32 edge           = (code - 1) / 3;
+            const UInt32 corner         = (code - 1) % 3;
+            pTriangle[corner]           = prev[(edge + 1) % 3];
+            pTriangle[(corner + 1) % 3] = prev[edge];
+            pTriangle[(corner + 2) % 3] = readIndex();
+        }
+        std::copy_n(pTriangle, 3, prev);
+    }
+
+    for (size_t i = triangleCount * 3; i < _count; ++i)
+    {
+        if (cursor >= valueCount)
+        {
+            return false;
+        }
+        _pIndices[i] = readIndex();
+    }
+    return cursor == valueCount;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+class GeometryCodec final : public ICompressionCodec
+{
+public:
+    NODISCARD eCompressionCodec GetType() const override { return eCompressionCodec::Geometry; }
+    NODISCARD size_t            GetMaxRawByteWidth() const override { return LZ4_MAX_INPUT_SIZE / 2; }   // GetMaxCompressedSize 의 필터 여유분까지 LZ4 int 크기 안에 들어가도록
+
+    NODISCARD size_t GetMaxCompressedSize(const size_t _rawByteWidth) const override
+    {
+        // 블록은 최소 k_blockByteWidth / 2 이며, 인덱스 필터는 삼각형 (6 바이트 이상) 마다 코드 4비트가 늘어날 수 있음
+        const size_t blockCount    = _rawByteWidth / (k_blockByteWidth / 2) + 1;
+        const size_t filteredBound = _rawByteWidth + _rawByteWidth / 8 + blockCount;
+        return sizeof(GeometryStreamHeader) + blockCount * (sizeof(GeometryBlockHeader) + 16) + static_cast<size_t>(LZ4_compressBound(static_cast<int>(filteredBound)));
+    }
+
+    NODISCARD Result<size_t> Compress(const std::span<const UInt8> _src, const std::span<UInt8> _dst, const CompressionStreamDesc& _desc) const override
+    {
+        const UInt32 elementByteWidth = _desc.stream == eCompressionStream::Raw ? 1 : _desc.elementByteWidth;
+        if (!IsValidElementByteWidth(_desc.stream, elementByteWidth) || _src.size() % elementByteWidth != 0)
+        {
+            return Fail;
+        }
+
+        GeometryStreamHeader header;
+        header.stream            = static_cast<UInt8>(_desc.stream);
+        header.elementByteWidth  = static_cast<UInt16>(elementByteWidth);
+        header.blockElementCount = GetBlockElementCount(_desc.stream, elementByteWidth);
+
+        const size_t elementCount = _src.size() / elementByteWidth;
+        const size_t blockCount   = (elementCount + header.blockElementCount - 1) / header.blockElementCount;
+        size_t       cursor       = sizeof(GeometryStreamHeader) + blockCount * sizeof(GeometryBlockHeader);
+        if (cursor > _dst.size())
+        {
+            return Fail;
+        }
+        std::memcpy(_dst.data(), &header, sizeof(GeometryStreamHeader));
+
+        std::vector<UInt8>  filtered;
+        std::vector<UInt16> values16;
+        std::vector<UInt32> values32;
+        for (size_t block = 0; block < blockCount; ++block)
+        {
+            const size_t begin    = block * header.blockElementCount;
+            const size_t count    = std::min<size_t>(header.blockElementCount, elementCount - begin);
+            const UInt8* pRaw     = _src.data() + begin * elementByteWidth;
+            const UInt8* pFilter  = pRaw;
+            size_t       byteSize = count * elementByteWidth;
+            switch (_desc.stream)
+            {
+                case eCompressionStream::Vertex:
+                    filtered.resize(byteSize);
+                    FilterVertexBlock(pRaw, count, elementByteWidth, filtered.data());
+                    pFilter = filtered.data();
+                    break;
+                case eCompressionStream::Index:
+                    if (elementByteWidth == sizeof(UInt16))
+                    {
+                        FilterIndexBlock(reinterpret_cast<const UInt16*>(pRaw), count, values16, filtered);
+                    }
+                    else
+                    {
+                        FilterIndexBlock(reinterpret_cast<const UInt32*>(pRaw), count, values32, filtered);
+                    }
+                    pFilter  = filtered.data();
+                    byteSize = filtered.size();
+                    break;
+                default:
+                    break;
+            }
+
+            const int storedByteWidth = LZ4_compress_default(reinterpret_cast<const char*>(pFilter),
+                                                             reinterpret_cast<char*>(_dst.data() + cursor),
+                                                             static_cast<int>(byteSize),
+                                                             static_cast<int>(_dst.size() - cursor));
+            if (storedByteWidth <= 0)
+            {
+                return Fail;
+            }
+
+            GeometryBlockHeader blockHeader;
+            blockHeader.storedByteWidth   = static_cast<UInt32>(storedByteWidth);
+            blockHeader.filteredByteWidth = static_cast<UInt32>(byteSize);
+            std::memcpy(_dst.data() + sizeof(GeometryStreamHeader) + block * sizeof(GeometryBlockHeader), &blockHeader, sizeof(GeometryBlockHeader));
+            cursor += blockHeader.storedByteWidth;
+        }
+        return cursor;
+    }
+
+    bool Decompress(const std::span<const UInt8> _src, const std::span<UInt8> _dst) const override
+    {
+        if (_src.size() < sizeof(GeometryStreamHeader))
+        {
+            return false;
+        }
+
+        GeometryStreamHeader header;
+        std::memcpy(&header, _src.data(), sizeof(GeometryStreamHeader));
+        const eCompressionStream stream = static_cast<eCompressionStream>(header.stream);
+        if (!IsValidElementByteWidth(stream, header.elementByteWidth) || header.blockElementCount == 0 || _dst.size() % header.elementByteWidth != 0)
+        {
+            return false;
+        }
+        if (stream == eCompressionStream::Index && header.blockElementCount % 3 != 0)
+        {
+            return false;
+        }
+
+        // 블록 테이블 검사 및 블록 위치 계산
+        const size_t elementCount = _dst.size() / header.elementByteWidth;
+        const size_t blockCount   = (elementCount + header.blockElementCount - 1) / header.blockElementCount;
+        const size_t tableEnd     = sizeof(GeometryStreamHeader) + blockCount * sizeof(GeometryBlockHeader);
+        if (tableEnd > _src.size())
+        {
+            return false;
+        }
+
+        std::vector<GeometryBlockHeader> blockHeaders(blockCount);
+        std::vector<size_t>              blockOffsets(blockCount);
+        std::memcpy(blockHeaders.data(), _src.data() + sizeof(GeometryStreamHeader), blockCount * sizeof(GeometryBlockHeader));
+        size_t cursor = tableEnd;
+        for (size_t block = 0; block < blockCount; ++block)
+        {
+            blockOffsets[block] = cursor;
+            cursor += blockHeaders[block].storedByteWidth;
+            if (cursor > _src.size())
+            {
+                return false;
+            }
+        }
+
+        auto decodeBlock = [&](const size_t _block) -> bool {
+            const GeometryBlockHeader& blockHeader = blockHeaders[_block];
+            const size_t               begin       = _block * header.blockElementCount;
+            const size_t               count       = std::min<size_t>(header.blockElementCount, elementCount - begin);
+            const std::span<UInt8>     dst         = _dst.subspan(begin * header.elementByteWidth, count * header.elementByteWidth);
+            const char*                pStored     = reinterpret_cast<const char*>(_src.data() + blockOffsets[_block]);
+
+            // 필터가 없다면 _dst 에 바로 해제
+            if (stream == eCompressionStream::Raw)
+            {
+                return blockHeader.filteredByteWidth == dst.size()
+                    && LZ4_decompress_safe(pStored, reinterpret_cast<char*>(dst.data()), static_cast<int>(blockHeader.storedByteWidth), static_cast<int>(dst.size())) == static_cast<int>(dst.size());
+            }
+
+            const size_t filteredBound = stream == eCompressionStream::Vertex ? dst.size() : GetTriangleCodeByteWidth(count) + dst.size();
+            if (blockHeader.filteredByteWidth > filteredBound)
+            {
+                return false;
+            }
+
+            // 블록 크기의 스레드 로컬 버퍼 (L2 에 머무름)
+            thread_local std::vector<UInt8> s_filtered;
+            s_filtered.resize(blockHeader.filteredByteWidth);
+            const int filteredByteWidth = LZ4_decompress_safe(pStored, reinterpret_cast<char*>(s_filtered.data()), static_cast<int>(blockHeader.storedByteWidth), static_cast<int>(s_filtered.size()));
+            if (filteredByteWidth != static_cast<int>(blockHeader.filteredByteWidth))
+            {
+                return false;
+            }
+
+            if (stream == eCompressionStream::Vertex)
+            {
+                if (s_filtered.size() != dst.size())
+                {
+                    return false;
+                }
+                UnfilterVertexBlock(s_filtered.data(), count, header.elementByteWidth, dst.data());
+                return true;
+            }
+
+            if (header.elementByteWidth == sizeof(UInt16))
+            {
+                return UnfilterIndexBlock(std::span<const UInt8>(s_filtered), reinterpret_cast<UInt16*>(dst.data()), count);
+            }
+            return UnfilterIndexBlock(std::span<const UInt8>(s_filtered), reinterpret_cast<UInt32*>(dst.data()), count);
+        };
+
+        if (blockCount <= 1)
+        {
+            return blockCount == 0 || decodeBlock(0);
+        }
+
+        // 큰 스트림은 블록 단위로 병렬 해제
+        std::atomic<bool> bFailed = false;
+        ThreadPool::GetGlobal().ParallelFor(static_cast<UInt32>(blockCount), [&](const UInt32 _block) {
+            if (!decodeBlock(_block))
+            {
+                bFailed = true;
+            }
+        });
+        return !bFailed;
+    }
+};
+
+}   // namespace
+
+namespace jam
+{
+
+Scope<ICompressionCodec> CreateGeometryCodec()
+{
+    return MakeScope<GeometryCodec>();
+}
+
+}   // namespace jam
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+#include "Compression.h"
+
+namespace jam
+{
+
+// 정점 / 인덱스 스트림 전용 코덱 (eCompressionCodec::Geometry)
+// 스트림을 약 64KB 블록으로 나누고 블록마다 필터를 적용한 뒤 LZ4 로 압축
+// - 정점: stride 의 바이트 위치마다 평면으로 모은 뒤 이전 정점과의 바이트 차분 (속성의 상위 바이트가 0 으로 반복됨)
+// - 인덱스: 이전 삼각형과 모서리를 공유하는 삼각형 (팬 / 스트립) 은 4비트 코드와 새 정점 하나만 기록하고,
+//           값은 지금까지 나온 가장 큰 인덱스 + 1 에 대한 zigzag 차분을 바이트 평면으로 기록
+// 두 필터 모두 무손실이며 블록은 서로 독립적이므로 병렬로 해제됨
+// 해제는 블록의 LZ4 결과를 스레드 로컬 버퍼에 풀고 SIMD 로 필터를 되돌리며 _dst 에 직접 기록 (중간 사본 없음)
+NODISCARD Scope<ICompressionCodec> CreateGeometryCodec();
+
+}   // namespace jam
\ No newline at end of file
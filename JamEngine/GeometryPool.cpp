@@ -0,0 +1,255 @@
+#include "pch.h"
+
+#include "GeometryPool.h"
+
+#include "Renderer.h"
+
+namespace
+{
+
+using namespace jam;
+
+void InitializePageBuffer(VertexBuffer& _buffer, const UInt32 _stride, const UInt32 _capacity)
+{
+    _buffer.Initialize(_stride, _capacity, eResourceAccess::GPUWriteable);
+}
+
+void InitializePageBuffer(IndexBuffer& _buffer, const UInt32 _stride, const UInt32 _capacity)
+{
+    const eIndexFormat format = _stride == sizeof(UInt16) ? eIndexFormat::UInt16 : eIndexFormat::UInt32;
+    _buffer.Initialize(_capacity, eResourceAccess::GPUWriteable, std::nullopt, format);
+}
+
+}   // namespace
+
+namespace jam
+{
+
+GeometryPool& GeometryPool::GetGlobal()
+{
+    static GeometryPool s_pool;
+    return s_pool;
+}
+
+Result<Ref<const GeometryAllocation>> GeometryPool::Allocate(const eVertexType _vertexType, const std::span<const UInt8> _vertices, const eIndexFormat _indexFormat, const std::span<const UInt8> _indices)
+{
+    const UInt32 vertexStride = GetVertexStride(_vertexType);
+    const UInt32 indexStride  = GetIndexStride(_indexFormat);
+    JAM_ASSERT(!_vertices.empty() && _vertices.size() % vertexStride == 0, "GeometryPool::Allocate() - Invalid vertex stream size");
+    JAM_ASSERT(_indices.size() % indexStride == 0, "GeometryPool::Allocate() - Invalid index stream size");
+
+    auto pAllocation         = std::make_unique<GeometryAllocation>();
+    pAllocation->vertexType  = _vertexType;
+    pAllocation->indexFormat = _indexFormat;
+    pAllocation->vertexCount = static_cast<UInt32>(_vertices.size() / vertexStride);
+    pAllocation->indexCount  = static_cast<UInt32>(_indices.size() / indexStride);
+
+    // 정점 구간
+    std::vector<VertexPage>& vertexPages = m_vertexPages[EnumToInt(_vertexType)];
+    auto [vertexRange, bVertexResult]    = AllocateRange_(vertexPages, pAllocation->vertexCount, vertexStride, k_vertexPageByteWidth);
+    if (!bVertexResult)
+    {
+        JAM_ERROR("GeometryPool::Allocate() - Failed to allocate {} vertices", pAllocation->vertexCount);
+        return Fail;
+    }
+    pAllocation->vertexPage = vertexRange.first;
+    pAllocation->baseVertex = vertexRange.second;
+
+    VertexPage& vertexPage = vertexPages[pAllocation->vertexPage];
+    vertexPage.buffer.UploadRegion(static_cast<UInt32>(_vertices.size()), _vertices.data(), pAllocation->baseVertex * vertexStride);
+    vertexPage.owners.emplace(pAllocation->baseVertex, pAllocation.get());
+
+    // 인덱스 구간 (인덱스가 없는 메쉬는 할당하지 않음)
+    if (pAllocation->indexCount > 0)
+    {
+        std::vector<IndexPage>& indexPages = GetIndexPages_(_indexFormat);
+        auto [indexRange, bIndexResult]    = AllocateRange_(indexPages, pAllocation->indexCount, indexStride, k_indexPageByteWidth);
+        if (!bIndexResult)
+        {
+            JAM_ERROR("GeometryPool::Allocate() - Failed to allocate {} indices", pAllocation->indexCount);
+            FreeRange_(vertexPage, pAllocation->baseVertex, &GeometryAllocation::baseVertex);
+            return Fail;
+        }
+        pAllocation->indexPage  = indexRange.first;
+        pAllocation->startIndex = indexRange.second;
+
+        IndexPage& indexPage = indexPages[pAllocation->indexPage];
+        indexPage.buffer.UploadRegion(static_cast<UInt32>(_indices.size()), _indices.data(), pAllocation->startIndex * indexStride);
+        indexPage.owners.emplace(pAllocation->startIndex, pAllocation.get());
+    }
+
+    // 마지막 참조가 사라지면 구간을 반환
+    return Ref<const GeometryAllocation>(pAllocation.release(), [this](const GeometryAllocation* _pAllocation) {
+        Free_(*const_cast<GeometryAllocation*>(_pAllocation));
+        delete _pAllocation;
+    });
+}
+
+void GeometryPool::Bind(const GeometryAllocation& _allocation) const
+{
+    GetVertexBuffer(_allocation).Bind();
+    if (_allocation.indexCount > 0)
+    {
+        GetIndexBuffer(_allocation).Bind();
+    }
+}
+
+const VertexBuffer& GeometryPool::GetVertexBuffer(const GeometryAllocation& _allocation) const
+{
+    return m_vertexPages[EnumToInt(_allocation.vertexType)][_allocation.vertexPage].buffer;
+}
+
+const IndexBuffer& GeometryPool::GetIndexBuffer(const GeometryAllocation& _allocation) const
+{
+    static const IndexBuffer s_emptyIndexBuffer;
+    if (_allocation.indexCount == 0)
+    {
+        return s_emptyIndexBuffer;
+    }
+    return GetIndexPages_(_allocation.indexFormat)[_allocation.indexPage].buffer;
+}
+
+void GeometryPool::Defragment()
+{
+    for (std::vector<VertexPage>& pages: m_vertexPages)
+    {
+        for (VertexPage& page: pages)
+        {
+            DefragmentPage_(page, &GeometryAllocation::baseVertex);
+        }
+    }
+
+    for (std::vector<IndexPage>& pages: m_indexPages)
+    {
+        for (IndexPage& page: pages)
+        {
+            DefragmentPage_(page, &GeometryAllocation::startIndex);
+        }
+    }
+}
+
+GeometryPoolStats GeometryPool::GetStats() const
+{
+    GeometryPoolStats stats;
+    stats.defragmentCount = m_defragmentCount;
+    for (const std::vector<VertexPage>& pages: m_vertexPages)
+    {
+        for (const VertexPage& page: pages)
+        {
+            stats.vertexPageCount += page.allocator.GetCapacity() > 0 ? 1 : 0;
+            stats.vertexByteWidth += static_cast<UInt64>(page.allocator.GetCapacity()) * page.stride;
+            stats.usedVertexByteWidth += static_cast<UInt64>(page.allocator.GetUsedSize()) * page.stride;
+            stats.allocationCount += page.allocator.GetAllocationCount();
+        }
+    }
+
+    for (const std::vector<IndexPage>& pages: m_indexPages)
+    {
+        for (const IndexPage& page: pages)
+        {
+            stats.indexPageCount += page.allocator.GetCapacity() > 0 ? 1 : 0;
+            stats.indexByteWidth += static_cast<UInt64>(page.allocator.GetCapacity()) * page.stride;
+            stats.usedIndexByteWidth += static_cast<UInt64>(page.allocator.GetUsedSize()) * page.stride;
+        }
+    }
+    return stats;
+}
+
+void GeometryPool::Free_(GeometryAllocation& _allocation)
+{
+    FreeRange_(m_vertexPages[EnumToInt(_allocation.vertexType)][_allocation.vertexPage], _allocation.baseVertex, &GeometryAllocation::baseVertex);
+    if (_allocation.indexCount > 0)
+    {
+        FreeRange_(GetIndexPages_(_allocation.indexFormat)[_allocation.indexPage], _allocation.startIndex, &GeometryAllocation::startIndex);
+    }
+}
+
+template<typename BufferType>
+Result<std::pair<UInt32, UInt32>> GeometryPool::AllocateRange_(std::vector<Page<BufferType>>& _pages, const UInt32 _count, const UInt32 _stride, const UInt32 _pageByteWidth)
+{
+    // 기존 페이지 (비어있던 페이지는 다시 생성)
+    for (UInt32 pageIndex = 0; pageIndex < _pages.size(); ++pageIndex)
+    {
+        Page<BufferType>& page = _pages[pageIndex];
+        if (page.allocator.GetCapacity() == 0)
+        {
+            const UInt32 capacity = std::max(_pageByteWidth / _stride, _count);
+            InitializePageBuffer(page.buffer, _stride, capacity);
+            page.allocator.Reset(capacity);
+        }
+
+        // 단편화로 자리가 없다면 조각 모음 후 다시 시도
+        if (page.allocator.GetLargestFreeSize() < _count && page.allocator.GetFreeSize() >= _count)
+        {
+            DefragmentPage_(page, std::is_same_v<BufferType, VertexBuffer> ? &GeometryAllocation::baseVertex : &GeometryAllocation::startIndex);
+        }
+
+        if (auto [offset, bResult] = page.allocator.Allocate(_count); bResult)
+        {
+            return std::make_pair(pageIndex, offset);
+        }
+    }
+
+    // 새 페이지 - 페이지보다 큰 메쉬는 전용 페이지를 사용
+    const UInt32      capacity = std::max(_pageByteWidth / _stride, _count);
+    Page<BufferType>& page     = _pages.emplace_back();
+    page.stride                = _stride;
+    InitializePageBuffer(page.buffer, _stride, capacity);
+    page.allocator.Reset(capacity);
+
+    auto [offset, bResult] = page.allocator.Allocate(_count);
+    if (!bResult)
+    {
+        return Fail;
+    }
+    return std::make_pair(static_cast<UInt32>(_pages.size() - 1), offset);
+}
+
+template<typename BufferType>
+void GeometryPool::FreeRange_(Page<BufferType>& _page, const UInt32 _offset, UInt32 GeometryAllocation::* _pOffset)
+{
+    _page.allocator.Free(_offset);
+    _page.owners.erase(_offset);
+
+    // 완전히 빈 페이지는 버퍼를 해제 (다음 할당 시 다시 생성)
+    if (_page.allocator.GetAllocationCount() == 0)
+    {
+        _page.buffer.Reset();
+        _page.allocator.Reset(0);
+        return;
+    }
+
+    if (_page.allocator.GetFreeBlockCount() > 1 && _page.allocator.GetFragmentation() > m_defragmentThreshold)
+    {
+        DefragmentPage_(_page, _pOffset);
+    }
+}
+
+template<typename BufferType>
+void GeometryPool::DefragmentPage_(Page<BufferType>& _page, UInt32 GeometryAllocation::* _pOffset)
+{
+    if (_page.allocator.GetFreeBlockCount() <= 1)
+    {
+        return;
+    }
+
+    // 같은 버퍼 안에서 겹치는 복사는 허용되지 않으므로 새 버퍼로 옮김
+    BufferType compacted;
+    InitializePageBuffer(compacted, _page.stride, _page.allocator.GetCapacity());
+
+    std::unordered_map<UInt32, GeometryAllocation*> owners;
+    for (const RangeMove& move: _page.allocator.Defragment())
+    {
+        compacted.CopyRegionFrom(_page.buffer, move.from * _page.stride, move.size * _page.stride, move.to * _page.stride);
+
+        GeometryAllocation* pAllocation = _page.owners.at(move.from);
+        pAllocation->*_pOffset          = move.to;
+        owners.emplace(move.to, pAllocation);
+    }
+
+    _page.buffer = std::move(compacted);
+    _page.owners = std::move(owners);
+    ++m_defragmentCount;
+}
+
+}   // namespace jam
\ No newline at end of file
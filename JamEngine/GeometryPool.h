@@ -0,0 +1,102 @@
+#pragma once
+#include "Buffers.h"
+#include "RangeAllocator.h"
+#include "Vertex.h"
+
+namespace jam
+{
+
+// 풀 안에서 메쉬 하나가 차지하는 정점/인덱스 구간
+// 조각 모음 시 풀이 위치를 갱신하므로 복사하지 말고 GeometryPool::Allocate 가 반환한 포인터로 참조
+struct GeometryAllocation
+{
+    eVertexType  vertexType  = eVertexType::Vertex3;
+    eIndexFormat indexFormat = eIndexFormat::UInt32;
+    UInt32       vertexPage  = 0;
+    UInt32       indexPage   = 0;
+    UInt32       baseVertex  = 0;   // 페이지 내 정점 오프셋 (DrawIndexed 의 BaseVertexLocation)
+    UInt32       vertexCount = 0;
+    UInt32       startIndex  = 0;   // 페이지 내 인덱스 오프셋 (DrawIndexed 의 StartIndexLocation)
+    UInt32       indexCount  = 0;
+};
+
+struct GeometryPoolStats
+{
+    UInt32 vertexPageCount     = 0;
+    UInt32 indexPageCount      = 0;
+    UInt64 vertexByteWidth     = 0;   // 페이지 용량
+    UInt64 usedVertexByteWidth = 0;
+    UInt64 indexByteWidth      = 0;
+    UInt64 usedIndexByteWidth  = 0;
+    UInt64 allocationCount     = 0;
+    UInt64 defragmentCount     = 0;
+};
+
+// 정점 타입별 / 인덱스 포맷별로 큰 버퍼 몇 개(페이지)를 두고 메쉬마다 구간을 나눠주는 기하 풀
+// 같은 페이지의 메쉬끼리는 버퍼를 다시 바인딩하지 않고 base vertex / start index 만 바꿔 그릴 수 있음
+// 해제 후 페이지의 단편화가 임계값을 넘으면 살아있는 구간을 앞으로 모음 (GPU 내 복사)
+// GPU 리소스를 생성하고 즉시 컨텍스트를 사용하므로 메인 스레드에서 사용
+class GeometryPool
+{
+public:
+    static constexpr UInt32 k_vertexPageByteWidth        = 64 * 1024 * 1024;
+    static constexpr UInt32 k_indexPageByteWidth         = 16 * 1024 * 1024;
+    static constexpr float  k_defaultDefragmentThreshold = 0.5f;
+
+    GeometryPool()  = default;
+    ~GeometryPool() = default;
+
+    GeometryPool(const GeometryPool&)            = delete;
+    GeometryPool& operator=(const GeometryPool&) = delete;
+
+    NODISCARD static GeometryPool& GetGlobal();
+
+    // 반환된 포인터의 참조가 모두 사라지면 구간이 풀로 돌아감
+    NODISCARD Result<Ref<const GeometryAllocation>> Allocate(eVertexType _vertexType, std::span<const UInt8> _vertices, eIndexFormat _indexFormat, std::span<const UInt8> _indices);
+
+    void                          Bind(const GeometryAllocation& _allocation) const;
+    NODISCARD const VertexBuffer& GetVertexBuffer(const GeometryAllocation& _allocation) const;
+    NODISCARD const IndexBuffer&  GetIndexBuffer(const GeometryAllocation& _allocation) const;
+
+    void Defragment();   // 모든 페이지
+
+    void                        SetDefragmentThreshold(const float _threshold) { m_defragmentThreshold = _threshold; }
+    NODISCARD float             GetDefragmentThreshold() const { return m_defragmentThreshold; }
+    NODISCARD GeometryPoolStats GetStats() const;
+
+private:
+    template<typename BufferType>
+    struct Page
+    {
+        BufferType                                       buffer;
+        RangeAllocator                                   allocator;
+        UInt32                                           stride = 0;
+        std::unordered_map<UInt32, GeometryAllocation*> owners;   // 오프셋 -> 구간 (조각 모음 시 갱신)
+    };
+
+    using VertexPage = Page<VertexBuffer>;
+    using IndexPage  = Page<IndexBuffer>;
+
+    void Free_(GeometryAllocation& _allocation);
+
+    // 들어갈 자리가 있는 페이지를 찾고 없다면 새 페이지를 만듦 (페이지 인덱스, 오프셋)
+    template<typename BufferType>
+    NODISCARD Result<std::pair<UInt32, UInt32>> AllocateRange_(std::vector<Page<BufferType>>& _pages, UInt32 _count, UInt32 _stride, UInt32 _pageByteWidth);
+
+    template<typename BufferType>
+    void FreeRange_(Page<BufferType>& _page, UInt32 _offset, UInt32 GeometryAllocation::* _pOffset);
+
+    template<typename BufferType>
+    void DefragmentPage_(Page<BufferType>& _page, UInt32 GeometryAllocation::* _pOffset);
+
+    NODISCARD std::vector<IndexPage>&       GetIndexPages_(eIndexFormat _format) { return m_indexPages[_format == eIndexFormat::UInt16 ? 0 : 1]; }
+    NODISCARD const std::vector<IndexPage>& GetIndexPages_(eIndexFormat _format) const { return m_indexPages[_format == eIndexFormat::UInt16 ? 0 : 1]; }
+
+    std::vector<VertexPage> m_vertexPages[EnumCount<eVertexType>()];
+    std::vector<IndexPage>  m_indexPages[EnumCount<eIndexFormat>()];
+
+    float  m_defragmentThreshold = k_defaultDefragmentThreshold;
+    UInt64 m_defragmentCount     = 0;
+};
+
+}   // namespace jam
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include "JsonUtilities.h"
 
+#include "FileIOService.h"
+
 #include <fstream>
 
 namespace jam
@@ -9,23 +11,22 @@ namespace jam
 
 Result<Json> LoadJsonFromFile(const std::filesystem::path& filePath)
 {
-    std::ifstream file { filePath };
-    if (!file.is_open())
+    // 스트림으로 조금씩 읽지 않고 한 번에 읽은 뒤 메모리에서 파싱
+    auto [file, bResult] = FileIOService::GetGlobal().ReadAndWait(filePath);
+    if (!bResult)
     {
         JAM_ERROR("Failed to open JSON file: {}", filePath.string());
         return Fail;
     }
 
-    try
-    {
-        Json json = Json::parse(file, nullptr, false);
-        return json;
-    }
-    catch (std::exception& e)
+    const std::span<const UInt8> data = file.GetData();
+    Json                         json = Json::parse(data.begin(), data.end(), nullptr, false);
+    if (json.is_discarded())
     {
-        JAM_ERROR("Failed to parse JSON file: {}. Error: {}", filePath.string(), e.what());
+        JAM_ERROR("Failed to parse JSON file: {}", filePath.string());
         return Fail;
     }
+    return json;
 }
 
 bool SaveJsonToFile(const Json& json, const std::filesystem::path& filePath)
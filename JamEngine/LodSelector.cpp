@@ -0,0 +1,175 @@
+#include "pch.h"
+
+#include "LodSelector.h"
+
+#include "Components.h"
+#include "Model.h"
+#include "ModelAsset.h"
+#include "Scene.h"
+
+namespace jam
+{
+
+void LodSelector::Update(Scene& _sceneRef)
+{
+    m_stats = {};
+
+    // 주 카메라
+    const CameraComponent* pCamera = nullptr;
+    Vec3                   cameraPosition;
+    for (auto [entity, camera, transform]: _sceneRef.CreateView<CameraComponent, TransformComponent>().each())
+    {
+        if (camera.bPrimary)
+        {
+            pCamera        = &camera;
+            cameraPosition = transform.position;
+            break;
+        }
+    }
+    if (pCamera == nullptr || Gather_(_sceneRef) == false)
+    {
+        return;
+    }
+
+    // 원근: 거리 1 에서 1 단위가 차지하는 픽셀 수, 직교: 뷰 높이가 1 단위 (CreateOrthographicMatrix 참고)
+    const bool  bPerspective    = pCamera->projection == CameraComponent::eProjection::Perspective;
+    const float projectionScale = bPerspective ? m_settings.viewportHeight / (2.f * std::tan(pCamera->fovYRad * 0.5f)) : m_settings.viewportHeight;
+    ComputePixelsPerUnit_(cameraPosition, projectionScale, std::max(pCamera->nearZ, CameraComponent::k_nearestZ), bPerspective);
+
+    const UInt64 budget        = m_settings.triangleBudget;
+    float        threshold     = std::max(m_settings.maxScreenError * m_settings.qualityBias, std::numeric_limits<float>::epsilon());
+    UInt64       triangleCount = Select_(threshold);
+
+    // 예산을 넘으면 허용 오차를 늘려 전체적으로 낮은 LOD 를 선택
+    while (budget > 0 && triangleCount > budget && m_stats.budgetPassCount < k_maxBudgetPasses)
+    {
+        threshold     *= 2.f;
+        triangleCount  = Select_(threshold);
+        ++m_stats.budgetPassCount;
+    }
+
+    const size_t count = m_entities.size();
+    for (size_t i = 0; i < count; ++i)
+    {
+        _sceneRef.GetRegistry().get<ModelComponent>(m_entities[i]).lodLevel = m_selectedLevels[i];
+    }
+
+    m_stats.entityCount            = static_cast<UInt32>(count);
+    m_stats.submittedTriangleCount = triangleCount;
+    for (const UInt64 triangles: m_lodTriangleCounts[0])
+    {
+        m_stats.fullDetailTriangleCount += triangles;
+    }
+}
+
+bool LodSelector::Gather_(Scene& _sceneRef)
+{
+    m_entities.clear();
+    m_centerX.clear();
+    m_centerY.clear();
+    m_centerZ.clear();
+    m_radius.clear();
+    m_scale.clear();
+    m_currentLevels.clear();
+    for (UInt32 level = 0; level < k_maxLodLevels; ++level)
+    {
+        m_lodErrors[level].clear();
+        m_lodTriangleCounts[level].clear();
+    }
+
+    for (auto [entity, modelComponent, transform]: _sceneRef.CreateView<ModelComponent, TransformComponent>().each())
+    {
+        if (!modelComponent.modelAsset)
+        {
+            continue;
+        }
+
+        const Model& model    = modelComponent.modelAsset->GetModel();
+        const UInt32 lodCount = std::min(model.GetMaxLodCount(), k_maxLodLevels);
+        const Mat4   world    = transform.CreateWorldMatrix();
+        const Vec3   center   = Vec3::Transform(model.GetBoundsCenter(), world);
+        const float  scale    = std::max({ std::abs(transform.scale.x), std::abs(transform.scale.y), std::abs(transform.scale.z) });
+
+        m_entities.push_back(entity);
+        m_centerX.push_back(center.x);
+        m_centerY.push_back(center.y);
+        m_centerZ.push_back(center.z);
+        m_radius.push_back(model.GetBoundsRadius() * scale);
+        m_scale.push_back(scale);
+        m_currentLevels.push_back(std::min(modelComponent.lodLevel, lodCount - 1));
+        for (UInt32 level = 0; level < k_maxLodLevels; ++level)
+        {
+            m_lodErrors[level].push_back(level < lodCount ? model.GetLodError(level) : std::numeric_limits<float>::infinity());
+            m_lodTriangleCounts[level].push_back(model.GetLodTriangleCount(level));
+        }
+    }
+
+    m_pixelsPerUnit.resize(m_entities.size());
+    m_selectedLevels.resize(m_entities.size());
+    return !m_entities.empty();
+}
+
+void LodSelector::ComputePixelsPerUnit_(const Vec3& _cameraPosition, const float _projectionScale, const float _nearZ, const bool _bPerspective)
+{
+    const size_t count         = m_entities.size();
+    const float* centerX       = m_centerX.data();
+    const float* centerY       = m_centerY.data();
+    const float* centerZ       = m_centerZ.data();
+    const float* radius        = m_radius.data();
+    const float* scale         = m_scale.data();
+    float*       pixelsPerUnit = m_pixelsPerUnit.data();
+
+    if (_bPerspective == false)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            pixelsPerUnit[i] = scale[i] * _projectionScale;
+        }
+        return;
+    }
+
+    // 경계 구에서 카메라에 가장 가까운 점까지의 거리 (보수적)
+    for (size_t i = 0; i < count; ++i)
+    {
+        const float dx       = centerX[i] - _cameraPosition.x;
+        const float dy       = centerY[i] - _cameraPosition.y;
+        const float dz       = centerZ[i] - _cameraPosition.z;
+        const float distance = std::max(std::sqrt(dx * dx + dy * dy + dz * dz) - radius[i], _nearZ);
+        pixelsPerUnit[i]     = scale[i] * _projectionScale / distance;
+    }
+}
+
+UInt64 LodSelector::Select_(const float _threshold)
+{
+    const size_t  count          = m_entities.size();
+    const float   coarseLimit    = _threshold * (1.f - std::clamp(m_settings.hysteresis, 0.f, 1.f));
+    const float*  pixelsPerUnit  = m_pixelsPerUnit.data();
+    const UInt32* currentLevels  = m_currentLevels.data();
+    UInt32*       selectedLevels = m_selectedLevels.data();
+
+    // 오차는 레벨에 따라 단조 증가하므로 조건을 만족하는 레벨 수가 곧 선택된 레벨
+    // 현재보다 낮은 LOD 는 더 엄격한 한계를 사용 (히스테리시스)
+    std::fill_n(selectedLevels, count, 0u);
+    for (UInt32 level = 1; level < k_maxLodLevels; ++level)
+    {
+        const float* errors = m_lodErrors[level].data();
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float limit  = level > currentLevels[i] ? coarseLimit : _threshold;
+            selectedLevels[i] += errors[i] * pixelsPerUnit[i] <= limit ? 1u : 0u;
+        }
+    }
+
+    UInt64 triangleCount = 0;
+    for (UInt32 level = 0; level < k_maxLodLevels; ++level)
+    {
+        const UInt64* triangles = m_lodTriangleCounts[level].data();
+        for (size_t i = 0; i < count; ++i)
+        {
+            triangleCount += selectedLevels[i] == level ? triangles[i] : 0;
+        }
+    }
+    return triangleCount;
+}
+
+}   // namespace jam
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+
+namespace jam
+{
+
+class Scene;
+
+struct LodSelectionSettings
+{
+    float  maxScreenError = 1.f;      // 허용하는 화면 공간 오차 (픽셀)
+    float  qualityBias    = 1.f;      // 전역 품질 배율. 클수록 낮은 LOD 를 선택
+    float  hysteresis     = 0.25f;    // 더 낮은 LOD 로 전환할 때 요구하는 여유 비율 (깜빡임 방지)
+    float  viewportHeight = 1080.f;   // 화면 공간 오차 계산에 사용하는 뷰포트 높이 (픽셀)
+    UInt64 triangleBudget = 0;        // 프레임당 삼각형 예산. 0 이면 무제한
+};
+
+struct LodSelectionStats
+{
+    UInt32 entityCount             = 0;
+    UInt32 budgetPassCount         = 0;   // 예산을 맞추기 위해 허용 오차를 늘린 횟수
+    UInt64 submittedTriangleCount  = 0;   // 선택된 LOD 기준
+    UInt64 fullDetailTriangleCount = 0;   // 모두 LOD0 일 때
+};
+
+// 주 카메라(CameraComponent::bPrimary) 기준으로 ModelComponent::lodLevel 을 선택
+// 엔티티 데이터를 SoA 배열로 모은 뒤 가상 호출 없는 루프로 처리 (10만 개 이상의 엔티티 대상)
+class LodSelector
+{
+public:
+    static constexpr UInt32 k_maxLodLevels    = 8;
+    static constexpr UInt32 k_maxBudgetPasses = 8;
+
+    void Update(Scene& _sceneRef);
+
+    void                                  SetSettings(const LodSelectionSettings& _settings) { m_settings = _settings; }
+    NODISCARD const LodSelectionSettings& GetSettings() const { return m_settings; }
+    NODISCARD const LodSelectionStats&    GetStats() const { return m_stats; }
+
+private:
+    NODISCARD bool Gather_(Scene& _sceneRef);
+    void           ComputePixelsPerUnit_(const Vec3& _cameraPosition, float _projectionScale, float _nearZ, bool _bPerspective);
+    UInt64         Select_(float _threshold);
+
+    LodSelectionSettings m_settings;
+    LodSelectionStats    m_stats;
+
+    // SoA (엔티티 순서)
+    std::vector<entt::entity> m_entities;
+    std::vector<float>        m_centerX;
+    std::vector<float>        m_centerY;
+    std::vector<float>        m_centerZ;
+    std::vector<float>        m_radius;            // 월드 공간 경계 구 반지름
+    std::vector<float>        m_scale;             // 모델 공간 -> 월드 공간 배율
+    std::vector<float>        m_pixelsPerUnit;     // 모델 공간 1 단위가 차지하는 픽셀 수
+    std::vector<UInt32>       m_currentLevels;     // 이전 프레임의 LOD
+    std::vector<UInt32>       m_selectedLevels;
+
+    std::array<std::vector<float>, k_maxLodLevels>  m_lodErrors;           // 레벨별 오차 (없는 레벨은 무한대)
+    std::array<std::vector<UInt64>, k_maxLodLevels> m_lodTriangleCounts;   // 레벨별 삼각형 수
+};
+
+}   // namespace jam
\ No newline at end of file
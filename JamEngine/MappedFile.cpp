@@ -0,0 +1,101 @@
+#include "pch.h"
+
+#include "MappedFile.h"
+
+#include "WindowsUtilities.h"
+
+namespace jam
+{
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& _other) noexcept
+    : m_hFile(std::exchange(_other.m_hFile, INVALID_HANDLE_VALUE))
+    , m_hMapping(std::exchange(_other.m_hMapping, nullptr))
+    , m_pData(std::exchange(_other.m_pData, nullptr))
+    , m_byteWidth(std::exchange(_other.m_byteWidth, 0))
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& _other) noexcept
+{
+    if (this != &_other)
+    {
+        Close();
+        m_hFile     = std::exchange(_other.m_hFile, INVALID_HANDLE_VALUE);
+        m_hMapping  = std::exchange(_other.m_hMapping, nullptr);
+        m_pData     = std::exchange(_other.m_pData, nullptr);
+        m_byteWidth = std::exchange(_other.m_byteWidth, 0);
+    }
+    return *this;
+}
+
+bool MappedFile::Open(const fs::path& _path)
+{
+    Close();
+
+    // 파일 열기
+    m_hFile = CreateFileW(_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (m_hFile == INVALID_HANDLE_VALUE)
+    {
+        JAM_ERROR("MappedFile::Open() - Failed to open file: {} ({})", _path.string(), GetSystemLastErrorMessage());
+        return false;
+    }
+
+    // 파일 크기 (빈 파일은 매핑할 수 없음)
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(m_hFile, &fileSize) || fileSize.QuadPart == 0)
+    {
+        JAM_ERROR("MappedFile::Open() - Empty or unreadable file: {}", _path.string());
+        Close();
+        return false;
+    }
+
+    // 매핑
+    m_hMapping = CreateFileMappingW(m_hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (m_hMapping == nullptr)
+    {
+        JAM_ERROR("MappedFile::Open() - Failed to create file mapping: {} ({})", _path.string(), GetSystemLastErrorMessage());
+        Close();
+        return false;
+    }
+
+    m_pData = static_cast<const UInt8*>(MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0));
+    if (m_pData == nullptr)
+    {
+        JAM_ERROR("MappedFile::Open() - Failed to map view of file: {} ({})", _path.string(), GetSystemLastErrorMessage());
+        Close();
+        return false;
+    }
+
+    m_byteWidth = static_cast<size_t>(fileSize.QuadPart);
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (m_pData)
+    {
+        UnmapViewOfFile(m_pData);
+        m_pData = nullptr;
+    }
+
+    if (m_hMapping)
+    {
+        CloseHandle(m_hMapping);
+        m_hMapping = nullptr;
+    }
+
+    if (m_hFile != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(m_hFile);
+        m_hFile = INVALID_HANDLE_VALUE;
+    }
+
+    m_byteWidth = 0;
+}
+
+}   // namespace jam
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+
+namespace jam
+{
+
+// 읽기 전용 메모리 맵 파일
+// 파일 내용을 복사하지 않고 span 으로 노출합니다. 파일이 닫히면 span 은 무효화됩니다.
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(MappedFile&& _other) noexcept;
+    MappedFile& operator=(MappedFile&& _other) noexcept;
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool Open(const fs::path& _path);
+    void Close();
+
+    NODISCARD std::span<const UInt8> GetData() const { return { m_pData, m_byteWidth }; }
+    NODISCARD size_t                 GetByteWidth() const { return m_byteWidth; }
+    NODISCARD bool                   IsOpen() const { return m_pData != nullptr; }
+
+private:
+    HANDLE       m_hFile     = INVALID_HANDLE_VALUE;
+    HANDLE       m_hMapping  = nullptr;
+    const UInt8* m_pData     = nullptr;
+    size_t       m_byteWidth = 0;
+};
+
+}   // namespace jam
\ No newline at end of file
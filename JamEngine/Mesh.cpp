@@ -7,48 +7,136 @@
 namespace jam
 {
 
-void Mesh::Initialize(const MeshData& _meshData, const eVertexType _vertexType, const eTopology _topology)
+eIndexFormat PackIndices(const std::span<const Index> _indices, const size_t _vertexCount, std::vector<UInt8>& _out_indices)
+{
+    const eIndexFormat format = SelectIndexFormat(_vertexCount);
+    _out_indices.resize(_indices.size() * GetIndexStride(format));
+    if (format == eIndexFormat::UInt16)
+    {
+        UInt16* pIndices = reinterpret_cast<UInt16*>(_out_indices.data());
+        std::ranges::transform(_indices, pIndices, [](const Index _index) { return static_cast<UInt16>(_index); });
+    }
+    else
+    {
+        std::memcpy(_out_indices.data(), _indices.data(), _indices.size_bytes());
+    }
+    return format;
+}
+
+bool Mesh::Initialize(const MeshData& _meshData, const eVertexType _vertexType, const eTopology _topology, const eGeometryRetention _retention, const VertexQuantization& _quantization)
 {
     UInt32                              stride   = GetVertexStride(_vertexType);
     const std::vector<VertexAttribute>& vertices = _meshData.vertices;
-    const std::vector<Index>&           indices  = _meshData.indices;
 
     UInt32 vertexCount = static_cast<UInt32>(vertices.size());
-    UInt32 indexCount  = static_cast<UInt32>(indices.size());
 
-    // vertex buffer
+    // vertex packing
+    std::vector<UInt8> vertexData(vertexCount * stride);
+    PackVertices(vertices, _vertexType, vertexData.data(), _quantization);
+
+    // index packing (16비트로 충분하다면 16비트)
+    std::vector<UInt8> indexData;
+    const eIndexFormat indexFormat = PackIndices(_meshData.indices, vertexCount, indexData);
+
+    PackedMeshData packedMeshData;
+    packedMeshData.vertices    = vertexData;
+    packedMeshData.indices     = indexData;
+    packedMeshData.indexFormat = indexFormat;
+    if (!Initialize(packedMeshData, _vertexType, _topology, eGeometryRetention::GpuOnly, _quantization))
+    {
+        return false;
+    }
+
+    // 패킹한 스트림은 복사 없이 그대로 보관
+    if (_retention == eGeometryRetention::CpuCopy)
+    {
+        m_cpuVertices = std::move(vertexData);
+        m_cpuIndices  = std::move(indexData);
+    }
+    return true;
+}
+
+bool Mesh::Initialize(const PackedMeshData& _packedMeshData, const eVertexType _vertexType, const eTopology _topology, const eGeometryRetention _retention, const VertexQuantization& _quantization)
+{
+    UInt32 stride = GetVertexStride(_vertexType);
+    JAM_ASSERT(_packedMeshData.vertices.size() % stride == 0, "Packed vertex stream size is not a multiple of vertex stride.");
+
+    UInt32 vertexCount = static_cast<UInt32>(_packedMeshData.vertices.size() / stride);
+    UInt32 indexCount  = _packedMeshData.GetIndexCount();
+
+    // 32비트 스트림이라도 정점 수가 허용하면 16비트로 줄임
+    std::span<const UInt8> indices     = _packedMeshData.indices;
+    eIndexFormat           indexFormat = _packedMeshData.indexFormat;
+    std::vector<UInt8>     narrowIndices;
+    if (indexFormat == eIndexFormat::UInt32 && SelectIndexFormat(vertexCount) == eIndexFormat::UInt16)
     {
-        // vertex packing
-        std::vector<UInt8> vertexData(vertexCount * stride);
-        for (UInt32 i = 0; i < vertexCount; ++i)
-        {
-            const VertexAttribute& vertex = vertices[i];
-            PackVertex(vertex, _vertexType, vertexData.data() + i * stride);
-        }
-
-        // initialize vertex buffer
-        BufferInitData initData;
-        initData.pData = vertexData.data();
-        m_vertexBuffer.Initialize(GetVertexStride(_vertexType), vertexCount, eResourceAccess::Immutable, initData);
+        const std::span<const Index> wideIndices(reinterpret_cast<const Index*>(indices.data()), indexCount);
+        indexFormat = PackIndices(wideIndices, vertexCount, narrowIndices);
+        indices     = narrowIndices;
     }
 
-    // index buffer
+    // 풀에서 정점 / 인덱스 구간을 할당
+    auto [pGeometry, bResult] = GeometryPool::GetGlobal().Allocate(_vertexType, _packedMeshData.vertices, indexFormat, indices);
+    if (!bResult)
     {
-        IndexBufferInitData initData;
-        initData.pData = indices.data();
-        m_indexBuffer.Initialize(indexCount, eResourceAccess::Immutable, initData);
+        JAM_ERROR("Failed to allocate mesh geometry from pool. vertices: {}, indices: {}", vertexCount, indexCount);
+        return false;
     }
+    m_pGeometry = std::move(pGeometry);
 
     // topology
-    m_topology   = _topology;
-    m_vertexType = _vertexType;
+    m_topology     = _topology;
+    m_vertexType   = _vertexType;
+    m_quantization = _quantization;
+
+    // CPU 사본
+    ReleaseCpuData();
+    if (_retention == eGeometryRetention::CpuCopy)
+    {
+        m_cpuVertices.assign(_packedMeshData.vertices.begin(), _packedMeshData.vertices.end());
+        m_cpuIndices.assign(indices.begin(), indices.end());
+    }
+    return true;
+}
+
+void Mesh::ReleaseCpuData()
+{
+    m_cpuVertices = std::vector<UInt8>();
+    m_cpuIndices  = std::vector<UInt8>();
+}
+
+CB_TRANSFORM Mesh::CreateTransform(const Mat4& _world) const
+{
+    CB_TRANSFORM transform;
+    transform.cb_transformWorldMat             = IsQuantizedVertexType(m_vertexType) ? m_quantization.CreateDequantizeMatrix() * _world : _world;
+    transform.cb_transformWorldInvTransposeMat = _world.Invert().Transpose();
+    return transform;
 }
 
 void Mesh::Bind() const
 {
-    m_vertexBuffer.Bind();
-    m_indexBuffer.Bind();
+    JAM_ASSERT(m_pGeometry, "Mesh is not initialized");
+    GeometryPool::GetGlobal().Bind(*m_pGeometry);
     Renderer::BindTopology(static_cast<D3D11_PRIMITIVE_TOPOLOGY>(m_topology));
 }
 
+void Mesh::Draw(const UInt32 _indexCount, const UInt32 _startIndex) const
+{
+    JAM_ASSERT(m_pGeometry, "Mesh is not initialized");
+    JAM_ASSERT(_startIndex + _indexCount <= m_pGeometry->indexCount, "Index range is out of mesh");
+    Renderer::DrawIndices(_indexCount, m_pGeometry->startIndex + _startIndex, static_cast<Int32>(m_pGeometry->baseVertex));
+}
+
+const VertexBuffer& Mesh::GetVertexBuffer() const
+{
+    JAM_ASSERT(m_pGeometry, "Mesh is not initialized");
+    return GeometryPool::GetGlobal().GetVertexBuffer(*m_pGeometry);
+}
+
+const IndexBuffer& Mesh::GetIndexBuffer() const
+{
+    JAM_ASSERT(m_pGeometry, "Mesh is not initialized");
+    return GeometryPool::GetGlobal().GetIndexBuffer(*m_pGeometry);
+}
+
 }   // namespace jam
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
-#include "Buffers.h"
+#include "GeometryPool.h"
+#include "ShaderBridge.h"
 #include "Vertex.h"
 
 namespace jam
@@ -11,23 +12,75 @@ struct MeshData
     std::vector<Index>           indices;    // index buffer
 };
 
+// GPU 레이아웃으로 이미 패킹된 메쉬 스트림 (메모리를 소유하지 않음)
+struct PackedMeshData
+{
+    std::span<const UInt8> vertices;                              // eVertexType 레이아웃의 정점 바이트
+    std::span<const UInt8> indices;                               // indexFormat 레이아웃의 인덱스 바이트
+    eIndexFormat           indexFormat = eIndexFormat::UInt32;
+
+    NODISCARD bool   IsEmpty() const { return vertices.empty(); }
+    NODISCARD UInt32 GetIndexCount() const { return static_cast<UInt32>(indices.size() / GetIndexStride(indexFormat)); }
+};
+
+// 정점 수로 표현 가능한 가장 좁은 포맷으로 인덱스를 패킹
+NODISCARD eIndexFormat PackIndices(std::span<const Index> _indices, size_t _vertexCount, std::vector<UInt8>& _out_indices);
+
+// 메쉬 초기화 후 CPU 측 기하 데이터를 유지할지 여부
+enum class eGeometryRetention
+{
+    GpuOnly,   // GPU 버퍼만 유지
+    CpuCopy,   // GPU 레이아웃의 정점/인덱스 스트림 사본을 유지 (익스포트, 피킹, 물리, 베이킹 등)
+};
+
+// 전역 GeometryPool 의 구간을 참조하는 메쉬 (복사 시 같은 구간을 공유)
 class Mesh
 {
 public:
-    void Initialize(const MeshData& _meshData, eVertexType _vertexType, eTopology _topology);
+    // GeometryPool 할당에 실패하면 false (메쉬는 변경되지 않음)
+    NODISCARD bool Initialize(const MeshData& _meshData, eVertexType _vertexType, eTopology _topology, eGeometryRetention _retention = eGeometryRetention::GpuOnly, const VertexQuantization& _quantization = {});
+    NODISCARD bool Initialize(const PackedMeshData& _packedMeshData, eVertexType _vertexType, eTopology _topology, eGeometryRetention _retention = eGeometryRetention::GpuOnly, const VertexQuantization& _quantization = {});
     void Bind() const;
 
-    const VertexBuffer& GetVertexBuffer() const { return m_vertexBuffer; }
-    const IndexBuffer&  GetIndexBuffer() const { return m_indexBuffer; }
+    // Bind() 이후 호출. _startIndex 는 메쉬 기준 오프셋 (MeshLod, IndexRange)
+    // LOD 체인은 LOD0 뒤에 이어서 기록되어 GetIndexCount() 가 모든 레벨을 포함하므로 범위는 항상 명시함 (Model::Node::GetLod)
+    void Draw(UInt32 _indexCount, UInt32 _startIndex = 0) const;
+
+    // 풀 페이지 버퍼 (다른 메쉬와 공유되므로 GetBaseVertex / GetStartIndex 구간만 이 메쉬의 것)
+    NODISCARD const VertexBuffer& GetVertexBuffer() const;
+    NODISCARD const IndexBuffer&  GetIndexBuffer() const;
+
+    NODISCARD bool         IsValid() const { return m_pGeometry != nullptr; }
+    NODISCARD UInt32       GetBaseVertex() const { return m_pGeometry ? m_pGeometry->baseVertex : 0; }
+    NODISCARD UInt32       GetStartIndex() const { return m_pGeometry ? m_pGeometry->startIndex : 0; }
+    NODISCARD UInt32       GetVertexCount() const { return m_pGeometry ? m_pGeometry->vertexCount : 0; }
+    NODISCARD UInt32       GetIndexCount() const { return m_pGeometry ? m_pGeometry->indexCount : 0; }
+    NODISCARD eIndexFormat GetIndexFormat() const { return m_pGeometry ? m_pGeometry->indexFormat : eIndexFormat::UInt32; }
+
+    // CPU 사본 (eGeometryRetention::CpuCopy 로 초기화한 경우에만 존재)
+    NODISCARD bool           HasCpuData() const { return !m_cpuVertices.empty(); }
+    NODISCARD PackedMeshData GetCpuData() const { return { m_cpuVertices, m_cpuIndices, GetIndexFormat() }; }
+    void                     ReleaseCpuData();
 
     void                  SetTopology(const eTopology _topology) { m_topology = _topology; }
     NODISCARD eTopology   GetTopology() const { return m_topology; }
     NODISCARD eVertexType GetVertexType() const { return m_vertexType; }
 
+    // 양자화 정점 타입의 위치 복원 변환 (CreateTransform 이 월드 행렬 앞에 곱함)
+    NODISCARD const VertexQuantization& GetVertexQuantization() const { return m_quantization; }
+
+    // 이 메쉬를 그릴 때 올릴 CB_TRANSFORM
+    // 양자화 정점 타입은 월드 행렬에 역양자화 행렬을 접고, 역전치 행렬은 원래 월드 행렬로 만듦 (법선/탄젠트는 모델 공간 방향)
+    NODISCARD CB_TRANSFORM CreateTransform(const Mat4& _world) const;
+
 private:
-    VertexBuffer m_vertexBuffer;
-    IndexBuffer  m_indexBuffer;
-    eVertexType  m_vertexType = eVertexType::Vertex3;
+    Ref<const GeometryAllocation> m_pGeometry;
+    eVertexType                   m_vertexType = eVertexType::Vertex3;
+
+    VertexQuantization m_quantization;
+
+    std::vector<UInt8> m_cpuVertices;
+    std::vector<UInt8> m_cpuIndices;   // 인덱스 버퍼와 같은 포맷
 
     // 토폴로지는 변경할 수 있음
     eTopology m_topology = eTopology::TriangleList;
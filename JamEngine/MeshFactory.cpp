@@ -2,6 +2,10 @@
 
 #include "MeshFactory.h"
 
+#include "MeshOptimizer.h"
+#include "TangentGenerator.h"
+#include "VertexTransform.h"
+
 #include <algorithm>
 
 namespace jam
@@ -45,30 +49,6 @@ MeshData CreatePlaneMesh(float _width, float _height, const Mat4& _transform)
     v1.tangent = v2.tangent = v3.tangent = v4.tangent = Vec3(1.0f, 0.0f, 0.0f);
     v1.bitangent = v2.bitangent = v3.bitangent = v4.bitangent = Vec3(0.0f, 0.0f, -1.0f);
 
-    // 변환 적용
-    if (_transform != Mat4::Identity)
-    {
-        v1.position = Vec3::Transform(v1.position, _transform);
-        v2.position = Vec3::Transform(v2.position, _transform);
-        v3.position = Vec3::Transform(v3.position, _transform);
-        v4.position = Vec3::Transform(v4.position, _transform);
-
-        v1.normal = Vec3::TransformNormal(v1.normal, _transform);
-        v2.normal = Vec3::TransformNormal(v2.normal, _transform);
-        v3.normal = Vec3::TransformNormal(v3.normal, _transform);
-        v4.normal = Vec3::TransformNormal(v4.normal, _transform);
-
-        v1.tangent = Vec3::TransformNormal(v1.tangent, _transform);
-        v2.tangent = Vec3::TransformNormal(v2.tangent, _transform);
-        v3.tangent = Vec3::TransformNormal(v3.tangent, _transform);
-        v4.tangent = Vec3::TransformNormal(v4.tangent, _transform);
-
-        v1.bitangent = Vec3::TransformNormal(v1.bitangent, _transform);
-        v2.bitangent = Vec3::TransformNormal(v2.bitangent, _transform);
-        v3.bitangent = Vec3::TransformNormal(v3.bitangent, _transform);
-        v4.bitangent = Vec3::TransformNormal(v4.bitangent, _transform);
-    }
-
     // 정점 추가
     mesh.vertices = { v1, v2, v3, v4 };
 
@@ -82,6 +62,9 @@ MeshData CreatePlaneMesh(float _width, float _height, const Mat4& _transform)
 
     // clang-format on
 
+    // 변환 적용
+    TransformVertices(mesh.vertices, _transform);
+
     return mesh;
 }
 MeshData CreateCubeMesh(const float _width, const float _height, const float _depth, const Mat4& _transform)
@@ -167,15 +150,6 @@ MeshData CreateCubeMesh(const float _width, const float _height, const float _de
             vertex.tangent          = tangents[face];
             vertex.bitangent        = bitangents[face];
 
-            // 변환 적용
-            if (_transform != Mat4::Identity)
-            {
-                vertex.position  = Vec3::Transform(vertex.position, _transform);
-                vertex.normal    = Vec3::TransformNormal(vertex.normal, _transform);
-                vertex.tangent   = Vec3::TransformNormal(vertex.tangent, _transform);
-                vertex.bitangent = Vec3::TransformNormal(vertex.bitangent, _transform);
-            }
-
             mesh.vertices.push_back(vertex);
         }
 
@@ -189,6 +163,9 @@ MeshData CreateCubeMesh(const float _width, const float _height, const float _de
         mesh.indices.push_back(baseIndex + 2);
     }
 
+    // 변환 적용
+    TransformVertices(mesh.vertices, _transform);
+
     return mesh;
 }
 
@@ -240,15 +217,6 @@ MeshData CreateSphereMesh(const float _radius, UInt32 _segments, UInt32 _rings,
 
             vertex.color = Vec3(1.0f, 1.0f, 1.0f);
 
-            // 변환 적용
-            if (_transform != Mat4::Identity)
-            {
-                vertex.position  = Vec3::Transform(vertex.position, _transform);
-                vertex.normal    = Vec3::TransformNormal(vertex.normal, _transform);
-                vertex.tangent   = Vec3::TransformNormal(vertex.tangent, _transform);
-                vertex.bitangent = Vec3::TransformNormal(vertex.bitangent, _transform);
-            }
-
             mesh.vertices.push_back(vertex);
         }
     }
@@ -280,6 +248,12 @@ MeshData CreateSphereMesh(const float _radius, UInt32 _segments, UInt32 _rings,
         }
     }
 
+    // GPU 캐시 효율을 위해 삼각형 / 정점 순서 최적화
+    OptimizeMesh(mesh);
+
+    // 변환 적용
+    TransformVertices(mesh.vertices, _transform);
+
     return mesh;
 }
 
@@ -309,20 +283,6 @@ MeshData CreateCylinderMesh(float _radius, float _height, UInt32 _segments, cons
     bottomCenter.bitangent              = Vec3(0.0f, 0.0f, 1.0f);
     bottomCenter.color                  = Vec3(1.0f, 1.0f, 1.0f);
 
-    // 변환 적용
-    if (_transform != Mat4::Identity)
-    {
-        topCenter.position  = Vec3::Transform(topCenter.position, _transform);
-        topCenter.normal    = Vec3::TransformNormal(topCenter.normal, _transform);
-        topCenter.tangent   = Vec3::TransformNormal(topCenter.tangent, _transform);
-        topCenter.bitangent = Vec3::TransformNormal(topCenter.bitangent, _transform);
-
-        bottomCenter.position  = Vec3::Transform(bottomCenter.position, _transform);
-        bottomCenter.normal    = Vec3::TransformNormal(bottomCenter.normal, _transform);
-        bottomCenter.tangent   = Vec3::TransformNormal(bottomCenter.tangent, _transform);
-        bottomCenter.bitangent = Vec3::TransformNormal(bottomCenter.bitangent, _transform);
-    }
-
     mesh.vertices.push_back(topCenter);      // 정점 0
     mesh.vertices.push_back(bottomCenter);   // 정점 1
 
@@ -371,30 +331,6 @@ MeshData CreateCylinderMesh(float _radius, float _height, UInt32 _segments, cons
         sideBottom.bitangent            = sideTop.bitangent;
         sideBottom.color                = Vec3(1.0f, 1.0f, 1.0f);
 
-        // 변환 적용
-        if (_transform != Mat4::Identity)
-        {
-            topRim.position  = Vec3::Transform(topRim.position, _transform);
-            topRim.normal    = Vec3::TransformNormal(topRim.normal, _transform);
-            topRim.tangent   = Vec3::TransformNormal(topRim.tangent, _transform);
-            topRim.bitangent = Vec3::TransformNormal(topRim.bitangent, _transform);
-
-            bottomRim.position  = Vec3::Transform(bottomRim.position, _transform);
-            bottomRim.normal    = Vec3::TransformNormal(bottomRim.normal, _transform);
-            bottomRim.tangent   = Vec3::TransformNormal(bottomRim.tangent, _transform);
-            bottomRim.bitangent = Vec3::TransformNormal(bottomRim.bitangent, _transform);
-
-            sideTop.position  = Vec3::Transform(sideTop.position, _transform);
-            sideTop.normal    = Vec3::TransformNormal(sideTop.normal, _transform);
-            sideTop.tangent   = Vec3::TransformNormal(sideTop.tangent, _transform);
-            sideTop.bitangent = Vec3::TransformNormal(sideTop.bitangent, _transform);
-
-            sideBottom.position  = Vec3::Transform(sideBottom.position, _transform);
-            sideBottom.normal    = Vec3::TransformNormal(sideBottom.normal, _transform);
-            sideBottom.tangent   = Vec3::TransformNormal(sideBottom.tangent, _transform);
-            sideBottom.bitangent = Vec3::TransformNormal(sideBottom.bitangent, _transform);
-        }
-
         mesh.vertices.push_back(topRim);       // 정점 2
         mesh.vertices.push_back(bottomRim);    // 정점 3
         mesh.vertices.push_back(sideTop);      // 정점 4
@@ -426,6 +362,9 @@ MeshData CreateCylinderMesh(float _radius, float _height, UInt32 _segments, cons
         mesh.indices.push_back(5 + 4 * (i + 1));
     }
 
+    // 변환 적용
+    TransformVertices(mesh.vertices, _transform);
+
     return mesh;
 }
 
@@ -454,20 +393,6 @@ MeshData CreateConeMesh(float _radius, float _height, UInt32 _segments, const Ma
     bottomCenter.bitangent              = Vec3(0.0f, 0.0f, 1.0f);
     bottomCenter.color                  = Vec3(1.0f, 1.0f, 1.0f);
 
-    // 변환 적용
-    if (_transform != Mat4::Identity)
-    {
-        apex.position  = Vec3::Transform(apex.position, _transform);
-        apex.normal    = Vec3::TransformNormal(apex.normal, _transform);
-        apex.tangent   = Vec3::TransformNormal(apex.tangent, _transform);
-        apex.bitangent = Vec3::TransformNormal(apex.bitangent, _transform);
-
-        bottomCenter.position  = Vec3::Transform(bottomCenter.position, _transform);
-        bottomCenter.normal    = Vec3::TransformNormal(bottomCenter.normal, _transform);
-        bottomCenter.tangent   = Vec3::TransformNormal(bottomCenter.tangent, _transform);
-        bottomCenter.bitangent = Vec3::TransformNormal(bottomCenter.bitangent, _transform);
-    }
-
     mesh.vertices.push_back(apex);           // 정점 0
     mesh.vertices.push_back(bottomCenter);   // 정점 1
 
@@ -503,20 +428,6 @@ MeshData CreateConeMesh(float _radius, float _height, UInt32 _segments, const Ma
         side.bitangent = side.normal.Cross(side.tangent);
         side.color     = Vec3(1.0f, 1.0f, 1.0f);
 
-        // 변환 적용
-        if (_transform != Mat4::Identity)
-        {
-            bottomRim.position  = Vec3::Transform(bottomRim.position, _transform);
-            bottomRim.normal    = Vec3::TransformNormal(bottomRim.normal, _transform);
-            bottomRim.tangent   = Vec3::TransformNormal(bottomRim.tangent, _transform);
-            bottomRim.bitangent = Vec3::TransformNormal(bottomRim.bitangent, _transform);
-
-            side.position  = Vec3::Transform(side.position, _transform);
-            side.normal    = Vec3::TransformNormal(side.normal, _transform);
-            side.tangent   = Vec3::TransformNormal(side.tangent, _transform);
-            side.bitangent = Vec3::TransformNormal(side.bitangent, _transform);
-        }
-
         mesh.vertices.push_back(bottomRim);   // 정점 2+2i
         mesh.vertices.push_back(side);        // 정점 3+2i
     }
@@ -535,6 +446,9 @@ MeshData CreateConeMesh(float _radius, float _height, UInt32 _segments, const Ma
         mesh.indices.push_back(3 + 2 * i);         // 현재 옆면 정점
     }
 
+    // 변환 적용
+    TransformVertices(mesh.vertices, _transform);
+
     return mesh;
 }
 
@@ -603,15 +517,6 @@ MeshData CreateCapsuleMesh(float _radius, float _height, UInt32 _segments, UInt3
 
             vertex.color = Vec3(1.0f, 1.0f, 1.0f);
 
-            // 변환 적용
-            if (_transform != Mat4::Identity)
-            {
-                vertex.position  = Vec3::Transform(vertex.position, _transform);
-                vertex.normal    = Vec3::TransformNormal(vertex.normal, _transform);
-                vertex.tangent   = Vec3::TransformNormal(vertex.tangent, _transform);
-                vertex.bitangent = Vec3::TransformNormal(vertex.bitangent, _transform);
-            }
-
             mesh.vertices.push_back(vertex);
         }
     }
@@ -662,15 +567,6 @@ MeshData CreateCapsuleMesh(float _radius, float _height, UInt32 _segments, UInt3
 
                 vertex.color = Vec3(1.0f, 1.0f, 1.0f);
 
-                // 변환 적용
-                if (_transform != Mat4::Identity)
-                {
-                    vertex.position  = Vec3::Transform(vertex.position, _transform);
-                    vertex.normal    = Vec3::TransformNormal(vertex.normal, _transform);
-                    vertex.tangent   = Vec3::TransformNormal(vertex.tangent, _transform);
-                    vertex.bitangent = Vec3::TransformNormal(vertex.bitangent, _transform);
-                }
-
                 mesh.vertices.push_back(vertex);
             }
         }
@@ -724,15 +620,6 @@ MeshData CreateCapsuleMesh(float _radius, float _height, UInt32 _segments, UInt3
 
             vertex.color = Vec3(1.0f, 1.0f, 1.0f);
 
-            // 변환 적용
-            if (_transform != Mat4::Identity)
-            {
-                vertex.position  = Vec3::Transform(vertex.position, _transform);
-                vertex.normal    = Vec3::TransformNormal(vertex.normal, _transform);
-                vertex.tangent   = Vec3::TransformNormal(vertex.tangent, _transform);
-                vertex.bitangent = Vec3::TransformNormal(vertex.bitangent, _transform);
-            }
-
             mesh.vertices.push_back(vertex);
         }
     }
@@ -812,6 +699,12 @@ MeshData CreateCapsuleMesh(float _radius, float _height, UInt32 _segments, UInt3
         }
     }
 
+    // GPU 캐시 효율을 위해 삼각형 / 정점 순서 최적화
+    OptimizeMesh(mesh);
+
+    // 변환 적용
+    TransformVertices(mesh.vertices, _transform);
+
     return mesh;
 }
 
@@ -846,12 +739,6 @@ MeshData CreateGridMesh(const float _width, const float _height, UInt32 _rows, U
             // 법선 벡터 (위로 향함)
             vertex.normal = Vec3(0.0f, 1.0f, 0.0f);
 
-            // 접선 벡터 (X 방향)
-            vertex.tangent = Vec3(1.0f, 0.0f, 0.0f);
-
-            // 종법선 벡터 (Z 방향 - 왼손 좌표계에서는 음의 Z)
-            vertex.bitangent = Vec3(0.0f, 0.0f, -1.0f);
-
             // 텍스처 좌표
             vertex.uv0 = vertex.uv1 = Vec2(
                 static_cast<float>(col) / _columns,
@@ -859,15 +746,6 @@ MeshData CreateGridMesh(const float _width, const float _height, UInt32 _rows, U
 
             vertex.color = Vec3(1.0f, 1.0f, 1.0f);
 
-            // 변환 적용
-            if (_transform != Mat4::Identity)
-            {
-                vertex.position  = Vec3::Transform(vertex.position, _transform);
-                vertex.normal    = Vec3::TransformNormal(vertex.normal, _transform);
-                vertex.tangent   = Vec3::TransformNormal(vertex.tangent, _transform);
-                vertex.bitangent = Vec3::TransformNormal(vertex.bitangent, _transform);
-            }
-
             mesh.vertices.push_back(vertex);
         }
     }
@@ -896,7 +774,48 @@ MeshData CreateGridMesh(const float _width, const float _height, UInt32 _rows, U
         }
     }
 
+    // 탄젠트 공간 (UV 방향을 따름)
+    GenerateTangents(mesh);
+
+    // GPU 캐시 효율을 위해 삼각형 / 정점 순서 최적화
+    OptimizeMesh(mesh);
+
+    // 변환 적용
+    TransformVertices(mesh.vertices, _transform);
+
     return mesh;
 }
 
+MeshData MergeMeshData(const std::span<const MeshData> _meshes, const std::span<const Mat4> _transforms)
+{
+    JAM_ASSERT(_meshes.size() == _transforms.size(), "MergeMeshData() - Mesh and transform count mismatch");
+
+    size_t vertexCount = 0;
+    size_t indexCount  = 0;
+    for (const MeshData& meshData: _meshes)
+    {
+        vertexCount += meshData.vertices.size();
+        indexCount += meshData.indices.size();
+    }
+
+    MeshData merged;
+    merged.vertices.reserve(vertexCount);
+    merged.indices.reserve(indexCount);
+    for (size_t i = 0; i < _meshes.size(); ++i)
+    {
+        const MeshData& meshData   = _meshes[i];
+        const Index     baseVertex = static_cast<Index>(merged.vertices.size());
+
+        // 추가한 구간만 일괄 변환
+        merged.vertices.insert(merged.vertices.end(), meshData.vertices.begin(), meshData.vertices.end());
+        TransformVertices(std::span(merged.vertices).subspan(baseVertex), _transforms[i]);
+
+        for (const Index index: meshData.indices)
+        {
+            merged.indices.push_back(baseVertex + index);
+        }
+    }
+    return merged;
+}
+
 }   // namespace jam
\ No newline at end of file
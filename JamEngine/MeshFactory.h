@@ -12,4 +12,7 @@ MeshData CreateConeMesh(float _radius, float _height, UInt32 _segments, const Ma
 MeshData CreateCapsuleMesh(float _radius, float _height, UInt32 _segments, UInt32 _rings, const Mat4& _transform = Mat4::Identity);
 MeshData CreateGridMesh(float _width, float _height, UInt32 _rows, UInt32 _columns, const Mat4& _transform = Mat4::Identity);
 
+// 정적 메쉬 병합 - 각 메쉬를 해당 변환으로 구워 하나의 메쉬로 합침
+MeshData MergeMeshData(std::span<const MeshData> _meshes, std::span<const Mat4> _transforms);
+
 }   // namespace jam
\ No newline at end of file
@@ -0,0 +1,382 @@
+#include "pch.h"
+
+#include "MeshOptimizer.h"
+
+namespace
+{
+
+using namespace jam;
+
+// 정점 -> 인접 삼각형 목록 (CSR)
+struct TriangleAdjacency
+{
+    std::vector<UInt32> offsets;     // 정점별 시작 위치 (vertexCount + 1)
+    std::vector<UInt32> triangles;   // 삼각형 인덱스
+};
+
+NODISCARD TriangleAdjacency BuildTriangleAdjacency(const std::span<const Index> _indices, const UInt32 _vertexCount)
+{
+    TriangleAdjacency adjacency;
+    adjacency.offsets.assign(_vertexCount + 1, 0);
+    for (const Index index: _indices)
+    {
+        ++adjacency.offsets[index + 1];
+    }
+    for (UInt32 i = 0; i < _vertexCount; ++i)
+    {
+        adjacency.offsets[i + 1] += adjacency.offsets[i];
+    }
+
+    std::vector<UInt32> cursors(adjacency.offsets.begin(), adjacency.offsets.end() - 1);
+    adjacency.triangles.resize(_indices.size());
+    for (size_t i = 0; i < _indices.size(); ++i)
+    {
+        adjacency.triangles[cursors[_indices[i]]++] = static_cast<UInt32>(i / 3);
+    }
+    return adjacency;
+}
+
+// 타임스탬프 기반 FIFO 캐시
+class VertexCacheSimulator
+{
+public:
+    VertexCacheSimulator(const UInt32 _vertexCount, const UInt32 _cacheSize)
+        : m_timestamps(_vertexCount, 0)
+        , m_cacheSize(_cacheSize)
+        , m_time(_cacheSize + 1)
+    {
+    }
+
+    // 미스라면 true
+    bool Access(const Index _vertex)
+    {
+        if (m_time - m_timestamps[_vertex] > m_cacheSize)
+        {
+            m_timestamps[_vertex] = m_time++;
+            return true;
+        }
+        return false;
+    }
+
+    // 캐시 비우기
+    void Flush() { m_time += m_cacheSize + 1; }
+
+private:
+    std::vector<UInt32> m_timestamps;
+    UInt32              m_cacheSize;
+    UInt32              m_time;
+};
+
+NODISCARD Vec3 ComputeTriangleNormal(const Vec3& _a, const Vec3& _b, const Vec3& _c)
+{
+    return (_b - _a).Cross(_c - _a);   // 길이는 삼각형 넓이의 2배
+}
+
+}   // namespace
+
+namespace jam
+{
+
+VertexCacheStats AnalyzeVertexCache(const std::span<const Index> _indices, const UInt32 _vertexCount, const UInt32 _cacheSize)
+{
+    JAM_ASSERT(_indices.size() % 3 == 0, "AnalyzeVertexCache() - Index count must be a multiple of 3");
+
+    VertexCacheStats     stats;
+    VertexCacheSimulator cache(_vertexCount, _cacheSize);
+    std::vector<bool>    referenced(_vertexCount, false);
+    UInt32               missCount       = 0;
+    UInt32               referencedCount = 0;
+    for (const Index index: _indices)
+    {
+        missCount += cache.Access(index) ? 1 : 0;
+        if (!referenced[index])
+        {
+            referenced[index] = true;
+            ++referencedCount;
+        }
+    }
+
+    if (!_indices.empty())
+    {
+        stats.acmr = static_cast<float>(missCount) / static_cast<float>(_indices.size() / 3);
+        stats.atvr = static_cast<float>(missCount) / static_cast<float>(referencedCount);
+    }
+    return stats;
+}
+
+void OptimizeVertexCache(const std::span<Index> _indices, const UInt32 _vertexCount, const UInt32 _cacheSize)
+{
+    JAM_ASSERT(_indices.size() % 3 == 0, "OptimizeVertexCache() - Index count must be a multiple of 3");
+    if (_indices.empty())
+    {
+        return;
+    }
+
+    // Tipsify (Sander et al. 2007)
+    const TriangleAdjacency adjacency     = BuildTriangleAdjacency(_indices, _vertexCount);
+    const UInt32            triangleCount = static_cast<UInt32>(_indices.size() / 3);
+
+    std::vector<UInt32> liveCounts(_vertexCount);
+    for (UInt32 i = 0; i < _vertexCount; ++i)
+    {
+        liveCounts[i] = adjacency.offsets[i + 1] - adjacency.offsets[i];
+    }
+
+    std::vector<UInt32> timestamps(_vertexCount, 0);
+    std::vector<bool>   emitted(triangleCount, false);
+    std::vector<Index>  deadEnds;
+    std::vector<Index>  candidates;
+    std::vector<Index>  result;
+    result.reserve(_indices.size());
+
+    UInt32 time      = _cacheSize + 1;
+    UInt32 cursor    = 0;
+    Int64  fanVertex = 0;
+    while (fanVertex >= 0)
+    {
+        // 팬 정점에 인접한 삼각형을 모두 출력
+        candidates.clear();
+        for (UInt32 i = adjacency.offsets[fanVertex]; i < adjacency.offsets[fanVertex + 1]; ++i)
+        {
+            const UInt32 triangle = adjacency.triangles[i];
+            if (emitted[triangle])
+            {
+                continue;
+            }
+
+            for (UInt32 k = 0; k < 3; ++k)
+            {
+                const Index vertex = _indices[triangle * 3 + k];
+                result.push_back(vertex);
+                deadEnds.push_back(vertex);
+                candidates.push_back(vertex);
+                --liveCounts[vertex];
+                if (time - timestamps[vertex] > _cacheSize)
+                {
+                    timestamps[vertex] = time++;
+                }
+            }
+            emitted[triangle] = true;
+        }
+
+        // 다음 팬 정점 - 캐시에 남아있을 정점 중 가장 오래된 정점
+        Int64 bestVertex   = -1;
+        Int64 bestPriority = -1;
+        for (const Index vertex: candidates)
+        {
+            if (liveCounts[vertex] == 0)
+            {
+                continue;
+            }
+
+            Int64 priority = 0;
+            if (time - timestamps[vertex] + 2 * liveCounts[vertex] <= _cacheSize)
+            {
+                priority = time - timestamps[vertex];
+            }
+            if (priority > bestPriority)
+            {
+                bestPriority = priority;
+                bestVertex   = vertex;
+            }
+        }
+
+        // 막다른 곳 - 최근 출력된 정점, 그마저 없다면 아직 남은 정점을 순서대로 탐색
+        while (bestVertex < 0 && !deadEnds.empty())
+        {
+            const Index vertex = deadEnds.back();
+            deadEnds.pop_back();
+            if (liveCounts[vertex] > 0)
+            {
+                bestVertex = vertex;
+            }
+        }
+        while (bestVertex < 0 && cursor < _vertexCount)
+        {
+            if (liveCounts[cursor] > 0)
+            {
+                bestVertex = cursor;
+            }
+            ++cursor;
+        }
+        fanVertex = bestVertex;
+    }
+
+    JAM_ASSERT(result.size() == _indices.size(), "OptimizeVertexCache() - Triangle count mismatch");
+    std::ranges::copy(result, _indices.begin());
+}
+
+void OptimizeOverdraw(const std::span<Index> _indices, const std::span<const VertexAttribute> _vertices, const float _threshold, const UInt32 _cacheSize)
+{
+    JAM_ASSERT(_indices.size() % 3 == 0, "OptimizeOverdraw() - Index count must be a multiple of 3");
+    if (_indices.empty() || _threshold <= 1.f)
+    {
+        return;
+    }
+
+    const UInt32 vertexCount   = static_cast<UInt32>(_vertices.size());
+    const UInt32 triangleCount = static_cast<UInt32>(_indices.size() / 3);
+
+    // 하드 경계 - 세 정점이 모두 미스인 삼각형 (캐시가 비워진 지점)
+    std::vector<UInt32> hardBoundaries;
+    {
+        VertexCacheSimulator cache(vertexCount, _cacheSize);
+        for (UInt32 t = 0; t < triangleCount; ++t)
+        {
+            const UInt32 missCount = cache.Access(_indices[t * 3 + 0]) + cache.Access(_indices[t * 3 + 1]) + cache.Access(_indices[t * 3 + 2]);
+            if (t == 0 || missCount == 3)
+            {
+                hardBoundaries.push_back(t);
+            }
+        }
+        hardBoundaries.push_back(triangleCount);
+    }
+
+    // 소프트 경계 - 클러스터의 ACMR 이 허용 범위 안에 있는 지점에서 추가로 분할
+    std::vector<UInt32> clusters;
+    {
+        VertexCacheSimulator cache(vertexCount, _cacheSize);
+        for (size_t h = 0; h + 1 < hardBoundaries.size(); ++h)
+        {
+            const UInt32 begin = hardBoundaries[h];
+            const UInt32 end   = hardBoundaries[h + 1];
+
+            cache.Flush();
+            UInt32 hardMissCount = 0;
+            for (UInt32 t = begin; t < end; ++t)
+            {
+                hardMissCount += cache.Access(_indices[t * 3 + 0]) + cache.Access(_indices[t * 3 + 1]) + cache.Access(_indices[t * 3 + 2]);
+            }
+            const float allowedAcmr = static_cast<float>(hardMissCount) / static_cast<float>(end - begin) * _threshold;
+
+            cache.Flush();
+            UInt32 clusterBegin = begin;
+            UInt32 missCount    = 0;
+            clusters.push_back(begin);
+            for (UInt32 t = begin; t < end; ++t)
+            {
+                missCount += cache.Access(_indices[t * 3 + 0]) + cache.Access(_indices[t * 3 + 1]) + cache.Access(_indices[t * 3 + 2]);
+                if (t + 1 < end && static_cast<float>(missCount) / static_cast<float>(t + 1 - clusterBegin) <= allowedAcmr)
+                {
+                    clusterBegin = t + 1;
+                    missCount    = 0;
+                    cache.Flush();
+                    clusters.push_back(clusterBegin);
+                }
+            }
+        }
+        clusters.push_back(triangleCount);
+    }
+
+    // 메쉬 중심
+    Vec3  meshCentroid = Vec3::Zero;
+    float meshArea     = 0.f;
+    for (UInt32 t = 0; t < triangleCount; ++t)
+    {
+        const Vec3& a    = _vertices[_indices[t * 3 + 0]].position;
+        const Vec3& b    = _vertices[_indices[t * 3 + 1]].position;
+        const Vec3& c    = _vertices[_indices[t * 3 + 2]].position;
+        const float area = ComputeTriangleNormal(a, b, c).Length();
+        meshCentroid += (a + b + c) * (area / 3.f);
+        meshArea += area;
+    }
+    meshCentroid = meshArea > 0.f ? meshCentroid / meshArea : Vec3::Zero;
+
+    // 클러스터 정렬 키 - 바깥을 향하는 정도 (큰 값부터 그림)
+    const size_t        clusterCount = clusters.size() - 1;
+    std::vector<float>  sortKeys(clusterCount);
+    std::vector<UInt32> order(clusterCount);
+    for (size_t i = 0; i < clusterCount; ++i)
+    {
+        Vec3  centroid = Vec3::Zero;
+        Vec3  normal   = Vec3::Zero;
+        float area     = 0.f;
+        for (UInt32 t = clusters[i]; t < clusters[i + 1]; ++t)
+        {
+            const Vec3& a          = _vertices[_indices[t * 3 + 0]].position;
+            const Vec3& b          = _vertices[_indices[t * 3 + 1]].position;
+            const Vec3& c          = _vertices[_indices[t * 3 + 2]].position;
+            const Vec3  faceNormal = ComputeTriangleNormal(a, b, c);
+            const float faceArea   = faceNormal.Length();
+            centroid += (a + b + c) * (faceArea / 3.f);
+            normal += faceNormal;
+            area += faceArea;
+        }
+
+        centroid = area > 0.f ? centroid / area : centroid;
+        normal.Normalize();
+        sortKeys[i] = (centroid - meshCentroid).Dot(normal);
+        order[i]    = static_cast<UInt32>(i);
+    }
+    std::ranges::stable_sort(order, [&](const UInt32 _lhs, const UInt32 _rhs) { return sortKeys[_lhs] > sortKeys[_rhs]; });
+
+    // 재배치
+    std::vector<Index> result;
+    result.reserve(_indices.size());
+    for (const UInt32 cluster: order)
+    {
+        result.insert(result.end(), _indices.begin() + clusters[cluster] * 3, _indices.begin() + clusters[cluster + 1] * 3);
+    }
+    std::ranges::copy(result, _indices.begin());
+}
+
+void OptimizeVertexFetch(MeshData& _meshData)
+{
+    const UInt32 vertexCount = static_cast<UInt32>(_meshData.vertices.size());
+
+    // 처음 참조되는 순서대로 새 인덱스 부여
+    constexpr UInt32    k_unassigned = std::numeric_limits<UInt32>::max();
+    std::vector<UInt32> remap(vertexCount, k_unassigned);
+    UInt32              nextVertex = 0;
+    for (Index& index: _meshData.indices)
+    {
+        if (remap[index] == k_unassigned)
+        {
+            remap[index] = nextVertex++;
+        }
+        index = remap[index];
+    }
+
+    // 참조되지 않는 정점은 뒤로 보냄 (정점 수는 유지)
+    for (UInt32& newIndex: remap)
+    {
+        if (newIndex == k_unassigned)
+        {
+            newIndex = nextVertex++;
+        }
+    }
+
+    std::vector<VertexAttribute> vertices(vertexCount);
+    for (UInt32 i = 0; i < vertexCount; ++i)
+    {
+        vertices[remap[i]] = _meshData.vertices[i];
+    }
+    _meshData.vertices = std::move(vertices);
+}
+
+MeshOptimizeReport OptimizeMesh(MeshData& _meshData, const MeshOptimizeDesc& _desc)
+{
+    const UInt32       vertexCount = static_cast<UInt32>(_meshData.vertices.size());
+    MeshOptimizeReport report;
+    report.before = AnalyzeVertexCache(_meshData.indices, vertexCount, _desc.cacheSize);
+
+    if (_desc.bVertexCache)
+    {
+        OptimizeVertexCache(_meshData.indices, vertexCount, _desc.cacheSize);
+    }
+
+    if (_desc.bOverdraw)
+    {
+        OptimizeOverdraw(_meshData.indices, _meshData.vertices, _desc.overdrawThreshold, _desc.cacheSize);
+    }
+
+    if (_desc.bVertexFetch)
+    {
+        OptimizeVertexFetch(_meshData);
+    }
+
+    report.after = AnalyzeVertexCache(_meshData.indices, vertexCount, _desc.cacheSize);
+    return report;
+}
+
+}   // namespace jam
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+#include "Mesh.h"
+
+namespace jam
+{
+
+// 메쉬 최적화 (삼각형 리스트 전용)
+// 1. 정점 캐시 - 변환된 정점의 재사용이 늘어나도록 삼각형 순서를 변경 (Tipsify)
+// 2. 오버드로우 - 캐시 효율을 크게 해치지 않는 선에서 바깥을 향하는 클러스터를 먼저 그림
+// 3. 정점 페치 - 인덱스가 처음 참조하는 순서대로 정점을 재배치
+
+constexpr UInt32 k_defaultVertexCacheSize = 16;
+
+struct VertexCacheStats
+{
+    float acmr = 0.f;   // 삼각형당 평균 캐시 미스 (0.5 ~ 3.0, 낮을수록 좋음)
+    float atvr = 0.f;   // 정점당 평균 변환 횟수 (1.0 이 최적)
+};
+
+struct MeshOptimizeDesc
+{
+    UInt32 cacheSize         = k_defaultVertexCacheSize;
+    float  overdrawThreshold = 1.05f;   // 오버드로우 최적화를 위해 허용하는 ACMR 증가 비율 (1.0 이하면 오버드로우 패스 생략)
+    bool   bVertexCache      = true;
+    bool   bOverdraw         = true;
+    bool   bVertexFetch      = true;
+};
+
+struct MeshOptimizeReport
+{
+    VertexCacheStats before;
+    VertexCacheStats after;
+};
+
+// FIFO 캐시를 시뮬레이션하여 통계를 계산 (GPU 불필요)
+NODISCARD VertexCacheStats AnalyzeVertexCache(std::span<const Index> _indices, UInt32 _vertexCount, UInt32 _cacheSize = k_defaultVertexCacheSize);
+
+void               OptimizeVertexCache(std::span<Index> _indices, UInt32 _vertexCount, UInt32 _cacheSize = k_defaultVertexCacheSize);
+void               OptimizeOverdraw(std::span<Index> _indices, std::span<const VertexAttribute> _vertices, float _threshold, UInt32 _cacheSize = k_defaultVertexCacheSize);
+void               OptimizeVertexFetch(MeshData& _meshData);
+MeshOptimizeReport OptimizeMesh(MeshData& _meshData, const MeshOptimizeDesc& _desc = MeshOptimizeDesc());
+
+}   // namespace jam
\ No newline at end of file
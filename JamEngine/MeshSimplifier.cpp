@@ -0,0 +1,580 @@
+#include "pch.h"
+
+#include "MeshSimplifier.h"
+
+#include "MeshOptimizer.h"
+
+#include <numeric>
+
+namespace
+{
+
+using namespace jam;
+
+constexpr double k_borderWeight = 10.0;   // 경계 보존 평면의 가중치
+
+// 대칭 4x4 행렬 (평면까지 거리 제곱의 합)
+struct Quadric
+{
+    double a00 = 0.0, a11 = 0.0, a22 = 0.0;
+    double a01 = 0.0, a02 = 0.0, a12 = 0.0;
+    double b0 = 0.0, b1 = 0.0, b2 = 0.0;
+    double c      = 0.0;
+    double weight = 0.0;
+
+    void AddPlane(const Vec3& _normal, const float _distance, const double _weight)
+    {
+        const double x = _normal.x, y = _normal.y, z = _normal.z, d = _distance;
+        a00 += _weight * x * x;
+        a11 += _weight * y * y;
+        a22 += _weight * z * z;
+        a01 += _weight * x * y;
+        a02 += _weight * x * z;
+        a12 += _weight * y * z;
+        b0 += _weight * x * d;
+        b1 += _weight * y * d;
+        b2 += _weight * z * d;
+        c += _weight * d * d;
+        weight += _weight;
+    }
+
+    Quadric& operator+=(const Quadric& _other)
+    {
+        a00 += _other.a00;
+        a11 += _other.a11;
+        a22 += _other.a22;
+        a01 += _other.a01;
+        a02 += _other.a02;
+        a12 += _other.a12;
+        b0 += _other.b0;
+        b1 += _other.b1;
+        b2 += _other.b2;
+        c += _other.c;
+        weight += _other.weight;
+        return *this;
+    }
+
+    // 가중 평균 거리 제곱
+    NODISCARD double Evaluate(const Vec3& _position) const
+    {
+        const double x = _position.x, y = _position.y, z = _position.z;
+        const double error = a00 * x * x + a11 * y * y + a22 * z * z + 2.0 * (a01 * x * y + a02 * x * z + a12 * y * z) + 2.0 * (b0 * x + b1 * y + b2 * z) + c;
+        return std::abs(error) / std::max(weight, 1e-12);
+    }
+};
+
+enum class eVertexKind : UInt8
+{
+    Manifold,   // 내부 정점
+    Border,     // 열린 경계 위의 정점 - 경계를 따라서만 붕괴
+    Seam,       // 같은 위치에 속성이 다른 정점이 2개 - 심을 따라서만 붕괴
+    Locked,     // 붕괴 불가
+};
+
+NODISCARD UInt64 MakeEdgeKey(const UInt32 _from, const UInt32 _to)
+{
+    return (static_cast<UInt64>(_from) << 32) | _to;
+}
+
+NODISCARD bool HasEdge(const std::vector<UInt64>& _sortedEdges, const UInt32 _from, const UInt32 _to)
+{
+    return std::ranges::binary_search(_sortedEdges, MakeEdgeKey(_from, _to));
+}
+
+// 위치가 같은 정점 묶음 (그룹) - 토폴로지와 오차는 그룹 단위로 계산
+struct PositionGroups
+{
+    std::vector<UInt32> groupOf;        // 정점 -> 그룹
+    std::vector<UInt32> wedgeOffsets;   // 그룹별 정점 목록 (CSR)
+    std::vector<Index>  wedges;
+    std::vector<Vec3>   positions;
+};
+
+NODISCARD PositionGroups BuildPositionGroups(const std::span<const VertexAttribute> _vertices)
+{
+    struct PositionKey
+    {
+        UInt32 x, y, z;
+        bool   operator==(const PositionKey&) const = default;
+    };
+    struct PositionKeyHash
+    {
+        size_t operator()(const PositionKey& _key) const { return (_key.x * 73856093u) ^ (_key.y * 19349663u) ^ (_key.z * 83492791u); }
+    };
+
+    PositionGroups groups;
+    groups.groupOf.resize(_vertices.size());
+
+    std::unordered_map<PositionKey, UInt32, PositionKeyHash> groupMap;
+    groupMap.reserve(_vertices.size());
+    for (size_t i = 0; i < _vertices.size(); ++i)
+    {
+        const Vec3& position = _vertices[i].position;
+        PositionKey key      = { std::bit_cast<UInt32>(position.x), std::bit_cast<UInt32>(position.y), std::bit_cast<UInt32>(position.z) };
+        auto [it, bInserted] = groupMap.try_emplace(key, static_cast<UInt32>(groups.positions.size()));
+        if (bInserted)
+        {
+            groups.positions.push_back(position);
+        }
+        groups.groupOf[i] = it->second;
+    }
+
+    const UInt32 groupCount = static_cast<UInt32>(groups.positions.size());
+    groups.wedgeOffsets.assign(groupCount + 1, 0);
+    for (const UInt32 group: groups.groupOf)
+    {
+        ++groups.wedgeOffsets[group + 1];
+    }
+    for (UInt32 i = 0; i < groupCount; ++i)
+    {
+        groups.wedgeOffsets[i + 1] += groups.wedgeOffsets[i];
+    }
+
+    std::vector<UInt32> cursors(groups.wedgeOffsets.begin(), groups.wedgeOffsets.end() - 1);
+    groups.wedges.resize(_vertices.size());
+    for (size_t i = 0; i < _vertices.size(); ++i)
+    {
+        groups.wedges[cursors[groups.groupOf[i]]++] = static_cast<Index>(i);
+    }
+    return groups;
+}
+
+// 방향이 있는 엣지 목록 (정렬됨)
+NODISCARD std::vector<UInt64> BuildDirectedEdges(const std::span<const Index> _indices, const std::vector<UInt32>* _pGroupOf)
+{
+    std::vector<UInt64> edges;
+    edges.reserve(_indices.size());
+    for (size_t i = 0; i < _indices.size(); i += 3)
+    {
+        for (UInt32 k = 0; k < 3; ++k)
+        {
+            UInt32 from = _indices[i + k];
+            UInt32 to   = _indices[i + (k + 1) % 3];
+            if (_pGroupOf)
+            {
+                from = (*_pGroupOf)[from];
+                to   = (*_pGroupOf)[to];
+            }
+            edges.push_back(MakeEdgeKey(from, to));
+        }
+    }
+    std::ranges::sort(edges);
+    return edges;
+}
+
+NODISCARD std::vector<eVertexKind> ClassifyVertices(const std::span<const Index> _indices, const PositionGroups& _groups, const bool _bLockBorder)
+{
+    const UInt32        groupCount = static_cast<UInt32>(_groups.positions.size());
+    std::vector<UInt64> groupEdges = BuildDirectedEdges(_indices, &_groups.groupOf);
+
+    // 반대 방향이 없는 엣지가 열린 경계
+    std::vector<UInt32> openOut(groupCount, 0);
+    std::vector<UInt32> openIn(groupCount, 0);
+    for (const UInt64 edge: groupEdges)
+    {
+        const UInt32 from = static_cast<UInt32>(edge >> 32);
+        const UInt32 to   = static_cast<UInt32>(edge);
+        if (!HasEdge(groupEdges, to, from))
+        {
+            ++openOut[from];
+            ++openIn[to];
+        }
+    }
+
+    // 참조되는 정점 수
+    std::vector<bool> referenced(_groups.groupOf.size(), false);
+    for (const Index index: _indices)
+    {
+        referenced[index] = true;
+    }
+
+    std::vector<eVertexKind> kinds(groupCount, eVertexKind::Manifold);
+    for (UInt32 group = 0; group < groupCount; ++group)
+    {
+        UInt32 wedgeCount = 0;
+        for (UInt32 i = _groups.wedgeOffsets[group]; i < _groups.wedgeOffsets[group + 1]; ++i)
+        {
+            wedgeCount += referenced[_groups.wedges[i]] ? 1 : 0;
+        }
+
+        const bool bBorder = openOut[group] > 0 || openIn[group] > 0;
+        if (bBorder)
+        {
+            const bool bSimpleBorder = wedgeCount == 1 && openOut[group] == 1 && openIn[group] == 1;
+            kinds[group]             = bSimpleBorder && !_bLockBorder ? eVertexKind::Border : eVertexKind::Locked;
+        }
+        else if (wedgeCount == 2)
+        {
+            kinds[group] = eVertexKind::Seam;
+        }
+        else if (wedgeCount > 2)
+        {
+            kinds[group] = eVertexKind::Locked;
+        }
+    }
+    return kinds;
+}
+
+NODISCARD std::vector<Quadric> ComputeQuadrics(const std::span<const Index> _indices, const PositionGroups& _groups)
+{
+    std::vector<Quadric> quadrics(_groups.positions.size());
+    std::vector<UInt64>  groupEdges = BuildDirectedEdges(_indices, &_groups.groupOf);
+
+    for (size_t i = 0; i < _indices.size(); i += 3)
+    {
+        const UInt32 groups[3] = { _groups.groupOf[_indices[i]], _groups.groupOf[_indices[i + 1]], _groups.groupOf[_indices[i + 2]] };
+        const Vec3&  a         = _groups.positions[groups[0]];
+        const Vec3&  b         = _groups.positions[groups[1]];
+        const Vec3&  c         = _groups.positions[groups[2]];
+
+        Vec3        normal = (b - a).Cross(c - a);
+        const float area   = normal.Length() * 0.5f;
+        if (area <= 0.f)
+        {
+            continue;
+        }
+        normal.Normalize();
+
+        // 삼각형 평면
+        Quadric plane;
+        plane.AddPlane(normal, -normal.Dot(a), area);
+        for (const UInt32 group: groups)
+        {
+            quadrics[group] += plane;
+        }
+
+        // 열린 경계는 엣지에 수직인 평면을 추가하여 경계가 안쪽으로 말려들지 않도록 함
+        for (UInt32 k = 0; k < 3; ++k)
+        {
+            const UInt32 from = groups[k];
+            const UInt32 to   = groups[(k + 1) % 3];
+            if (HasEdge(groupEdges, to, from))
+            {
+                continue;
+            }
+
+            const Vec3  edge         = _groups.positions[to] - _groups.positions[from];
+            Vec3        borderNormal = edge.Cross(normal);
+            const float length       = edge.Length();
+            if (length <= 0.f)
+            {
+                continue;
+            }
+            borderNormal.Normalize();
+
+            Quadric border;
+            border.AddPlane(borderNormal, -borderNormal.Dot(_groups.positions[from]), k_borderWeight * length * length);
+            quadrics[from] += border;
+            quadrics[to] += border;
+        }
+    }
+
+    return quadrics;
+}
+
+struct Collapse
+{
+    UInt32 from;
+    UInt32 to;
+    double cost;
+};
+
+}   // namespace
+
+namespace jam
+{
+
+MeshSimplifyResult SimplifyMesh(const std::span<const Index> _indices, const std::span<const VertexAttribute> _vertices, const MeshSimplifyDesc& _desc)
+{
+    JAM_ASSERT(_indices.size() % 3 == 0, "SimplifyMesh() - Index count must be a multiple of 3");
+
+    MeshSimplifyResult result;
+    result.indices.assign(_indices.begin(), _indices.end());
+    if (_indices.empty())
+    {
+        return result;
+    }
+
+    const PositionGroups           groups     = BuildPositionGroups(_vertices);
+    const std::vector<eVertexKind> kinds      = ClassifyVertices(_indices, groups, _desc.bLockBorder);
+    std::vector<Quadric>           quadrics   = ComputeQuadrics(_indices, groups);
+    const UInt32                   groupCount = static_cast<UInt32>(groups.positions.size());
+
+    // 메쉬 크기 (상대 오차 기준)
+    Vec3 minPosition = groups.positions[0];
+    Vec3 maxPosition = groups.positions[0];
+    for (const Vec3& position: groups.positions)
+    {
+        minPosition = Vec3::Min(minPosition, position);
+        maxPosition = Vec3::Max(maxPosition, position);
+    }
+    const float  meshScale     = std::max(Vec3::Distance(minPosition, maxPosition) * 0.5f, 1e-6f);
+    const double maxError      = static_cast<double>(_desc.maxRelativeError) * meshScale;
+    const double maxErrorSq    = _desc.maxRelativeError >= std::numeric_limits<float>::max() ? std::numeric_limits<double>::max() : maxError * maxError;
+    double       resultErrorSq = 0.0;
+
+    std::vector<Index>    wedgeTarget(_vertices.size());
+    std::vector<bool>     touched(groupCount);
+    std::vector<Collapse> collapses;
+    std::vector<UInt32>   groupTriangleOffsets(groupCount + 1);
+    std::vector<UInt32>   groupTriangles;
+
+    std::vector<Index>& indices = result.indices;
+    while (indices.size() / 3 > _desc.targetTriangleCount)
+    {
+        const UInt32 triangleCount = static_cast<UInt32>(indices.size() / 3);
+
+        // 현재 토폴로지
+        const std::vector<UInt64> wedgeEdges = BuildDirectedEdges(indices, nullptr);
+        const std::vector<UInt64> groupEdges = BuildDirectedEdges(indices, &groups.groupOf);
+
+        std::ranges::fill(groupTriangleOffsets, 0);
+        for (const Index index: indices)
+        {
+            ++groupTriangleOffsets[groups.groupOf[index] + 1];
+        }
+        for (UInt32 i = 0; i < groupCount; ++i)
+        {
+            groupTriangleOffsets[i + 1] += groupTriangleOffsets[i];
+        }
+        {
+            std::vector<UInt32> cursors(groupTriangleOffsets.begin(), groupTriangleOffsets.end() - 1);
+            groupTriangles.resize(indices.size());
+            for (size_t i = 0; i < indices.size(); ++i)
+            {
+                groupTriangles[cursors[groups.groupOf[indices[i]]]++] = static_cast<UInt32>(i / 3);
+            }
+        }
+
+        // from 그룹의 각 정점이 to 그룹의 어느 정점으로 붕괴되어야 하는지 결정 (속성 경계 유지)
+        auto resolveWedges = [&](const UInt32 _from, const UInt32 _to, const bool _bApply) {
+            Index previousTarget = std::numeric_limits<Index>::max();
+            for (UInt32 i = groups.wedgeOffsets[_from]; i < groups.wedgeOffsets[_from + 1]; ++i)
+            {
+                const Index wedge  = groups.wedges[i];
+                Index       target = std::numeric_limits<Index>::max();
+                UInt32      count  = 0;
+                for (UInt32 j = groups.wedgeOffsets[_to]; j < groups.wedgeOffsets[_to + 1]; ++j)
+                {
+                    const Index candidate = groups.wedges[j];
+                    if (HasEdge(wedgeEdges, wedge, candidate) || HasEdge(wedgeEdges, candidate, wedge))
+                    {
+                        target = candidate;
+                        ++count;
+                    }
+                }
+
+                if (count == 0)
+                {
+                    continue;   // 현재 사용되지 않는 정점
+                }
+                if (count > 1 || target == previousTarget)   // 모호하거나 두 심이 한 정점으로 합쳐짐
+                {
+                    return false;
+                }
+                previousTarget = target;
+
+                if (_bApply)
+                {
+                    wedgeTarget[wedge] = target;
+                }
+            }
+            return previousTarget != std::numeric_limits<Index>::max();
+        };
+
+        // 후보 수집
+        collapses.clear();
+        for (const UInt64 edge: groupEdges)
+        {
+            const UInt32 from = static_cast<UInt32>(edge >> 32);
+            const UInt32 to   = static_cast<UInt32>(edge);
+            if (from == to)
+            {
+                continue;
+            }
+
+            for (const auto& [a, b]: { std::pair(from, to), std::pair(to, from) })
+            {
+                const eVertexKind kind = kinds[a];
+                if (kind == eVertexKind::Locked)
+                {
+                    continue;
+                }
+                if (kind == eVertexKind::Border)
+                {
+                    const bool bAlongBorder = !HasEdge(groupEdges, b, a) || !HasEdge(groupEdges, a, b);
+                    if (!bAlongBorder || (kinds[b] != eVertexKind::Border && kinds[b] != eVertexKind::Locked))
+                    {
+                        continue;
+                    }
+                }
+                if (kind == eVertexKind::Seam && kinds[b] != eVertexKind::Seam && kinds[b] != eVertexKind::Locked)
+                {
+                    continue;
+                }
+
+                Quadric quadric = quadrics[a];
+                quadric += quadrics[b];
+                collapses.emplace_back(a, b, quadric.Evaluate(groups.positions[b]));
+            }
+        }
+        std::ranges::sort(collapses, [](const Collapse& _lhs, const Collapse& _rhs) { return _lhs.cost < _rhs.cost || (_lhs.cost == _rhs.cost && _lhs.from < _rhs.from); });
+
+        // 서로 겹치지 않는 붕괴를 선택하여 적용
+        touched.assign(groupCount, false);
+        std::iota(wedgeTarget.begin(), wedgeTarget.end(), 0);
+        const UInt32 removeGoal   = triangleCount - _desc.targetTriangleCount;
+        UInt32       removeCount  = 0;
+        UInt32       appliedCount = 0;
+        for (const Collapse& collapse: collapses)
+        {
+            if (collapse.cost > maxErrorSq || removeCount >= removeGoal)
+            {
+                break;
+            }
+            if (touched[collapse.from] || touched[collapse.to])
+            {
+                continue;
+            }
+
+            // 뒤집히는 삼각형 확인
+            bool        bFlip          = false;
+            UInt32      collapsedCount = 0;
+            const Vec3& target         = groups.positions[collapse.to];
+            for (UInt32 i = groupTriangleOffsets[collapse.from]; i < groupTriangleOffsets[collapse.from + 1] && !bFlip; ++i)
+            {
+                const UInt32 triangle = groupTriangles[i];
+                UInt32       corners[3];
+                for (UInt32 k = 0; k < 3; ++k)
+                {
+                    corners[k] = groups.groupOf[indices[triangle * 3 + k]];
+                }
+                if (corners[0] == collapse.to || corners[1] == collapse.to || corners[2] == collapse.to)
+                {
+                    ++collapsedCount;
+                    continue;
+                }
+
+                Vec3 before[3];
+                Vec3 after[3];
+                for (UInt32 k = 0; k < 3; ++k)
+                {
+                    before[k] = groups.positions[corners[k]];
+                    after[k]  = corners[k] == collapse.from ? target : before[k];
+                }
+                const Vec3 normalBefore = (before[1] - before[0]).Cross(before[2] - before[0]);
+                const Vec3 normalAfter  = (after[1] - after[0]).Cross(after[2] - after[0]);
+                bFlip                   = normalBefore.Dot(normalAfter) <= 0.f;
+            }
+            if (bFlip || !resolveWedges(collapse.from, collapse.to, false))
+            {
+                continue;
+            }
+
+            // 1-ring 을 잠궈서 같은 패스에서 인접한 붕괴가 서로의 검사를 무효화하지 않도록 함
+            for (UInt32 i = groupTriangleOffsets[collapse.from]; i < groupTriangleOffsets[collapse.from + 1]; ++i)
+            {
+                const UInt32 triangle = groupTriangles[i];
+                for (UInt32 k = 0; k < 3; ++k)
+                {
+                    touched[groups.groupOf[indices[triangle * 3 + k]]] = true;
+                }
+            }
+            touched[collapse.to] = true;
+
+            resolveWedges(collapse.from, collapse.to, true);
+            quadrics[collapse.to] += quadrics[collapse.from];
+            resultErrorSq = std::max(resultErrorSq, collapse.cost);
+            removeCount += collapsedCount;
+            ++appliedCount;
+        }
+
+        if (appliedCount == 0)
+        {
+            break;
+        }
+
+        // 인덱스 갱신 및 퇴화 삼각형 제거
+        size_t writeOffset = 0;
+        for (size_t i = 0; i < indices.size(); i += 3)
+        {
+            const Index a = wedgeTarget[indices[i + 0]];
+            const Index b = wedgeTarget[indices[i + 1]];
+            const Index c = wedgeTarget[indices[i + 2]];
+            if (groups.groupOf[a] == groups.groupOf[b] || groups.groupOf[b] == groups.groupOf[c] || groups.groupOf[a] == groups.groupOf[c])
+            {
+                continue;
+            }
+            indices[writeOffset++] = a;
+            indices[writeOffset++] = b;
+            indices[writeOffset++] = c;
+        }
+        indices.resize(writeOffset);
+    }
+
+    result.error         = static_cast<float>(std::sqrt(resultErrorSq));
+    result.relativeError = result.error / meshScale;
+    return result;
+}
+
+std::vector<MeshLod> GenerateLodChain(MeshData& _meshData, const MeshLodChainDesc& _desc)
+{
+    std::vector<MeshLod> lods;
+
+    MeshLod lod0;
+    lod0.indexCount = static_cast<UInt32>(_meshData.indices.size());
+    lods.push_back(lod0);
+
+    if (_meshData.vertices.empty())
+    {
+        return lods;
+    }
+
+    // SimplifyMesh 와 같은 메쉬 크기 (모든 레벨이 정점 버퍼를 공유하므로 레벨마다 같음)
+    Vec3 minPosition = _meshData.vertices[0].position;
+    Vec3 maxPosition = _meshData.vertices[0].position;
+    for (const VertexAttribute& vertex: _meshData.vertices)
+    {
+        minPosition = Vec3::Min(minPosition, vertex.position);
+        maxPosition = Vec3::Max(maxPosition, vertex.position);
+    }
+    const float meshScale = std::max(Vec3::Distance(minPosition, maxPosition) * 0.5f, 1e-6f);
+
+    for (UInt32 level = 1; level < _desc.maxLevelCount; ++level)
+    {
+        const MeshLod& previous = lods.back();
+
+        // 이전 레벨에서 이어서 단순화하므로 오차가 누적됨 - 남은 허용 오차만 사용
+        const float remainingRelativeError = _desc.maxRelativeError - previous.error / meshScale;
+        if (remainingRelativeError <= 0.f)
+        {
+            break;
+        }
+
+        MeshSimplifyDesc simplifyDesc;
+        simplifyDesc.targetTriangleCount = static_cast<UInt32>(static_cast<float>(previous.indexCount / 3) * _desc.reduction);
+        simplifyDesc.maxRelativeError    = remainingRelativeError;
+
+        const std::span<const Index> previousIndices = std::span(_meshData.indices).subspan(previous.startIndex, previous.indexCount);
+        MeshSimplifyResult           simplified      = SimplifyMesh(previousIndices, _meshData.vertices, simplifyDesc);
+
+        // 더 이상 의미있게 줄어들지 않음
+        if (simplified.indices.empty() || simplified.indices.size() > previous.indexCount * 9 / 10)
+        {
+            break;
+        }
+
+        OptimizeVertexCache(simplified.indices, static_cast<UInt32>(_meshData.vertices.size()));
+
+        MeshLod lod;
+        lod.startIndex = static_cast<UInt32>(_meshData.indices.size());
+        lod.indexCount = static_cast<UInt32>(simplified.indices.size());
+        lod.error      = previous.error + simplified.error;
+        _meshData.indices.insert(_meshData.indices.end(), simplified.indices.begin(), simplified.indices.end());
+        lods.push_back(lod);
+    }
+
+    return lods;
+}
+
+}   // namespace jam
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+#include "Mesh.h"
+
+namespace jam
+{
+
+// Quadric Error Metric 기반 메쉬 단순화 (삼각형 리스트 전용)
+// 정점을 새로 만들지 않고 기존 정점으로 엣지를 붕괴시키므로 모든 LOD 가 같은 정점 버퍼를 공유함
+// 같은 위치에 속성이 다른 정점이 있는 곳 (UV 심, 노말 불연속) 은 심을 따라서만 붕괴되어 속성 경계가 유지됨
+
+struct MeshSimplifyDesc
+{
+    UInt32 targetTriangleCount = 0;       // 목표 삼각형 수 (0 이면 오차 한도까지 단순화)
+    float  maxRelativeError    = 0.01f;   // 메쉬 크기 대비 허용 오차 (FLT_MAX 면 목표 삼각형 수만 사용)
+    bool   bLockBorder         = false;   // 열린 경계의 정점을 고정
+};
+
+struct MeshSimplifyResult
+{
+    std::vector<Index> indices;
+    float              error         = 0.f;   // 모델 공간의 기하 오차 (거리)
+    float              relativeError = 0.f;   // 메쉬 크기 대비 오차
+};
+
+// LOD 레벨 - 정점 버퍼를 공유하며 인덱스 버퍼의 구간으로 표현됨
+struct MeshLod
+{
+    UInt32 startIndex = 0;
+    UInt32 indexCount = 0;
+    float  error      = 0.f;   // LOD0 대비 모델 공간의 기하 오차 (런타임 LOD 선택에 사용)
+};
+
+struct MeshLodChainDesc
+{
+    UInt32 maxLevelCount    = 4;       // LOD0 포함
+    float  reduction        = 0.5f;    // 레벨마다 삼각형 수 비율
+    float  maxRelativeError = 0.05f;   // 체인 전체의 허용 오차 (레벨마다 누적 오차를 뺀 나머지만 사용)
+};
+
+NODISCARD MeshSimplifyResult SimplifyMesh(std::span<const Index> _indices, std::span<const VertexAttribute> _vertices, const MeshSimplifyDesc& _desc);
+
+// LOD1 이상의 인덱스를 _meshData.indices 뒤에 추가하고 LOD0 를 포함한 레벨 목록을 반환
+// 더 이상 단순화되지 않는다면 maxLevelCount 보다 적은 레벨을 반환함
+NODISCARD std::vector<MeshLod> GenerateLodChain(MeshData& _meshData, const MeshLodChainDesc& _desc = MeshLodChainDesc());
+
+}   // namespace jam
\ No newline at end of file
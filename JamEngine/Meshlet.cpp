@@ -0,0 +1,277 @@
+#include "pch.h"
+
+#include "Meshlet.h"
+
+namespace
+{
+
+using namespace jam;
+
+// 메쉬렛 경계 계산 (삼각형 리스트 구간)
+void ComputeMeshletBounds(const std::span<const Index> _indices, const std::span<const VertexAttribute> _vertices, Meshlet& _meshlet)
+{
+    // 바운딩 스피어 - AABB 중심 기준
+    Vec3 minPosition = _vertices[_indices[0]].position;
+    Vec3 maxPosition = minPosition;
+    for (const Index index: _indices)
+    {
+        minPosition = Vec3::Min(minPosition, _vertices[index].position);
+        maxPosition = Vec3::Max(maxPosition, _vertices[index].position);
+    }
+
+    _meshlet.center = (minPosition + maxPosition) * 0.5f;
+    _meshlet.radius = 0.f;
+    for (const Index index: _indices)
+    {
+        _meshlet.radius = std::max(_meshlet.radius, Vec3::Distance(_meshlet.center, _vertices[index].position));
+    }
+
+    // 노말 콘 - 삼각형 법선의 평균 방향과 가장 벌어진 법선
+    std::vector<Vec3> normals;
+    normals.reserve(_indices.size() / 3);
+    Vec3 axis = Vec3::Zero;
+    for (size_t i = 0; i < _indices.size(); i += 3)
+    {
+        const Vec3& a      = _vertices[_indices[i + 0]].position;
+        const Vec3& b      = _vertices[_indices[i + 1]].position;
+        const Vec3& c      = _vertices[_indices[i + 2]].position;
+        Vec3        normal = (b - a).Cross(c - a);
+        if (normal.LengthSquared() > 0.f)   // 퇴화 삼각형 제외
+        {
+            normal.Normalize();
+            normals.push_back(normal);
+            axis += normal;
+        }
+    }
+
+    _meshlet.coneCutoff = 1.f;
+    if (normals.empty() || axis.LengthSquared() <= 0.f)
+    {
+        return;
+    }
+    axis.Normalize();
+
+    float minDot = 1.f;
+    for (const Vec3& normal: normals)
+    {
+        minDot = std::min(minDot, normal.Dot(axis));
+    }
+
+    // 반구보다 넓게 퍼져있다면 컬링 불가
+    _meshlet.coneAxis = axis;
+    if (minDot > 0.f)
+    {
+        _meshlet.coneCutoff = std::sqrt(1.f - minDot * minDot);
+    }
+}
+
+}   // namespace
+
+namespace jam
+{
+
+std::vector<Meshlet> BuildMeshlets(const std::span<Index> _indices, const std::span<const VertexAttribute> _vertices, const UInt32 _maxVertices, const UInt32 _maxTriangles)
+{
+    JAM_ASSERT(_indices.size() % 3 == 0, "BuildMeshlets() - Index count must be a multiple of 3");
+    JAM_ASSERT(_maxVertices >= 3 && _maxTriangles >= 1, "BuildMeshlets() - Invalid meshlet limits");
+
+    std::vector<Meshlet> meshlets;
+    if (_indices.empty())
+    {
+        return meshlets;
+    }
+
+    const UInt32 vertexCount   = static_cast<UInt32>(_vertices.size());
+    const UInt32 triangleCount = static_cast<UInt32>(_indices.size() / 3);
+
+    // 정점 -> 인접 삼각형 (CSR)
+    std::vector<UInt32> adjacencyOffsets(vertexCount + 1, 0);
+    std::vector<UInt32> adjacency(_indices.size());
+    {
+        for (const Index index: _indices)
+        {
+            ++adjacencyOffsets[index + 1];
+        }
+        for (UInt32 i = 0; i < vertexCount; ++i)
+        {
+            adjacencyOffsets[i + 1] += adjacencyOffsets[i];
+        }
+
+        std::vector<UInt32> cursors(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+        for (size_t i = 0; i < _indices.size(); ++i)
+        {
+            adjacency[cursors[_indices[i]]++] = static_cast<UInt32>(i / 3);
+        }
+    }
+
+    std::vector<bool>   emitted(triangleCount, false);
+    std::vector<UInt32> vertexMarks(vertexCount, 0);   // 현재 메쉬렛에 포함된 정점 (메쉬렛 번호 + 1)
+    std::vector<Index>  result;
+    result.reserve(_indices.size());
+
+    std::vector<Index> meshletVertices;
+    UInt32             meshletTriangleCount = 0;
+    UInt32             meshletId            = 1;
+    UInt32             cursor               = 0;
+
+    auto newVertexCount = [&](const UInt32 _triangle) {
+        UInt32 count = 0;
+        for (UInt32 k = 0; k < 3; ++k)
+        {
+            count += vertexMarks[_indices[_triangle * 3 + k]] != meshletId ? 1 : 0;
+        }
+        return count;
+    };
+
+    auto flushMeshlet = [&]() {
+        Meshlet meshlet;
+        meshlet.indexCount = meshletTriangleCount * 3;
+        meshlet.startIndex = static_cast<UInt32>(result.size()) - meshlet.indexCount;
+        ComputeMeshletBounds(std::span(result).subspan(meshlet.startIndex, meshlet.indexCount), _vertices, meshlet);
+        meshlets.push_back(meshlet);
+
+        meshletVertices.clear();
+        meshletTriangleCount = 0;
+        ++meshletId;
+    };
+
+    for (UInt32 emittedCount = 0; emittedCount < triangleCount; ++emittedCount)
+    {
+        // 다음 삼각형 - 현재 메쉬렛과 정점을 가장 많이 공유하는 삼각형
+        Int64  bestTriangle = -1;
+        UInt32 bestCost     = 4;
+        for (const Index vertex: meshletVertices)
+        {
+            for (UInt32 i = adjacencyOffsets[vertex]; i < adjacencyOffsets[vertex + 1]; ++i)
+            {
+                const UInt32 triangle = adjacency[i];
+                if (emitted[triangle])
+                {
+                    continue;
+                }
+
+                const UInt32 cost = newVertexCount(triangle);
+                if (cost < bestCost || (cost == bestCost && triangle < bestTriangle))
+                {
+                    bestCost     = cost;
+                    bestTriangle = triangle;
+                }
+            }
+        }
+
+        // 인접한 삼각형이 없다면 원래 순서에서 다음 삼각형
+        if (bestTriangle < 0)
+        {
+            while (emitted[cursor])
+            {
+                ++cursor;
+            }
+            bestTriangle = cursor;
+            bestCost     = newVertexCount(cursor);
+        }
+
+        // 한도를 넘는다면 새 메쉬렛 시작
+        if (meshletVertices.size() + bestCost > _maxVertices || meshletTriangleCount + 1 > _maxTriangles)
+        {
+            flushMeshlet();
+        }
+
+        const UInt32 triangle = static_cast<UInt32>(bestTriangle);
+        for (UInt32 k = 0; k < 3; ++k)
+        {
+            const Index vertex = _indices[triangle * 3 + k];
+            if (vertexMarks[vertex] != meshletId)
+            {
+                vertexMarks[vertex] = meshletId;
+                meshletVertices.push_back(vertex);
+            }
+            result.push_back(vertex);
+        }
+        emitted[triangle] = true;
+        ++meshletTriangleCount;
+    }
+    flushMeshlet();
+
+    std::ranges::copy(result, _indices.begin());
+    return meshlets;
+}
+
+std::array<Vec4, 6> ExtractFrustumPlanes(const Mat4& _viewProjection)
+{
+    const Mat4& m = _viewProjection;
+
+    // clip = v * M 이므로 각 열이 클립 좌표 성분
+    const Vec4 column0 = Vec4(m._11, m._21, m._31, m._41);
+    const Vec4 column1 = Vec4(m._12, m._22, m._32, m._42);
+    const Vec4 column2 = Vec4(m._13, m._23, m._33, m._43);
+    const Vec4 column3 = Vec4(m._14, m._24, m._34, m._44);
+
+    std::array<Vec4, 6> planes = {
+        column3 + column0,   // left
+        column3 - column0,   // right
+        column3 + column1,   // bottom
+        column3 - column1,   // top
+        column2,             // near (D3D: 0 <= z)
+        column3 - column2,   // far
+    };
+
+    for (Vec4& plane: planes)
+    {
+        const float length = Vec3(plane.x, plane.y, plane.z).Length();
+        if (length > 0.f)
+        {
+            plane /= length;
+        }
+    }
+    return planes;
+}
+
+UInt32 CullMeshlets(const std::span<const Meshlet> _meshlets, const Mat4& _world, const MeshletCullParams& _params, std::vector<IndexRange>& _out_ranges)
+{
+    // 균등 스케일 가정 - 가장 큰 축의 스케일 사용
+    const float scale = std::max({ Vec3(_world._11, _world._12, _world._13).Length(), Vec3(_world._21, _world._22, _world._23).Length(), Vec3(_world._31, _world._32, _world._33).Length() });
+
+    UInt32 visibleCount = 0;
+    for (const Meshlet& meshlet: _meshlets)
+    {
+        const Vec3  center = Vec3::Transform(meshlet.center, _world);
+        const float radius = meshlet.radius * scale;
+
+        // 절두체 컬링
+        if (_params.bFrustumCulling)
+        {
+            const bool bOutside = std::ranges::any_of(_params.frustumPlanes, [&](const Vec4& _plane) { return _plane.x * center.x + _plane.y * center.y + _plane.z * center.z + _plane.w < -radius; });
+            if (bOutside)
+            {
+                continue;
+            }
+        }
+
+        // 후면 컬링 - 카메라에서 본 방향이 노말 콘 전체와 같은 방향이라면 모든 삼각형이 뒷면
+        if (_params.bBackfaceCulling && meshlet.coneCutoff < 1.f)
+        {
+            Vec3 axis = Vec3::TransformNormal(meshlet.coneAxis, _world);
+            axis.Normalize();
+
+            const Vec3 toCenter = center - _params.cameraPosition;
+            if (toCenter.Dot(axis) >= meshlet.coneCutoff * toCenter.Length() + radius)
+            {
+                continue;
+            }
+        }
+
+        // 인접한 구간은 병합
+        if (!_out_ranges.empty() && _out_ranges.back().startIndex + _out_ranges.back().indexCount == meshlet.startIndex)
+        {
+            _out_ranges.back().indexCount += meshlet.indexCount;
+        }
+        else
+        {
+            _out_ranges.emplace_back(meshlet.startIndex, meshlet.indexCount);
+        }
+        ++visibleCount;
+    }
+    return visibleCount;
+}
+
+}   // namespace jam
\ No newline at end of file
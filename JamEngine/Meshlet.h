@@ -0,0 +1,53 @@
+#pragma once
+#include "Mesh.h"
+
+namespace jam
+{
+
+// 메쉬렛 - 정점/삼각형 수가 제한된 삼각형 묶음
+// 빌드 시 인덱스 버퍼를 재배치하여 각 메쉬렛의 삼각형이 연속되도록 하므로, 메쉬렛은 일반 인덱스 버퍼의 구간으로 그릴 수 있음
+constexpr UInt32 k_maxMeshletVertices  = 64;
+constexpr UInt32 k_maxMeshletTriangles = 124;
+
+struct Meshlet
+{
+    UInt32 startIndex = 0;   // 인덱스 버퍼 내 시작 위치
+    UInt32 indexCount = 0;
+
+    // 바운딩 스피어 (모델 공간)
+    Vec3  center = Vec3::Zero;
+    float radius = 0.f;
+
+    // 노말 콘 - 모든 삼각형의 법선이 coneAxis 를 중심으로 한 콘 안에 있음
+    // coneCutoff 는 sin(콘 반각), 1 이상이면 콘 컬링 불가
+    Vec3  coneAxis   = Vec3::Zero;
+    float coneCutoff = 1.f;
+};
+
+// 메쉬렛 컬링에 필요한 카메라 정보 (월드 공간)
+struct MeshletCullParams
+{
+    Vec3                cameraPosition;
+    std::array<Vec4, 6> frustumPlanes;   // 안쪽을 향하는 정규화된 평면 (ExtractFrustumPlanes)
+    bool                bFrustumCulling  = true;
+    bool                bBackfaceCulling = true;
+};
+
+// 메쉬 기준의 연속된 인덱스 구간 (Mesh::Draw 에 그대로 전달)
+struct IndexRange
+{
+    UInt32 startIndex = 0;
+    UInt32 indexCount = 0;
+};
+
+// 삼각형 리스트의 인덱스를 재배치하고 메쉬렛을 생성
+NODISCARD std::vector<Meshlet> BuildMeshlets(std::span<Index> _indices, std::span<const VertexAttribute> _vertices, UInt32 _maxVertices = k_maxMeshletVertices, UInt32 _maxTriangles = k_maxMeshletTriangles);
+
+// 행 벡터 규약 (v * M) 의 view * projection 행렬에서 절두체 평면을 추출 (D3D 클립 공간)
+NODISCARD std::array<Vec4, 6> ExtractFrustumPlanes(const Mat4& _viewProjection);
+
+// 보이는 메쉬렛의 인덱스 구간을 출력 (인접한 구간은 병합됨). 보이는 메쉬렛 수를 반환
+// _world 는 균등 스케일을 가정함
+UInt32 CullMeshlets(std::span<const Meshlet> _meshlets, const Mat4& _world, const MeshletCullParams& _params, std::vector<IndexRange>& _out_ranges);
+
+}   // namespace jam
\ No newline at end of file
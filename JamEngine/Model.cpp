@@ -4,22 +4,66 @@
 
 #include "ModelExporter.h"
 #include "ModelLoader.h"
+#include "ThreadPool.h"
 
 namespace jam
 {
 
-void Model::Initialize(const std::span<const ModelNodeData> _nodes)
+Bounds ComputeNodeBounds(const ModelNodeData& _node)
+{
+    if (_node.packedMeshData.IsEmpty())
+    {
+        return ComputeBounds(_node.meshData.vertices);
+    }
+    return ComputeBounds(_node.packedMeshData.vertices, _node.vertexType, _node.quantization);
+}
+
+void ComputeMissingNodeBounds(const std::span<ModelNodeData> _nodes)
+{
+    ThreadPool::GetGlobal().ParallelFor(static_cast<UInt32>(_nodes.size()), [_nodes](const UInt32 _index) {
+        ModelNodeData& node = _nodes[_index];
+        if (!node.bounds.IsValid())
+        {
+            node.bounds = ComputeNodeBounds(node);
+        }
+    });
+}
+
+GeometryMemoryStats& GeometryMemoryStats::operator+=(const GeometryMemoryStats& _other)
+{
+    vertexByteWidth += _other.vertexByteWidth;
+    indexByteWidth += _other.indexByteWidth;
+    wideIndexByteWidth += _other.wideIndexByteWidth;
+    cpuByteWidth += _other.cpuByteWidth;
+    return *this;
+}
+
+bool Model::Initialize(const std::span<const ModelNodeData> _nodes, const eGeometryRetention _retention)
 {
     m_nodes.reserve(_nodes.size());
     for (const ModelNodeData& node: _nodes)
     {
-        Mesh mesh;
-        mesh.Initialize(node.meshData, node.vertexType, node.topology);
-        m_nodes.emplace_back(node.name, std::move(mesh), node.material);
+        Mesh       mesh;
+        const bool bResult = node.packedMeshData.IsEmpty() ? mesh.Initialize(node.meshData, node.vertexType, node.topology, _retention, node.quantization)
+                                                           : mesh.Initialize(node.packedMeshData, node.vertexType, node.topology, _retention, node.quantization);
+        if (!bResult)
+        {
+            JAM_ERROR("Failed to initialize model node mesh: {}", node.name);
+            Reset();   // 이미 만든 노드의 구간도 풀에 돌려줌
+            return false;
+        }
+
+        // 경계가 없는 노드 (직접 만든 노드 데이터 등) 만 계산
+        const Bounds bounds = node.bounds.IsValid() ? node.bounds : ComputeNodeBounds(node);
+        m_nodes.emplace_back(node.name, std::move(mesh), node.material, node.meshlets, node.lods, bounds);
+        m_bounds.Merge(bounds);
     }
+
+    BuildLodSummary_();
+    return true;
 }
 
-bool Model::LoadFromFile(AssetManager& _assetMgrRef, const fs::path& _filePath)
+bool Model::LoadFromFile(AssetManager& _assetMgrRef, const fs::path& _filePath, const eGeometryRetention _retention)
 {
     ModelLoader loader;
     if (!loader.Load(_assetMgrRef, _filePath))
@@ -29,7 +73,11 @@ bool Model::LoadFromFile(AssetManager& _assetMgrRef, const fs::path& _filePath)
     }
 
     std::span<const ModelNodeData> loadData = loader.GetLoadData();
-    Initialize(loadData);
+    if (!Initialize(loadData, _retention))
+    {
+        JAM_ERROR("Failed to create model geometry: {}", _filePath.string());
+        return false;
+    }
     return true;
 }
 
@@ -47,9 +95,101 @@ bool Model::SaveToFile(const fs::path& _filePath) const
     return true;
 }
 
+MeshLod Model::Node::GetLod(const UInt32 _level) const
+{
+    if (lods.empty())
+    {
+        MeshLod lod;
+        lod.indexCount = mesh.GetIndexCount();
+        return lod;
+    }
+    return lods[std::min<size_t>(_level, lods.size() - 1)];
+}
+
+UInt32 Model::GetMaxLodCount() const
+{
+    UInt32 lodCount = 1;
+    for (const Node& node: m_nodes)
+    {
+        lodCount = std::max(lodCount, node.GetLodCount());
+    }
+    return lodCount;
+}
+
+float Model::GetLodError(const UInt32 _level) const
+{
+    if (m_lodErrors.empty())
+    {
+        return 0.f;
+    }
+    return m_lodErrors[std::min<size_t>(_level, m_lodErrors.size() - 1)];
+}
+
+UInt64 Model::GetLodTriangleCount(const UInt32 _level) const
+{
+    if (m_lodTriangleCounts.empty())
+    {
+        return 0;
+    }
+    return m_lodTriangleCounts[std::min<size_t>(_level, m_lodTriangleCounts.size() - 1)];
+}
+
+bool Model::HasCpuData() const
+{
+    return !m_nodes.empty() && std::ranges::all_of(m_nodes, [](const Node& _node) { return _node.mesh.HasCpuData(); });
+}
+
+GeometryMemoryStats Model::GetMemoryStats() const
+{
+    GeometryMemoryStats stats;
+    for (const Node& node: m_nodes)
+    {
+        const Mesh&  mesh       = node.mesh;
+        const UInt64 indexCount = mesh.GetIndexCount();
+        stats.vertexByteWidth += static_cast<UInt64>(mesh.GetVertexCount()) * GetVertexStride(mesh.GetVertexType());
+        stats.indexByteWidth += indexCount * GetIndexStride(mesh.GetIndexFormat());
+        stats.wideIndexByteWidth += indexCount * sizeof(UInt32);
+        if (mesh.HasCpuData())
+        {
+            const PackedMeshData cpuData = mesh.GetCpuData();
+            stats.cpuByteWidth += cpuData.vertices.size() + cpuData.indices.size();
+        }
+    }
+    return stats;
+}
+
+void Model::ReleaseCpuData()
+{
+    for (Node& node: m_nodes)
+    {
+        node.mesh.ReleaseCpuData();
+    }
+}
+
 void Model::Reset()
 {
     m_nodes.clear();
+    m_lodErrors.clear();
+    m_lodTriangleCounts.clear();
+    m_bounds = Bounds();
+}
+
+void Model::BuildLodSummary_()
+{
+    const UInt32 lodCount = GetMaxLodCount();
+    m_lodErrors.assign(lodCount, 0.f);
+    m_lodTriangleCounts.assign(lodCount, 0);
+
+    // 노드마다 LOD 수가 다를 수 있으므로 부족한 레벨은 노드의 가장 낮은 LOD 로 채움
+    for (const Node& node: m_nodes)
+    {
+        for (UInt32 level = 0; level < lodCount; ++level)
+        {
+            const MeshLod lod = node.GetLod(level);
+            m_lodErrors[level] = std::max(m_lodErrors[level], lod.error);
+            m_lodTriangleCounts[level] += lod.indexCount / 3;
+        }
+    }
 }
 
 }   // namespace jam
\ No newline at end of file
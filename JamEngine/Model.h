@@ -1,6 +1,9 @@
 #pragma once
+#include "Bounds.h"
 #include "Material.h"
 #include "Mesh.h"
+#include "MeshSimplifier.h"
+#include "Meshlet.h"
 
 namespace jam
 {
@@ -10,9 +13,36 @@ struct ModelNodeData
 {
     std::string name;
     MeshData    meshData;
-    eVertexType vertexType;
-    eTopology   topology;
-    Material    material;
+    eVertexType        vertexType;
+    eTopology          topology;
+    Material           material;
+    VertexQuantization quantization;   // 양자화 정점 타입에서만 사용
+
+    // 인덱스 버퍼의 구간. 비어있다면 메쉬렛 / LOD 가 없는 노드
+    std::vector<Meshlet> meshlets;   // LOD0 구간 안에 존재
+    std::vector<MeshLod> lods;
+
+    Bounds bounds;   // 모델 공간 경계 (임포트 / 쿠킹 시 계산되어 .jmodel 에 기록됨)
+
+    // zero-copy 로드 시 사용. meshData 대신 사용되며 로더가 소유한 메모리를 가리킴
+    PackedMeshData packedMeshData;
+};
+
+// 노드의 정점으로부터 경계를 계산 (패킹된 스트림이 있다면 스트림 기준)
+NODISCARD Bounds ComputeNodeBounds(const ModelNodeData& _node);
+
+// 경계가 없는 노드들의 경계를 병렬로 계산 (v1 파일 등 경계가 기록되지 않은 파일)
+void ComputeMissingNodeBounds(std::span<ModelNodeData> _nodes);
+
+// GPU 기하 버퍼 메모리
+struct GeometryMemoryStats
+{
+    UInt64 vertexByteWidth    = 0;
+    UInt64 indexByteWidth     = 0;   // 실제 인덱스 버퍼 크기
+    UInt64 wideIndexByteWidth = 0;   // 모든 인덱스가 32비트일 때의 크기
+    UInt64 cpuByteWidth       = 0;   // eGeometryRetention 으로 유지한 CPU 사본 크기
+
+    GeometryMemoryStats& operator+=(const GeometryMemoryStats& _other);
 };
 
 class Model
@@ -20,14 +50,35 @@ class Model
 public:
     struct Node
     {
-        std::string name;
-        Mesh        mesh;
-        Material    material;
+        std::string          name;
+        Mesh                 mesh;
+        Material             material;
+        std::vector<Meshlet> meshlets;   // CullMeshlets() 로 그릴 인덱스 구간을 고를 수 있음
+        std::vector<MeshLod> lods;       // 비어있다면 인덱스 버퍼 전체가 LOD0
+        Bounds               bounds;     // 모델 공간 경계
+
+        NODISCARD UInt32  GetLodCount() const { return lods.empty() ? 1 : static_cast<UInt32>(lods.size()); }
+        NODISCARD MeshLod GetLod(UInt32 _level) const;   // 범위를 넘으면 가장 낮은 LOD
     };
 
-    void Initialize(std::span<const ModelNodeData> _nodes);
-    bool LoadFromFile(AssetManager& _assetMgrRef, const fs::path& _filePath);
-    bool SaveToFile(const fs::path& _filePath) const;
+    bool Initialize(std::span<const ModelNodeData> _nodes, eGeometryRetention _retention = eGeometryRetention::GpuOnly);   // 메쉬 하나라도 실패하면 비어있는 모델
+    bool LoadFromFile(AssetManager& _assetMgrRef, const fs::path& _filePath, eGeometryRetention _retention = eGeometryRetention::GpuOnly);
+    bool SaveToFile(const fs::path& _filePath) const;   // CPU 사본이 있다면 GPU 를 거치지 않음
+
+    NODISCARD UInt32 GetMaxLodCount() const;
+    NODISCARD bool   HasCpuData() const;
+    void             ReleaseCpuData();
+
+    NODISCARD GeometryMemoryStats GetMemoryStats() const;
+
+    // 런타임 LOD 선택용 모델 단위 요약 (Initialize 에서 계산, 범위를 넘는 레벨은 가장 낮은 LOD)
+    NODISCARD float       GetLodError(UInt32 _level) const;           // 노드 오차 중 최댓값 (모델 공간)
+    NODISCARD UInt64      GetLodTriangleCount(UInt32 _level) const;   // 노드 삼각형 수의 합
+    NODISCARD const Vec3& GetBoundsCenter() const { return m_bounds.center; }
+    NODISCARD float       GetBoundsRadius() const { return m_bounds.radius; }
+
+    // 모든 노드 경계의 합집합 (모델 공간)
+    NODISCARD const Bounds& GetBounds() const { return m_bounds; }
 
     void Reset();
 
@@ -35,7 +86,13 @@ public:
     NODISCARD auto GetNodesRef() { return std::span<Node>(m_nodes); }
 
 private:
+    void BuildLodSummary_();
+
     std::vector<Node> m_nodes;
+
+    std::vector<float>  m_lodErrors;
+    std::vector<UInt64> m_lodTriangleCounts;
+    Bounds              m_bounds;
 };
 
 }   // namespace jam
\ No newline at end of file
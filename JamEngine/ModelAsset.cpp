@@ -2,8 +2,6 @@
 
 #include "ModelAsset.h"
 
-#include "ModelLoader.h"
-
 namespace jam
 {
 
@@ -20,7 +18,7 @@ bool ModelAsset::Save(const fs::path& _path) const
 
 bool ModelAsset::Load(AssetManager& _assetMgrRef, const fs::path& _path)
 {
-    if (!m_model.LoadFromFile(_assetMgrRef, _path))
+    if (!m_model.LoadFromFile(_assetMgrRef, _path, m_geometryRetention))
     {
         JAM_ERROR("ModelAsset::Load() - Failed to load model from file: {}", _path.string());
         return false;
@@ -30,6 +28,57 @@ bool ModelAsset::Load(AssetManager& _assetMgrRef, const fs::path& _path)
     return true;
 }
 
+bool ModelAsset::PrepareLoad(const fs::path& _path, const AssetFile& _file)
+{
+    m_pPendingLoader = MakeScope<ModelLoader>();
+    if (!m_pPendingLoader->Load(_file))
+    {
+        JAM_ERROR("ModelAsset::PrepareLoad() - Failed to load model from file: {}", _path.string());
+        m_pPendingLoader.reset();
+        return false;
+    }
+    return true;
+}
+
+bool ModelAsset::FinalizeLoad(AssetManager& _assetMgrRef, const fs::path& _path)
+{
+    JAM_ASSERT(m_pPendingLoader, "ModelAsset::FinalizeLoad() - PrepareLoad() must succeed first");
+
+    // 텍스처는 기다리지 않고 요청만 함 (같은 텍스처를 쓰는 모델끼리는 요청을 공유)
+    m_pPendingLoader->ResolveTextures(_assetMgrRef, true);
+    const bool bResult = m_model.Initialize(m_pPendingLoader->GetLoadData(), m_geometryRetention);
+    m_pPendingLoader.reset();
+    if (!bResult)
+    {
+        JAM_ERROR("ModelAsset::FinalizeLoad() - Failed to create model geometry: {}", _path.string());
+        return false;
+    }
+
+    m_path = _path;
+    return true;
+}
+
+void ModelAsset::GatherDependencies(MAYBE_UNUSED const fs::path& _path, const AssetFile& _file, std::vector<AssetDependency>& _out_dependencies) const
+{
+    std::vector<std::string> texturePaths;
+    if (ModelLoader::ReadTexturePaths(_file.GetData(), texturePaths))
+    {
+        for (std::string& texturePath: texturePaths)
+        {
+            _out_dependencies.emplace_back(eAssetType::Texture, std::move(texturePath));
+        }
+    }
+}
+
+void ModelAsset::SetGeometryRetention(const eGeometryRetention _retention)
+{
+    m_geometryRetention = _retention;
+    if (_retention == eGeometryRetention::GpuOnly)
+    {
+        m_model.ReleaseCpuData();
+    }
+}
+
 void ModelAsset::Unload()
 {
     m_path.clear();
@@ -41,4 +90,10 @@ eAssetType ModelAsset::GetType() const
     return s_type;
 }
 
+UInt64 ModelAsset::GetResidentByteSize() const
+{
+    const GeometryMemoryStats stats = m_model.GetMemoryStats();
+    return stats.vertexByteWidth + stats.indexByteWidth + stats.cpuByteWidth;
+}
+
 }   // namespace jam
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include "Asset.h"
 #include "Model.h"
+#include "ModelLoader.h"
 
 namespace jam
 {
@@ -20,14 +21,30 @@ public:
     bool Save(const fs::path& _path) const override;
     void Unload() override;
 
+    bool PrepareLoad(const fs::path& _path, const AssetFile& _file) override;        // 워커 스레드: 스트림 압축 해제
+    bool FinalizeLoad(AssetManager& _assetMgrRef, const fs::path& _path) override;   // 메인 스레드: 메쉬 업로드, 텍스처 요청
+    void GatherDependencies(const fs::path& _path, const AssetFile& _file, std::vector<AssetDependency>& _out_dependencies) const override;   // 머티리얼 텍스처
+
     NODISCARD eAssetType   GetType() const override;
+    NODISCARD UInt64       GetResidentByteSize() const override;
     NODISCARD const Model& GetModel() const { return m_model; }
     NODISCARD Model&       GetModelRef() { return m_model; }
 
+    // CPU 기하 사본 유지 정책. 로드 이후 GpuOnly 로 바꾸면 사본을 즉시 해제함
+    void                         SetGeometryRetention(eGeometryRetention _retention);
+    NODISCARD eGeometryRetention GetGeometryRetention() const { return m_geometryRetention; }
+
+    // 새로 생성되는 에셋의 기본 정책 (에디터처럼 익스포트가 잦다면 CpuCopy)
+    static void SetDefaultGeometryRetention(const eGeometryRetention _retention) { s_defaultGeometryRetention = _retention; }
+
     constexpr static eAssetType s_type = eAssetType::Model;
 
 private:
-    Model m_model;
+    Model              m_model;
+    eGeometryRetention m_geometryRetention = s_defaultGeometryRetention;
+    Scope<ModelLoader> m_pPendingLoader;   // PrepareLoad 의 결과 (FinalizeLoad 에서 해제)
+
+    inline static eGeometryRetention s_defaultGeometryRetention = eGeometryRetention::GpuOnly;
 };
 
 }   // namespace jam
\ No newline at end of file
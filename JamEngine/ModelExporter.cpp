@@ -4,7 +4,9 @@
 
 #include "BufferReader.h"
 #include "Model.h"
+#include "ModelFormat.h"
 #include "TextureAsset.h"
+#include "ThreadPool.h"
 #include "vendor/flatbuffers/compiled/model_generated.h"
 
 #include <fstream>
@@ -19,11 +21,6 @@ NODISCARD fbs::Vec3 ToFlatBuffersVec3(const Vec3& vec)
     return { vec.x, vec.y, vec.z };
 }
 
-NODISCARD fbs::Vec2 ToFlatBuffersVec2(const Vec2& vec)
-{
-    return { vec.x, vec.y };
-}
-
 NODISCARD fbs::eVertexType ToFlatBuffersVertexType(const eVertexType vertexType)
 {
     switch (vertexType)
@@ -31,12 +28,19 @@ NODISCARD fbs::eVertexType ToFlatBuffersVertexType(const eVertexType vertexType)
         case eVertexType::Vertex2: return fbs::eVertexType_Vertex2;
         case eVertexType::Vertex3: return fbs::eVertexType_Vertex3;
         case eVertexType::Vertex3PosOnly: return fbs::eVertexType_Vertex3PosOnly;
+        case eVertexType::Vertex3Compact: return fbs::eVertexType_Vertex3Compact;
+        case eVertexType::Vertex3Quantized: return fbs::eVertexType_Vertex3Quantized;
         default:
             JAM_ERROR("Unknown vertex type");
             return fbs::eVertexType_Vertex3;   // Default fallback
     }
 }
 
+NODISCARD fbs::eIndexFormat ToFlatBuffersIndexFormat(const eIndexFormat indexFormat)
+{
+    return indexFormat == eIndexFormat::UInt16 ? fbs::eIndexFormat_UInt16 : fbs::eIndexFormat_UInt32;
+}
+
 NODISCARD fbs::eTopology ToFlatBuffersTopology(const eTopology topology)
 {
     switch (topology)
@@ -81,71 +85,53 @@ bool ModelExporter::Load(const Model& _model)
 {
     Clear_();
 
-    BufferReader reader;   // 메모리 풀
+    BufferReader reader;   // 메모리 풀 (CPU 사본이 없는 경우에만 사용)
     for (const Model::Node& node: _model.GetNodes())
     {
-        // 필요한 mesh 데이터 추출
-        const Mesh&         gpuMesh     = node.mesh;
-        const VertexBuffer& gpuVertices = gpuMesh.GetVertexBuffer();
-        eVertexType         vertexT     = gpuMesh.GetVertexType();
-        eTopology           topology    = gpuMesh.GetTopology();
-
-        // 노드 데이터 생성
-        MeshData cpuMeshData;
-
-        // 메쉬 기하 추출
+        const Mesh&   mesh = node.mesh;
+        ModelNodeData nodeData;
+        nodeData.name         = node.name;
+        nodeData.vertexType   = mesh.GetVertexType();
+        nodeData.topology     = mesh.GetTopology();
+        nodeData.material     = node.material;
+        nodeData.meshlets     = node.meshlets;
+        nodeData.lods         = node.lods;
+        nodeData.quantization = mesh.GetVertexQuantization();
+        nodeData.bounds       = node.bounds;
+
+        // CPU 사본이 있다면 그대로 참조 (GPU 왕복 없음)
+        if (mesh.HasCpuData())
         {
-            // 버텍스 버퍼
-            {
-                auto [cpuVertics, bReseult] = reader.ReadBuffer(gpuVertices);
-                if (bReseult == false)   // 로드 실패
-                {
-                    JAM_ERROR("ModelExporter::Load() - Failed to read vertex buffer data for node: {}", node.name);
-                    return false;
-                }
-
-                const UInt32 stride = gpuVertices.GetStride();
-                JAM_ASSERT(cpuVertics.size() % stride == 0, "Vertex buffer size is not a multiple of vertex stride.");   // stride가 맞지 않으면 문제가 생길 수 있음
-                UInt32 vertexCount = static_cast<UInt32>(cpuVertics.size() / stride);                                    // 버텍스 개수
-                cpuMeshData.vertices.reserve(vertexCount);                                                               // 버텍스 개수만큼 미리 예약
-                for (UInt32 i = 0; i < vertexCount; ++i)
-                {
-                    VertexAttribute vertex;
-                    UnpackVertex(vertexT, cpuVertics.data() + i * stride, vertex);
-                    cpuMeshData.vertices.emplace_back(vertex);
-                }
-            }
+            nodeData.packedMeshData = mesh.GetCpuData();
+            m_nodes.emplace_back(std::move(nodeData));
+            continue;
+        }
 
-            // 인덱스 버퍼
-            {
-                const IndexBuffer& gpuIndices = node.mesh.GetIndexBuffer();
-                auto [cpuIndices, bResult]    = reader.ReadBuffer(gpuIndices);
-
-                if (bResult == false)   // 로드 실패
-                {
-                    JAM_ERROR("ModelExporter::Load() - Failed to read index buffer data for node: {}", node.name);
-                    return false;
-                }
-
-                JAM_ASSERT(cpuIndices.size() % sizeof(Index) == 0, "Index buffer size is not a multiple of index size.");
-                UInt32 indexCount = static_cast<UInt32>(cpuIndices.size() / sizeof(Index));
-                cpuMeshData.indices.reserve(indexCount);
-                for (UInt32 i = 0; i < indexCount; ++i)
-                {
-                    Index index;
-                    std::memcpy(&index, cpuIndices.data() + i * sizeof(Index), sizeof(Index));
-                    cpuMeshData.indices.emplace_back(index);
-                }
-            }
+        // GPU 버퍼에서 읽어옴 - 패킹된 스트림을 그대로 보관하므로 손실 없음 (풀 페이지에서 메쉬 구간만)
+        const UInt32 vertexStride         = GetVertexStride(nodeData.vertexType);
+        const UInt32 indexStride          = GetIndexStride(mesh.GetIndexFormat());
+        auto [cpuVertices, bVertexResult] = reader.ReadBuffer(mesh.GetVertexBuffer(), mesh.GetBaseVertex() * vertexStride, mesh.GetVertexCount() * vertexStride);
+        auto [cpuIndices, bIndexResult]   = reader.ReadBuffer(mesh.GetIndexBuffer(), mesh.GetStartIndex() * indexStride, mesh.GetIndexCount() * indexStride);
+        if (!bVertexResult || !bIndexResult)   // 로드 실패
+        {
+            JAM_ERROR("ModelExporter::Load() - Failed to read mesh buffer data for node: {}", node.name);
+            return false;
         }
 
-        m_nodes.emplace_back(node.name, std::move(cpuMeshData), vertexT, topology, node.material);
+        JAM_ASSERT(cpuVertices.size() % vertexStride == 0, "Vertex buffer size is not a multiple of vertex stride.");
+        JAM_ASSERT(cpuIndices.size() % indexStride == 0, "Index buffer size is not a multiple of index size.");
+
+        // 내부 벡터는 이동해도 메모리가 유지되므로 span 이 무효화되지 않음
+        nodeData.packedMeshData.vertices    = m_readbackVertices.emplace_back(std::move(cpuVertices));
+        nodeData.packedMeshData.indices     = m_readbackIndices.emplace_back(std::move(cpuIndices));
+        nodeData.packedMeshData.indexFormat = mesh.GetIndexFormat();
+        m_nodes.emplace_back(std::move(nodeData));
     }
 
     return true;
 }
 
-bool ModelExporter::Export(const fs::path& _path) const
+bool ModelExporter::Export(const fs::path& _path, const eCompressionCodec _codec) const
 {
     using namespace flatbuffers;
 
@@ -155,34 +141,154 @@ bool ModelExporter::Export(const fs::path& _path) const
         return false;
     }
 
+    // 노드 스트림을 GPU 레이아웃으로 패킹 (인덱스는 정점 수가 허용하는 가장 좁은 포맷)
+    auto packNode = [](const ModelNodeData& _node, std::vector<UInt8>& _packedVertices, std::vector<UInt8>& _packedIndices, PackedMeshData& _out_stream) {
+        if (_node.packedMeshData.IsEmpty())
+        {
+            const MeshData& meshData = _node.meshData;
+            _packedVertices.resize(meshData.vertices.size() * GetVertexStride(_node.vertexType));
+            PackVertices(meshData.vertices, _node.vertexType, _packedVertices.data(), _node.quantization);
+            _out_stream.vertices    = _packedVertices;
+            _out_stream.indexFormat = PackIndices(meshData.indices, meshData.vertices.size(), _packedIndices);
+            _out_stream.indices     = _packedIndices;
+        }
+        else   // 이미 패킹된 스트림은 그대로 기록
+        {
+            _out_stream              = _node.packedMeshData;
+            const size_t vertexCount = _out_stream.vertices.size() / GetVertexStride(_node.vertexType);
+            if (_out_stream.indexFormat == eIndexFormat::UInt32 && SelectIndexFormat(vertexCount) == eIndexFormat::UInt16)
+            {
+                const std::span<const Index> wideIndices(reinterpret_cast<const Index*>(_out_stream.indices.data()), _out_stream.GetIndexCount());
+                _out_stream.indexFormat = PackIndices(wideIndices, vertexCount, _packedIndices);
+                _out_stream.indices     = _packedIndices;
+            }
+        }
+    };
+
+    // 청크 압축 - 노드마다 독립적이므로 병렬로 처리
+    const bool                      bChunked = _codec != eCompressionCodec::None;
+    std::vector<std::vector<UInt8>> vertexChunks;
+    std::vector<std::vector<UInt8>> indexChunks;
+    std::vector<eIndexFormat>       indexFormats;
+    if (bChunked)
+    {
+        vertexChunks.resize(m_nodes.size());
+        indexChunks.resize(m_nodes.size());
+        indexFormats.resize(m_nodes.size());
+
+        std::atomic<bool> bFailed = false;
+        ThreadPool::GetGlobal().ParallelFor(static_cast<UInt32>(m_nodes.size()), [&](const UInt32 _index) {
+            std::vector<UInt8> packedVertices;
+            std::vector<UInt8> packedIndices;
+            PackedMeshData     stream;
+            packNode(m_nodes[_index], packedVertices, packedIndices, stream);
+            indexFormats[_index] = stream.indexFormat;
+
+            const CompressionStreamDesc vertexDesc    = { eCompressionStream::Vertex, GetVertexStride(m_nodes[_index].vertexType) };
+            const CompressionStreamDesc indexDesc     = { eCompressionStream::Index, GetIndexStride(stream.indexFormat) };
+            const bool                  bVertexResult = EncodeModelChunk(_codec, stream.vertices, vertexChunks[_index], vertexDesc);
+            const bool                  bIndexResult  = EncodeModelChunk(_codec, stream.indices, indexChunks[_index], indexDesc);
+            if (!bVertexResult || !bIndexResult)
+            {
+                bFailed = true;
+            }
+        });
+
+        if (bFailed)
+        {
+            JAM_ERROR("ModelExporter::Export() - Failed to compress mesh streams.");
+            return false;
+        }
+    }
+
+    // 경계가 없는 노드 (직접 만든 노드 데이터) 는 기록 전에 계산
+    std::vector<Bounds> nodeBounds(m_nodes.size());
+    ThreadPool::GetGlobal().ParallelFor(static_cast<UInt32>(m_nodes.size()), [&](const UInt32 _index) {
+        const ModelNodeData& node = m_nodes[_index];
+        nodeBounds[_index]        = node.bounds.IsValid() ? node.bounds : ComputeNodeBounds(node);
+    });
+
     FlatBufferBuilder                       builder;          // 플랫 버퍼의 빌더
     std::vector<Offset<fbs::ModelNodeData>> modelNodesData;   // 모델 노드 데이터
+    std::vector<UInt8>                      packedVertices;   // 정점 패킹 버퍼 (재사용)
+    std::vector<UInt8>                      packedIndices;    // 인덱스 패킹 버퍼 (재사용)
     modelNodesData.reserve(m_nodes.size());                   // 예약
-    for (const ModelNodeData& node: m_nodes)
+    for (size_t nodeIndex = 0; nodeIndex < m_nodes.size(); ++nodeIndex)
     {
+        const ModelNodeData& node = m_nodes[nodeIndex];
+
         // 이름
         const Offset<String> nameOffset = builder.CreateString(node.name);
 
-        // 메시 데이터
-        const MeshData&                           meshData = node.meshData;
-        std::vector<Offset<fbs::VertexAttribute>> fbsVertices;   // 버텍스 속성 fbs 벡터
-        fbsVertices.reserve(meshData.vertices.size());
-        for (const VertexAttribute& vertex: meshData.vertices)
+        // 메쉬렛
+        std::vector<fbs::Meshlet> fbsMeshlets;
+        fbsMeshlets.reserve(node.meshlets.size());
+        for (const Meshlet& meshlet: node.meshlets)
         {
-            fbs::Vec3 position  = ToFlatBuffersVec3(vertex.position);
-            fbs::Vec3 color     = ToFlatBuffersVec3(vertex.color);
-            fbs::Vec3 normal    = ToFlatBuffersVec3(vertex.normal);
-            fbs::Vec2 uv0       = ToFlatBuffersVec2(vertex.uv0);
-            fbs::Vec2 uv1       = ToFlatBuffersVec2(vertex.uv1);
-            fbs::Vec3 tangent   = ToFlatBuffersVec3(vertex.tangent);
-            fbs::Vec3 bitangent = ToFlatBuffersVec3(vertex.bitangent);
-            fbsVertices.emplace_back(fbs::CreateVertexAttribute(builder, &position, &color, &normal, &uv0, &uv1, &tangent, &bitangent));
+            fbsMeshlets.emplace_back(meshlet.startIndex, meshlet.indexCount, ToFlatBuffersVec3(meshlet.center), meshlet.radius, ToFlatBuffersVec3(meshlet.coneAxis), meshlet.coneCutoff);
         }
+        const Offset<Vector<const fbs::Meshlet*>> meshletsOffset = fbsMeshlets.empty() ? 0 : builder.CreateVectorOfStructs(fbsMeshlets);
+
+        // LOD
+        std::vector<fbs::MeshLod> fbsLods;
+        fbsLods.reserve(node.lods.size());
+        for (const MeshLod& lod: node.lods)
+        {
+            fbsLods.emplace_back(lod.startIndex, lod.indexCount, lod.error);
+        }
+        const Offset<Vector<const fbs::MeshLod*>> lodsOffset = fbsLods.empty() ? 0 : builder.CreateVectorOfStructs(fbsLods);
+
+        // 정점 스트림 레이아웃
+        std::vector<fbs::VertexElement> fbsVertexLayout;
+        for (const VertexElementDesc& element: GetVertexElements(node.vertexType))
+        {
+            fbsVertexLayout.emplace_back(EnumToInt(element.attribute), EnumToInt(element.format), static_cast<UInt16>(element.offset));
+        }
+        const Offset<Vector<const fbs::VertexElement*>> vertexLayoutOffset = builder.CreateVectorOfStructs(fbsVertexLayout);
+
+        // 양자화 위치 복원 변환
+        const bool       bQuantized      = IsQuantizedVertexType(node.vertexType);
+        const fbs::Vec3  positionOffset  = ToFlatBuffersVec3(node.quantization.positionOffset);
+        const fbs::Vec3  positionScale   = ToFlatBuffersVec3(node.quantization.positionScale);
+        const fbs::Vec3* pPositionOffset = bQuantized ? &positionOffset : nullptr;
+        const fbs::Vec3* pPositionScale  = bQuantized ? &positionScale : nullptr;
 
         // 버텍스, 인덱스, 메쉬 데이터
-        const Offset<Vector<Offset<fbs::VertexAttribute>>> verticesOffset = builder.CreateVector(fbsVertices);
-        const Offset<Vector<UInt32>>                       indicesOffset  = builder.CreateVector(meshData.indices);
-        const Offset<fbs::MeshData>                        meshDataOffset = fbs::CreateMeshData(builder, verticesOffset, indicesOffset);
+        Offset<fbs::MeshData> meshDataOffset;
+        if (bChunked)
+        {
+            const std::vector<UInt8>& vertexChunk = vertexChunks[nodeIndex];
+            const std::vector<UInt8>& indexChunk  = indexChunks[nodeIndex];
+            builder.ForceVectorAlignment(vertexChunk.size(), sizeof(UInt8), k_modelStreamAlignment);
+            const Offset<Vector<UInt8>> vertexChunkOffset = builder.CreateVector(vertexChunk);
+            builder.ForceVectorAlignment(indexChunk.size(), sizeof(UInt8), k_modelStreamAlignment);
+            const Offset<Vector<UInt8>> indexChunkOffset = builder.CreateVector(indexChunk);
+            const fbs::eIndexFormat     indexFormat      = ToFlatBuffersIndexFormat(indexFormats[nodeIndex]);
+            meshDataOffset                               = fbs::CreateMeshData(builder, 0 /* v1 vertices */, 0, 0, vertexChunkOffset, indexChunkOffset, meshletsOffset, lodsOffset, pPositionOffset, pPositionScale, indexFormat, 0, vertexLayoutOffset);
+        }
+        else
+        {
+            PackedMeshData stream;
+            packNode(node, packedVertices, packedIndices, stream);
+
+            builder.ForceVectorAlignment(stream.vertices.size(), sizeof(UInt8), k_modelStreamAlignment);
+            const Offset<Vector<UInt8>> vertexStreamOffset = builder.CreateVector(stream.vertices.data(), stream.vertices.size());
+
+            // 인덱스는 포맷에 맞는 벡터에 기록
+            const UInt32           indexCount      = stream.GetIndexCount();
+            Offset<Vector<UInt32>> indicesOffset   = 0;
+            Offset<Vector<UInt16>> indices16Offset = 0;
+            builder.ForceVectorAlignment(indexCount, GetIndexStride(stream.indexFormat), k_modelStreamAlignment);
+            if (stream.indexFormat == eIndexFormat::UInt16)
+            {
+                indices16Offset = builder.CreateVector(reinterpret_cast<const UInt16*>(stream.indices.data()), indexCount);
+            }
+            else
+            {
+                indicesOffset = builder.CreateVector(reinterpret_cast<const UInt32*>(stream.indices.data()), indexCount);
+            }
+            meshDataOffset = fbs::CreateMeshData(builder, 0 /* v1 vertices */, indicesOffset, vertexStreamOffset, 0, 0, meshletsOffset, lodsOffset, pPositionOffset, pPositionScale, ToFlatBuffersIndexFormat(stream.indexFormat), indices16Offset, vertexLayoutOffset);
+        }
 
         // 머테리얼
         const Material& material      = node.material;
@@ -223,8 +329,12 @@ bool ModelExporter::Export(const fs::path& _path) const
             emissiveTexturePath,
             lightmapTexturePath);
 
+        // 경계
+        const Bounds&     bounds = nodeBounds[nodeIndex];
+        const fbs::Bounds fbsBounds(ToFlatBuffersVec3(bounds.min), ToFlatBuffersVec3(bounds.max), ToFlatBuffersVec3(bounds.center), bounds.radius);
+
         // 모델 노드 데이터 생성
-        modelNodesData.emplace_back(fbs::CreateModelNodeData(builder, nameOffset, meshDataOffset, ToFlatBuffersVertexType(node.vertexType), ToFlatBuffersTopology(node.topology), materialOffset));
+        modelNodesData.emplace_back(fbs::CreateModelNodeData(builder, nameOffset, meshDataOffset, ToFlatBuffersVertexType(node.vertexType), ToFlatBuffersTopology(node.topology), materialOffset, &fbsBounds));
     }
 
     // 최종 모델 데이터 생성
@@ -232,6 +342,13 @@ bool ModelExporter::Export(const fs::path& _path) const
     const Offset<fbs::ModelData>                     modelData   = fbs::CreateModelData(builder, nodesVector);
     builder.Finish(modelData);
 
+    // 헤더
+    ModelFileHeader header;
+    header.flags            = bChunked ? eModelFileFlags_Chunked : eModelFileFlags_None;
+    header.payloadOffset    = sizeof(ModelFileHeader);
+    header.payloadByteWidth = builder.GetSize();
+    header.checksum         = ComputeModelFileHeaderChecksum(header);
+
     // 파일 저장
     std::fstream fs(_path, std::ios::out | std::ios::binary);
     if (!fs.is_open())
@@ -239,7 +356,13 @@ bool ModelExporter::Export(const fs::path& _path) const
         JAM_ERROR("ModelExporter::Export() - Failed to open file: {}", _path.string());
         return false;
     }
+    fs.write(reinterpret_cast<const char*>(&header), sizeof(ModelFileHeader));
     fs.write(reinterpret_cast<const char*>(builder.GetBufferPointer()), builder.GetSize());
+    if (!fs.flush())   // 디스크 부족 등으로 잘린 파일은 실패로 처리 (ModelImportCache 의 엔트리가 커밋되지 않도록)
+    {
+        JAM_ERROR("ModelExporter::Export() - Failed to write file: {}", _path.string());
+        return false;
+    }
     return true;
 }
 
@@ -1,21 +1,26 @@
 #pragma once
+#include "Compression.h"
 #include "ModelImporter.h"
 
 namespace jam
 {
 
+// 노드 데이터를 .jmodel 로 기록
+// Load(const Model&) 은 메쉬의 CPU 사본이 있다면 이를 참조하므로 익스포트가 끝날 때까지 모델이 살아있어야 함
 class ModelExporter
 {
 public:
     void           Load(std::span<const ModelNodeData> _nodes);
     bool           Load(const Model& _model);
-    bool           Export(const fs::path& _path) const;
+    bool           Export(const fs::path& _path, eCompressionCodec _codec = eCompressionCodec::None) const;
     NODISCARD bool IsLoaded() const { return m_nodes.empty() == false; }
 
 private:
     void Clear_();
 
-    std::vector<ModelNodeData> m_nodes;
+    std::vector<ModelNodeData>      m_nodes;
+    std::vector<std::vector<UInt8>> m_readbackVertices;   // CPU 사본이 없는 메쉬를 GPU 에서 읽어온 스트림
+    std::vector<std::vector<UInt8>> m_readbackIndices;
 };
 
 }   // namespace jam
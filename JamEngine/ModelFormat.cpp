@@ -0,0 +1,168 @@
+#include "pch.h"
+
+#include "ModelFormat.h"
+
+namespace
+{
+
+// FNV-1a (32bit) - 헤더는 작기 때문에 충분함
+NODISCARD jam::UInt32 ComputeHeaderChecksum(const void* _pHeader, const size_t _byteWidth)
+{
+    constexpr jam::UInt32 k_fnvOffsetBasis = 2166136261u;
+    constexpr jam::UInt32 k_fnvPrime       = 16777619u;
+
+    const jam::UInt8* pBytes   = static_cast<const jam::UInt8*>(_pHeader);
+    jam::UInt32       checksum = k_fnvOffsetBasis;
+    for (size_t i = 0; i < _byteWidth; ++i)
+    {
+        checksum ^= pBytes[i];
+        checksum *= k_fnvPrime;
+    }
+    return checksum;
+}
+
+}   // namespace
+
+namespace jam
+{
+
+UInt32 ComputeModelFileHeaderChecksum(const ModelFileHeader& _header)
+{
+    return ComputeHeaderChecksum(&_header, offsetof(ModelFileHeader, checksum));
+}
+
+bool HasModelFileHeader(const std::span<const UInt8> _file)
+{
+    if (_file.size() < sizeof(ModelFileHeader))
+    {
+        return false;
+    }
+
+    UInt32 magic;
+    std::memcpy(&magic, _file.data(), sizeof(magic));
+    return magic == k_modelFileMagic;
+}
+
+Result<ModelFileHeader> ReadModelFileHeader(const std::span<const UInt8> _file)
+{
+    if (_file.size() < sizeof(ModelFileHeader))
+    {
+        return Fail;
+    }
+
+    ModelFileHeader header;
+    std::memcpy(&header, _file.data(), sizeof(ModelFileHeader));
+
+    if (header.magic != k_modelFileMagic)
+    {
+        return Fail;
+    }
+
+    if (header.version != k_modelFileVersion)
+    {
+        JAM_ERROR("ReadModelFileHeader() - Unsupported model file version: {}", header.version);
+        return Fail;
+    }
+
+    if (header.checksum != ComputeModelFileHeaderChecksum(header))
+    {
+        JAM_ERROR("ReadModelFileHeader() - Header checksum mismatch");
+        return Fail;
+    }
+
+    // 잘린 파일 검사 (조작된 크기로 덧셈이 넘치지 않도록 남은 크기와 비교)
+    if (header.payloadOffset < sizeof(ModelFileHeader) || header.payloadOffset > _file.size() || header.payloadByteWidth > _file.size() - header.payloadOffset)
+    {
+        JAM_ERROR("ReadModelFileHeader() - Payload range exceeds file size");
+        return Fail;
+    }
+
+    return header;
+}
+
+bool EncodeModelChunk(const eCompressionCodec _codec, const std::span<const UInt8> _raw, std::vector<UInt8>& _out_chunk, const CompressionStreamDesc& _desc)
+{
+    const ICompressionCodec* pCodec = GetCompressionCodec(_codec);
+    if (pCodec == nullptr)
+    {
+        JAM_ERROR("EncodeModelChunk() - Codec is not registered: {}", EnumToInt(_codec));
+        return false;
+    }
+
+    // 청크 헤더는 32비트 크기를 기록하며 코덱마다 한 번에 압축할 수 있는 크기가 제한됨 (LZ4 는 int)
+    if (_raw.size() > std::numeric_limits<UInt32>::max() || _raw.size() > pCodec->GetMaxRawByteWidth())
+    {
+        JAM_ERROR("EncodeModelChunk() - Stream is too large for a chunk: {} bytes (codec {})", _raw.size(), EnumToInt(_codec));
+        return false;
+    }
+
+    ModelChunkHeader header;
+    header.rawByteWidth = static_cast<UInt32>(_raw.size());
+
+    // 압축
+    _out_chunk.resize(sizeof(ModelChunkHeader) + pCodec->GetMaxCompressedSize(_raw.size()));
+    const std::span<UInt8> payload = std::span(_out_chunk).subspan(sizeof(ModelChunkHeader));
+    auto [storedByteWidth, bResult] = pCodec->Compress(_raw, payload, _desc);
+
+    if (bResult && storedByteWidth < _raw.size())
+    {
+        header.codec           = static_cast<UInt8>(_codec);
+        header.storedByteWidth = static_cast<UInt32>(storedByteWidth);
+    }
+    else   // 압축 실패 혹은 이득이 없음 - 원본 저장
+    {
+        _out_chunk.resize(sizeof(ModelChunkHeader) + _raw.size());
+        std::memcpy(_out_chunk.data() + sizeof(ModelChunkHeader), _raw.data(), _raw.size());
+        header.codec           = static_cast<UInt8>(eCompressionCodec::None);
+        header.storedByteWidth = static_cast<UInt32>(_raw.size());
+    }
+
+    _out_chunk.resize(sizeof(ModelChunkHeader) + header.storedByteWidth);
+    header.checksum = ComputeHeaderChecksum(&header, offsetof(ModelChunkHeader, checksum));
+    std::memcpy(_out_chunk.data(), &header, sizeof(ModelChunkHeader));
+    return true;
+}
+
+Result<ModelChunkHeader> ReadModelChunkHeader(const std::span<const UInt8> _chunk)
+{
+    if (_chunk.size() < sizeof(ModelChunkHeader))
+    {
+        return Fail;
+    }
+
+    ModelChunkHeader header;
+    std::memcpy(&header, _chunk.data(), sizeof(ModelChunkHeader));
+
+    if (header.checksum != ComputeHeaderChecksum(&header, offsetof(ModelChunkHeader, checksum)))
+    {
+        JAM_ERROR("ReadModelChunkHeader() - Chunk header checksum mismatch");
+        return Fail;
+    }
+
+    if (sizeof(ModelChunkHeader) + static_cast<size_t>(header.storedByteWidth) > _chunk.size())
+    {
+        JAM_ERROR("ReadModelChunkHeader() - Chunk payload exceeds chunk size");
+        return Fail;
+    }
+
+    return header;
+}
+
+bool DecodeModelChunk(const std::span<const UInt8> _chunk, const std::span<UInt8> _dst)
+{
+    auto [header, bResult] = ReadModelChunkHeader(_chunk);
+    if (!bResult || header.rawByteWidth != _dst.size())
+    {
+        return false;
+    }
+
+    const ICompressionCodec* pCodec = GetCompressionCodec(static_cast<eCompressionCodec>(header.codec));
+    if (pCodec == nullptr)
+    {
+        return false;
+    }
+
+    return pCodec->Decompress(_chunk.subspan(sizeof(ModelChunkHeader), header.storedByteWidth), _dst);
+}
+
+}   // namespace jam
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+#include "Compression.h"
+
+namespace jam
+{
+
+// .jmodel 파일 레이아웃
+// v1: flatbuffers 페이로드만 존재 (정점마다 VertexAttribute 테이블)
+// v2: ModelFileHeader + flatbuffers 페이로드 (정점은 eVertexType 의 GPU 레이아웃 바이트 스트림)
+//     eModelFileFlags_Chunked 라면 정점/인덱스 스트림은 ModelChunkHeader + 압축된 데이터로 저장됨
+// v3: 탄젠트에 종법선 부호 추가 (Vertex3 탄젠트는 float4, 압축 타입은 옥타헤드럴 y 의 최하위 비트)
+
+constexpr UInt32 k_modelFileMagic       = 0x4C444D4A;   // "JMDL" (little endian)
+constexpr UInt32 k_modelFileVersion     = 3;
+constexpr UInt32 k_modelStreamAlignment = 16;   // 정점/인덱스 스트림 정렬
+
+NODISCARD constexpr size_t AlignModelStream(const size_t _offset)
+{
+    return (_offset + (k_modelStreamAlignment - 1)) & ~static_cast<size_t>(k_modelStreamAlignment - 1);
+}
+
+enum eModelFileFlags_ : UInt32
+{
+    eModelFileFlags_None    = 0,
+    eModelFileFlags_Chunked = 1 << 0,   // 스트림이 청크 컨테이너에 저장됨
+};
+using eModelFileFlags = std::underlying_type_t<eModelFileFlags_>;
+
+struct ModelFileHeader
+{
+    UInt32 magic            = k_modelFileMagic;
+    UInt32 version          = k_modelFileVersion;
+    UInt32 flags            = eModelFileFlags_None;
+    UInt32 payloadOffset    = 0;   // 파일 시작부터 flatbuffers 페이로드까지의 오프셋
+    UInt64 payloadByteWidth = 0;   // flatbuffers 페이로드 크기
+    UInt32 reserved         = 0;
+    UInt32 checksum         = 0;   // checksum 필드를 제외한 헤더의 체크섬 (반드시 마지막 필드)
+};
+static_assert(sizeof(ModelFileHeader) == 32, "ModelFileHeader layout must be stable");
+
+NODISCARD UInt32 ComputeModelFileHeaderChecksum(const ModelFileHeader& _header);
+
+// 헤더의 magic 만 확인 (v1 / v2 판별용)
+NODISCARD bool HasModelFileHeader(std::span<const UInt8> _file);
+
+// 헤더의 무결성 확인 (magic, version, checksum, 파일 크기)
+NODISCARD Result<ModelFileHeader> ReadModelFileHeader(std::span<const UInt8> _file);
+
+// 스트림 하나를 담는 청크. 청크끼리는 독립적으로 (병렬로) 해제할 수 있음
+struct ModelChunkHeader
+{
+    UInt8  codec           = 0;   // eCompressionCodec
+    UInt8  reserved[3]     = {};
+    UInt32 rawByteWidth    = 0;   // 해제 후 크기
+    UInt32 storedByteWidth = 0;   // 헤더 뒤에 저장된 데이터 크기
+    UInt32 checksum        = 0;   // checksum 필드를 제외한 헤더의 체크섬 (반드시 마지막 필드)
+};
+static_assert(sizeof(ModelChunkHeader) == 16, "ModelChunkHeader layout must be stable");
+
+// 압축해도 작아지지 않는 스트림은 None 코덱으로 저장됨. _desc 는 스트림 구조를 사용하는 코덱 (Geometry) 에 전달됨
+bool                               EncodeModelChunk(eCompressionCodec _codec, std::span<const UInt8> _raw, std::vector<UInt8>& _out_chunk, const CompressionStreamDesc& _desc = {});
+NODISCARD Result<ModelChunkHeader> ReadModelChunkHeader(std::span<const UInt8> _chunk);
+bool                               DecodeModelChunk(std::span<const UInt8> _chunk, std::span<UInt8> _dst);
+
+}   // namespace jam
\ No newline at end of file
@@ -0,0 +1,158 @@
+#include "pch.h"
+
+#include "ModelImportCache.h"
+
+#include "MappedFile.h"
+#include "ModelExporter.h"
+#include "ModelFormat.h"
+
+#include <xxhash.h>
+
+namespace jam
+{
+
+ModelImportCache::ModelImportCache(const fs::path& _directory, const UInt64 _maxByteWidth)
+    : m_directory(_directory)
+    , m_maxByteWidth(_maxByteWidth)
+{
+}
+
+Result<UInt64> ModelImportCache::ComputeKey(const fs::path& _sourcePath, const UInt32 _importFlags, const UInt64 _importSettings, const UInt32 _cookVersion) const
+{
+    MappedFile source;
+    if (!source.Open(_sourcePath))
+    {
+        JAM_ERROR("ModelImportCache::ComputeKey() - Failed to open source file: {}", _sourcePath.string());
+        return Fail;
+    }
+
+    // 소스 내용 + 임포트 설정 + 결과물에 영향을 주는 버전 (엔진, 파일 포맷, 쿠킹 파이프라인)
+    const std::span<const UInt8> bytes = source.GetData();
+    XXH3_state_t                 state;
+    XXH3_64bits_reset(&state);
+    XXH3_64bits_update(&state, bytes.data(), bytes.size());
+    XXH3_64bits_update(&state, &_importFlags, sizeof(_importFlags));
+    XXH3_64bits_update(&state, &_importSettings, sizeof(_importSettings));
+    XXH3_64bits_update(&state, &_cookVersion, sizeof(_cookVersion));
+    XXH3_64bits_update(&state, k_jamEngineVersion.data(), k_jamEngineVersion.size());
+    XXH3_64bits_update(&state, &k_modelFileVersion, sizeof(k_modelFileVersion));
+    return static_cast<UInt64>(XXH3_64bits_digest(&state));
+}
+
+fs::path ModelImportCache::GetEntryPath(const UInt64 _key) const
+{
+    return m_directory / std::format("{:016x}{}", _key, k_jamModelExtension);
+}
+
+Result<fs::path> ModelImportCache::Find(const UInt64 _key)
+{
+    fs::path        entryPath = GetEntryPath(_key);
+    std::error_code errorCode;
+    if (!fs::is_regular_file(entryPath, errorCode))
+    {
+        ++m_stats.missCount;
+        return Fail;
+    }
+
+    // LRU 갱신 - 마지막 수정 시간을 사용 시간으로 사용
+    fs::last_write_time(entryPath, fs::file_time_type::clock::now(), errorCode);
+    ++m_stats.hitCount;
+    return entryPath;
+}
+
+bool ModelImportCache::Store(const UInt64 _key, const std::span<const ModelNodeData> _nodes)
+{
+    std::error_code errorCode;
+    fs::create_directories(m_directory, errorCode);
+    if (errorCode)
+    {
+        JAM_ERROR("ModelImportCache::Store() - Failed to create cache directory: {}", m_directory.string());
+        return false;
+    }
+
+    // 임시 파일에 기록한 뒤 교체 (기록 도중 실패해도 깨진 엔트리가 남지 않음)
+    const fs::path entryPath = GetEntryPath(_key);
+    fs::path       tempPath  = entryPath;
+    tempPath += ".tmp";
+
+    ModelExporter exporter;
+    exporter.Load(_nodes);
+    if (!exporter.Export(tempPath, eCompressionCodec::Geometry))
+    {
+        JAM_ERROR("ModelImportCache::Store() - Failed to write cache entry: {}", entryPath.string());
+        fs::remove(tempPath, errorCode);
+        return false;
+    }
+
+    fs::rename(tempPath, entryPath, errorCode);
+    if (errorCode)
+    {
+        JAM_ERROR("ModelImportCache::Store() - Failed to commit cache entry: {}", entryPath.string());
+        fs::remove(tempPath, errorCode);
+        return false;
+    }
+
+    ++m_stats.storeCount;
+    Trim();
+    return true;
+}
+
+void ModelImportCache::Trim()
+{
+    struct Entry
+    {
+        fs::path           path;
+        fs::file_time_type lastUsedTime;
+        UInt64             byteWidth;
+    };
+
+    std::vector<Entry> entries;
+    UInt64             totalByteWidth = 0;
+    std::error_code    errorCode;
+    for (const fs::directory_entry& dirEntry: fs::directory_iterator(m_directory, errorCode))
+    {
+        if (!dirEntry.is_regular_file(errorCode) || dirEntry.path().extension() != k_jamModelExtension)
+        {
+            continue;
+        }
+
+        const UInt64 byteWidth = dirEntry.file_size(errorCode);
+        totalByteWidth += byteWidth;
+        entries.emplace_back(dirEntry.path(), dirEntry.last_write_time(errorCode), byteWidth);
+    }
+
+    if (totalByteWidth <= m_maxByteWidth)
+    {
+        return;
+    }
+
+    // 오래된 순으로 제거
+    std::ranges::sort(entries, {}, &Entry::lastUsedTime);
+    for (const Entry& entry: entries)
+    {
+        if (totalByteWidth <= m_maxByteWidth)
+        {
+            break;
+        }
+
+        if (fs::remove(entry.path, errorCode))
+        {
+            totalByteWidth -= entry.byteWidth;
+            ++m_stats.evictionCount;
+        }
+    }
+}
+
+void ModelImportCache::Clear()
+{
+    std::error_code errorCode;
+    for (const fs::directory_entry& dirEntry: fs::directory_iterator(m_directory, errorCode))
+    {
+        if (dirEntry.path().extension() == k_jamModelExtension)
+        {
+            fs::remove(dirEntry.path(), errorCode);
+        }
+    }
+}
+
+}   // namespace jam
\ No newline at end of file
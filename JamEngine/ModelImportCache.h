@@ -0,0 +1,50 @@
+#pragma once
+#include "Config.h"
+#include "Model.h"
+
+namespace jam
+{
+
+struct ModelImportCacheStats
+{
+    UInt64 hitCount      = 0;
+    UInt64 missCount     = 0;
+    UInt64 storeCount    = 0;
+    UInt64 evictionCount = 0;
+};
+
+// 임포트된 소스 모델의 파생 데이터 캐시
+// 키는 소스 파일 내용 + 임포트 플래그 + 엔진/포맷 버전의 해시이며, 값은 쿠킹된 .jmodel 파일
+// 캐시 히트 시 assimp 를 거치지 않고 ModelLoader 로 바로 로드할 수 있음
+class ModelImportCache
+{
+public:
+    static constexpr UInt64 k_defaultMaxByteWidth = 1024ull * 1024ull * 1024ull;   // 1GB
+
+    explicit ModelImportCache(const fs::path& _directory = fs::path(k_jamContentsDirectory) / k_jamDerivedDirectory, UInt64 _maxByteWidth = k_defaultMaxByteWidth);
+
+    NODISCARD Result<UInt64> ComputeKey(const fs::path& _sourcePath, UInt32 _importFlags, UInt64 _importSettings = 0, UInt32 _cookVersion = 0) const;   // _cookVersion: 임포터의 쿠킹 파이프라인 버전
+    NODISCARD fs::path       GetEntryPath(UInt64 _key) const;
+
+    // 히트라면 엔트리 경로를 반환하고 LRU 순서를 갱신함
+    NODISCARD Result<fs::path> Find(UInt64 _key);
+    bool                       Store(UInt64 _key, std::span<const ModelNodeData> _nodes);
+
+    // 최대 크기를 넘는다면 가장 오래 사용하지 않은 엔트리부터 제거
+    void Trim();
+    void Clear();
+
+    void                            SetDirectory(const fs::path& _directory) { m_directory = _directory; }
+    void                            SetMaxByteWidth(const UInt64 _maxByteWidth) { m_maxByteWidth = _maxByteWidth; }
+    NODISCARD const fs::path&       GetDirectory() const { return m_directory; }
+    NODISCARD UInt64                GetMaxByteWidth() const { return m_maxByteWidth; }
+    NODISCARD ModelImportCacheStats GetStats() const { return m_stats; }
+    void                            ResetStats() { m_stats = ModelImportCacheStats(); }
+
+private:
+    fs::path              m_directory;
+    UInt64                m_maxByteWidth = k_defaultMaxByteWidth;
+    ModelImportCacheStats m_stats;
+};
+
+}   // namespace jam
\ No newline at end of file
@@ -2,19 +2,87 @@
 
 #include "ModelImporter.h"
 
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+#include "Meshlet.h"
+#include "ModelImportCache.h"
+#include "TangentGenerator.h"
+#include "ThreadPool.h"
+
 #include <assimp/Importer.hpp>
 #include <assimp/mesh.h>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
+#include <bit>
+
+namespace
+{
+
+// 쿠킹 파이프라인 버전 (임포트 캐시 키에 포함). 결과물이 바뀌는 변경마다 올려야 함
+// 1: 기본 쿠킹, 2: 메쉬 최적화, 3: 메쉬렛, 4: LOD 체인, 5: 압축 / 양자화 정점, 6: 16비트 인덱스,
+// 7: 노드 경계, 8: 탄젠트 생성, 9: 기하 코덱
+constexpr jam::UInt32 k_cookVersion = 9;
+
+constexpr jam::UInt32 k_importFlags = aiProcess_Triangulate | aiProcess_JoinIdenticalVertices | aiProcess_GenSmoothNormals | aiProcess_RemoveRedundantMaterials | aiProcess_FindDegenerates | aiProcess_FindInvalidData | aiProcess_OptimizeMeshes | aiProcess_OptimizeGraph | aiProcess_MakeLeftHanded | aiProcess_ImproveCacheLocality;
+
+}   // namespace
 
 namespace jam
 {
 
-bool ModelImporter::Import(const fs::path& _path)
+bool ModelImporter::Import(const fs::path& _path, ModelImportCache* _pCache)
+{
+    if (_pCache == nullptr)
+    {
+        return ImportFromSource_(_path);
+    }
+
+    // 정점 포맷 설정도 결과물에 영향을 줌
+    const UInt64 importSettings = static_cast<UInt64>(EnumToInt(m_vertexType)) | static_cast<UInt64>(std::bit_cast<UInt32>(m_maxRelativePositionError)) << 32;
+    auto [key, bKeyResult]      = _pCache->ComputeKey(_path, k_importFlags, importSettings, k_cookVersion);
+    if (!bKeyResult)
+    {
+        return false;
+    }
+
+    // 캐시 히트
+    if (auto [entryPath, bFound] = _pCache->Find(key); bFound)
+    {
+        if (ImportFromCache_(entryPath))
+        {
+            return true;
+        }
+        JAM_ERROR("ModelImporter::Import() - Corrupted cache entry, reimporting: {}", entryPath.string());
+    }
+
+    // 캐시 미스 - 임포트 후 쿠킹
+    if (!ImportFromSource_(_path))
+    {
+        return false;
+    }
+    _pCache->Store(key, m_modelNodesData);
+    return true;
+}
+
+bool ModelImporter::ImportFromCache_(const fs::path& _entryPath)
+{
+    Clear_();
+    if (!m_cacheLoader.Load(_entryPath))
+    {
+        return false;
+    }
+
+    const std::span<const ModelNodeData> nodes = m_cacheLoader.GetLoadData();
+    m_modelNodesData.assign(nodes.begin(), nodes.end());
+    m_bImported = true;
+    return true;
+}
+
+bool ModelImporter::ImportFromSource_(const fs::path& _path)
 {
     Assimp::Importer importer;
 
-    const aiScene* scene = importer.ReadFile(_path.string(), aiProcess_Triangulate | aiProcess_CalcTangentSpace | aiProcess_JoinIdenticalVertices | aiProcess_GenSmoothNormals | aiProcess_RemoveRedundantMaterials | aiProcess_FindDegenerates | aiProcess_FindInvalidData | aiProcess_OptimizeMeshes | aiProcess_OptimizeGraph | aiProcess_MakeLeftHanded | aiProcess_ImproveCacheLocality);
+    const aiScene* scene = importer.ReadFile(_path.string(), k_importFlags);
     if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode)
     {
         JAM_ERROR("Assimp error: {}", importer.GetErrorString());
@@ -22,12 +90,69 @@ bool ModelImporter::Import(const fs::path& _path)
     }
 
     // 모델 지오메트리 초기화
+    Clear_();
+
+    // 노드 그래프 순서대로 메쉬 수집
+    std::vector<const aiMesh*> meshes;
+    meshes.reserve(scene->mNumMeshes);
+    ProcessNode_(scene->mRootNode, meshes, scene);
+
+    // 메쉬끼리는 독립적이므로 병렬로 처리 (결과는 수집한 순서대로 기록되어 직렬 처리와 동일함)
+    m_modelNodesData.resize(meshes.size());
+    m_quantizationErrors.resize(meshes.size());
+    std::vector<MeshOptimizeReport> reports(meshes.size());
+    ThreadPool::GetGlobal().ParallelFor(static_cast<UInt32>(meshes.size()), [&](const UInt32 _index) {
+        ProcessMesh_(meshes[_index], scene, m_modelNodesData[_index]);
+        ModelNodeData& node = m_modelNodesData[_index];
+        const aiMesh*  mesh = meshes[_index];
+        if (!mesh->HasTangentsAndBitangents() && mesh->HasNormals() && mesh->HasTextureCoords(0))
+        {
+            GenerateTangents(node.meshData);   // 소스에 탄젠트가 없을 때만. 미러링된 UV 경계의 정점이 복제되므로 최적화 전에 생성
+        }
+        reports[_index]       = OptimizeMesh(node.meshData);                                                                     // 쿠킹 시 GPU 친화적인 순서로 재배치
+        node.meshlets         = BuildMeshlets(node.meshData.indices, node.meshData.vertices);                                    // 메쉬렛 단위 컬링용
+        reports[_index].after = AnalyzeVertexCache(node.meshData.indices, static_cast<UInt32>(node.meshData.vertices.size()));   // 메쉬렛 빌드가 재배치한 최종 LOD0 순서 기준
+        node.lods             = GenerateLodChain(node.meshData);                                                                 // LOD1 이상은 인덱스 버퍼 뒤에 추가됨
+        node.bounds           = ComputeBounds(node.meshData.vertices);                                                           // 양자화 전의 위치 기준
+        ApplyVertexType_(node, m_quantizationErrors[_index]);
+    });
+
+    // 최적화 결과 (삼각형 수 가중 평균, after 는 메쉬렛 빌드 이후)
     {
-        Clear_();
-        m_modelNodesData.reserve(scene->mNumMeshes);
+        VertexCacheStats before;
+        VertexCacheStats after;
+        float            totalTriangleCount = 0.f;
+        for (size_t i = 0; i < reports.size(); ++i)
+        {
+            const float triangleCount = static_cast<float>(m_modelNodesData[i].lods.front().indexCount / 3);   // LOD0
+            before.acmr += reports[i].before.acmr * triangleCount;
+            before.atvr += reports[i].before.atvr * triangleCount;
+            after.acmr += reports[i].after.acmr * triangleCount;
+            after.atvr += reports[i].after.atvr * triangleCount;
+            totalTriangleCount += triangleCount;
+        }
+
+        if (totalTriangleCount > 0.f)
+        {
+            Log::Trace("ModelImporter::Import() - {} optimized. ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}", _path.filename().string(), before.acmr / totalTriangleCount, after.acmr / totalTriangleCount, before.atvr / totalTriangleCount, after.atvr / totalTriangleCount);
+        }
     }
 
-    ProcessNode_(scene->mRootNode, scene);
+    // 정점 포맷 리포트 (메쉬별 양자화 오차)
+    if (m_vertexType != eVertexType::Vertex3)
+    {
+        size_t fullByteWidth   = 0;
+        size_t packedByteWidth = 0;
+        for (size_t i = 0; i < m_modelNodesData.size(); ++i)
+        {
+            const ModelNodeData&           node  = m_modelNodesData[i];
+            const VertexQuantizationError& error = m_quantizationErrors[i];
+            fullByteWidth += node.meshData.vertices.size() * sizeof(Vertex3);
+            packedByteWidth += node.meshData.vertices.size() * GetVertexStride(node.vertexType);
+            Log::Trace("ModelImporter::Import() - {} [{}] {} bytes/vertex. error: position {:.6f}, normal {:.3f} deg, tangent {:.3f} deg, uv {:.6f}", _path.filename().string(), node.name, GetVertexStride(node.vertexType), error.position, ToDeg(error.normal), ToDeg(error.tangent), error.uv);
+        }
+        Log::Trace("ModelImporter::Import() - {} vertex memory {} -> {} bytes", _path.filename().string(), fullByteWidth, packedByteWidth);
+    }
     m_bImported = true;
     return true;
 }
@@ -42,32 +167,41 @@ const std::vector<ModelNodeData>& ModelImporter::GetRawModelNodes() const
     return m_modelNodesData;
 }
 
+void ModelImporter::SetVertexType(const eVertexType _vertexType)
+{
+    JAM_ASSERT(_vertexType == eVertexType::Vertex3 || _vertexType == eVertexType::Vertex3Compact || _vertexType == eVertexType::Vertex3Quantized, "Imported meshes need a vertex type with normal and tangent");
+    m_vertexType = _vertexType;
+}
+
 void ModelImporter::Clear_()
 {
     m_modelNodesData.clear();
+    m_quantizationErrors.clear();
+    m_cacheLoader = ModelLoader();
     m_bImported = false;
 }
 
-void ModelImporter::ProcessNode_(const aiNode* node, const aiScene* scene)
+void ModelImporter::ProcessNode_(const aiNode* node, std::vector<const aiMesh*>& _out_meshes, const aiScene* scene) const
 {
     for (unsigned int i = 0; i < node->mNumMeshes; i++)
     {
-        const aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
-        ProcessMesh_(mesh, scene);
+        _out_meshes.emplace_back(scene->mMeshes[node->mMeshes[i]]);
     }
 
     for (unsigned int i = 0; i < node->mNumChildren; i++)
     {
-        ProcessNode_(node->mChildren[i], scene);
+        ProcessNode_(node->mChildren[i], _out_meshes, scene);
     }
 }
 
-void ModelImporter::ProcessMesh_(const aiMesh* mesh, const aiScene* scene)
+void ModelImporter::ProcessMesh_(const aiMesh* mesh, const aiScene* scene, ModelNodeData& _out_node) const
 {
-    ModelNodeData node;
+    ModelNodeData& node = _out_node;
 
     // 이름
-    node.name = mesh->mName.C_Str();
+    node.name       = mesh->mName.C_Str();
+    node.vertexType = eVertexType::Vertex3;      // 모든 속성을 담을 수 있는 레이아웃
+    node.topology   = eTopology::TriangleList;   // aiProcess_Triangulate
 
     // 메시
     {
@@ -179,8 +313,31 @@ void ModelImporter::ProcessMesh_(const aiMesh* mesh, const aiScene* scene)
             material.shininess = shiniess;
         }
     }
+}
+
+void ModelImporter::ApplyVertexType_(ModelNodeData& _node, VertexQuantizationError& _out_error) const
+{
+    _node.vertexType = m_vertexType;
+    if (m_vertexType == eVertexType::Vertex3)
+    {
+        return;
+    }
+
+    // 노드 AABB 기준으로 위치를 양자화
+    const std::vector<VertexAttribute>& vertices = _node.meshData.vertices;
+    const Vec3                          minPos   = _node.bounds.IsValid() ? _node.bounds.min : Vec3::Zero;
+    const Vec3                          maxPos   = _node.bounds.IsValid() ? _node.bounds.max : Vec3::Zero;
 
-    m_modelNodesData.emplace_back(node);
+    _node.quantization = VertexQuantization::FromBounds(minPos, maxPos);
+    _out_error         = MeasureQuantizationError(vertices, _node.vertexType, _node.quantization);
+
+    // 허용치를 넘는 메쉬는 위치를 float 으로 유지
+    if (IsQuantizedVertexType(_node.vertexType) && _out_error.position > m_maxRelativePositionError * Vec3::Distance(minPos, maxPos))
+    {
+        _node.vertexType   = eVertexType::Vertex3Compact;
+        _node.quantization = VertexQuantization();
+        _out_error         = MeasureQuantizationError(vertices, _node.vertexType);
+    }
 }
 
 }   // namespace jam
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include "Model.h"
+#include "ModelLoader.h"
 
 struct aiNode;
 struct aiScene;
@@ -7,21 +8,40 @@ struct aiMesh;
 
 namespace jam
 {
+class ModelImportCache;
 
 // assimp 가 지원하는 모델 포맷 임포터
+// 캐시가 주어지면 변경되지 않은 소스는 assimp 를 거치지 않고 쿠킹된 .jmodel 에서 로드함
 class ModelImporter
 {
 public:
-    bool            Import(const fs::path& _path);
+    bool            Import(const fs::path& _path, ModelImportCache* _pCache = nullptr);
     NODISCARD const std::vector<ModelNodeData>& GetRawModelNodes() const;
 
+    // 정점 포맷 (Vertex3, Vertex3Compact, Vertex3Quantized 중 하나, 기본 Vertex3)
+    // Vertex3Quantized 에서 위치 오차가 허용치(노드 AABB 대각선 대비)를 넘는 메쉬는 Vertex3Compact 로 대체됨
+    // 압축 정점 메쉬는 ShaderCollection 의 정점 타입별 셰이더와 Mesh::CreateTransform 으로 그려야 함
+    void                  SetVertexType(eVertexType _vertexType);
+    void                  SetMaxRelativePositionError(const float _error) { m_maxRelativePositionError = _error; }
+    NODISCARD eVertexType GetVertexType() const { return m_vertexType; }
+
+    // 메쉬별 양자화 오차 (노드 순서, 소스에서 임포트한 경우에만 존재)
+    NODISCARD std::span<const VertexQuantizationError> GetQuantizationErrors() const { return m_quantizationErrors; }
+
 private:
+    bool ImportFromSource_(const fs::path& _path);
+    bool ImportFromCache_(const fs::path& _entryPath);
     void Clear_();
-    void ProcessNode_(const aiNode* node, const aiScene* scene);
-    void ProcessMesh_(const aiMesh* mesh, const aiScene* scene);
+    void ProcessNode_(const aiNode* node, std::vector<const aiMesh*>& _out_meshes, const aiScene* scene) const;
+    void ProcessMesh_(const aiMesh* mesh, const aiScene* scene, ModelNodeData& _out_node) const;
+    void ApplyVertexType_(ModelNodeData& _node, VertexQuantizationError& _out_error) const;
 
-    std::vector<ModelNodeData> m_modelNodesData;   // 노드 데이터
-    bool                       m_bImported = false;
+    std::vector<ModelNodeData>           m_modelNodesData;   // 노드 데이터
+    ModelLoader                          m_cacheLoader;      // 캐시 히트 시 노드 데이터가 가리키는 메모리
+    std::vector<VertexQuantizationError> m_quantizationErrors;
+    eVertexType                          m_vertexType               = eVertexType::Vertex3;
+    float                                m_maxRelativePositionError = 1e-4f;
+    bool                                 m_bImported                = false;
 };
 
 }   // namespace jam
\ No newline at end of file
@@ -5,12 +5,24 @@
 #include "Asset.h"
 #include "AssetManager.h"
 #include "AssetUtilities.h"
+#include "ModelFormat.h"
+#include "TextureAsset.h"
+#include "ThreadPool.h"
 #include "vendor/flatbuffers/compiled/model_generated.h"
-#include <fstream>
 
 namespace
 {
 
+// 압축 청크를 해제 버퍼의 어느 위치에 풀어야 하는지
+struct ChunkDecodeJob
+{
+    std::span<const jam::UInt8> chunk;
+    size_t                      offset;   // 해제 버퍼 내의 오프셋
+    size_t                      byteWidth;
+    size_t                      nodeIndex;
+    bool                        bIndexStream;
+};
+
 NODISCARD jam::Vec3 ToJamVec3(const jam::fbs::Vec3& vec)
 {
     return { vec.x(), vec.y(), vec.z() };
@@ -21,6 +33,21 @@ NODISCARD jam::Vec2 ToJamVec2(const jam::fbs::Vec2& vec)
     return { vec.x(), vec.y() };
 }
 
+NODISCARD jam::Bounds ToJamBounds(const jam::fbs::Bounds& bounds)
+{
+    jam::Bounds result;
+    result.min    = ToJamVec3(bounds.min());
+    result.max    = ToJamVec3(bounds.max());
+    result.center = ToJamVec3(bounds.center());
+    result.radius = bounds.radius();
+    return result;
+}
+
+NODISCARD jam::eIndexFormat ToJamIndexFormat(const jam::fbs::eIndexFormat indexFormat)
+{
+    return indexFormat == jam::fbs::eIndexFormat_UInt16 ? jam::eIndexFormat::UInt16 : jam::eIndexFormat::UInt32;
+}
+
 NODISCARD jam::eVertexType ToJamVertexType(const jam::fbs::eVertexType vertexType)
 {
     switch (vertexType)
@@ -28,12 +55,40 @@ NODISCARD jam::eVertexType ToJamVertexType(const jam::fbs::eVertexType vertexTyp
         case jam::fbs::eVertexType_Vertex2: return jam::eVertexType::Vertex2;
         case jam::fbs::eVertexType_Vertex3: return jam::eVertexType::Vertex3;
         case jam::fbs::eVertexType_Vertex3PosOnly: return jam::eVertexType::Vertex3PosOnly;
+        case jam::fbs::eVertexType_Vertex3Compact: return jam::eVertexType::Vertex3Compact;
+        case jam::fbs::eVertexType_Vertex3Quantized: return jam::eVertexType::Vertex3Quantized;
         default:
             JAM_ERROR("Unknown vertex type");
             return jam::eVertexType::Vertex3;   // Default fallback
     }
 }
 
+// 파일에 기록된 정점 스트림 레이아웃이 엔진의 레이아웃과 같은지 (레이아웃이 없는 파일은 엔진 레이아웃으로 간주)
+NODISCARD bool MatchesVertexLayout(const flatbuffers::Vector<const jam::fbs::VertexElement*>* _pFbsLayout, const jam::eVertexType _vertexType)
+{
+    if (_pFbsLayout == nullptr)
+    {
+        return true;
+    }
+
+    const std::span<const jam::VertexElementDesc> elements = jam::GetVertexElements(_vertexType);
+    if (_pFbsLayout->size() != elements.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < elements.size(); ++i)
+    {
+        const jam::fbs::VertexElement* pFbsElement = _pFbsLayout->Get(static_cast<flatbuffers::uoffset_t>(i));
+        const jam::VertexElementDesc   element { static_cast<jam::eVertexAttribute>(pFbsElement->attribute()), static_cast<jam::eVertexFormat>(pFbsElement->format()), pFbsElement->offset() };
+        if (element != elements[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 NODISCARD jam::eTopology ToJamTopology(const jam::fbs::eTopology topology)
 {
     switch (topology)
@@ -50,12 +105,172 @@ NODISCARD jam::eTopology ToJamTopology(const jam::fbs::eTopology topology)
     }
 }
 
+// 텍스처는 경로만 기록하고 ModelLoader::ResolveTextures() 에서 로드
+void AddTextureReference(const flatbuffers::String* _pPath, const size_t _nodeIndex, std::optional<jam::Ref<jam::TextureAsset>> jam::Material::* _pSlot, std::vector<jam::ModelLoader::TextureReference>& _out_references)
+{
+    if (_pPath)
+    {
+        _out_references.emplace_back(_nodeIndex, _pSlot, _pPath->str());
+    }
+}
+
+void AppendTexturePaths(const jam::fbs::Material* _pMaterial, std::vector<std::string>& _out_paths)
+{
+    const flatbuffers::String* texturePaths[] = { _pMaterial->albedo_texture(), _pMaterial->normal_texture(), _pMaterial->metallic_texture(), _pMaterial->roughness_texture(), _pMaterial->ao_texture(), _pMaterial->emissive_texture(), _pMaterial->lightmap_texture() };
+    for (const flatbuffers::String* pPath: texturePaths)
+    {
+        if (pPath)
+        {
+            _out_paths.push_back(pPath->str());
+        }
+    }
+}
+
+NODISCARD jam::Material ToJamMaterial(const jam::fbs::Material* _pMaterial, const size_t _nodeIndex, std::vector<jam::ModelLoader::TextureReference>& _out_references)
+{
+    jam::Material material;
+    material.ambientColor  = ToJamVec3(*_pMaterial->ambient_color());
+    material.diffuseColor  = ToJamVec3(*_pMaterial->diffuse_color());
+    material.specularColor = ToJamVec3(*_pMaterial->specular_color());
+    material.shininess     = _pMaterial->shininess();
+    material.albedoColor   = ToJamVec3(*_pMaterial->albedo_color());
+    material.metallic      = _pMaterial->metallic();
+    material.roughness     = _pMaterial->roughness();
+    material.ao            = _pMaterial->ao();
+    material.emissive      = _pMaterial->emissive();
+    material.emissiveColor = ToJamVec3(*_pMaterial->emissive_color());
+    material.emissiveScale = _pMaterial->emissive_scale();
+
+    // textures
+    AddTextureReference(_pMaterial->albedo_texture(), _nodeIndex, &jam::Material::albedoTexture, _out_references);
+    AddTextureReference(_pMaterial->normal_texture(), _nodeIndex, &jam::Material::normalTexture, _out_references);
+    AddTextureReference(_pMaterial->metallic_texture(), _nodeIndex, &jam::Material::metallicTexture, _out_references);
+    AddTextureReference(_pMaterial->roughness_texture(), _nodeIndex, &jam::Material::roughnessTexture, _out_references);
+    AddTextureReference(_pMaterial->ao_texture(), _nodeIndex, &jam::Material::aoTexture, _out_references);
+    AddTextureReference(_pMaterial->emissive_texture(), _nodeIndex, &jam::Material::emissiveTexture, _out_references);
+    AddTextureReference(_pMaterial->lightmap_texture(), _nodeIndex, &jam::Material::lightmapTexture, _out_references);
+    return material;
+}
+
 }   // namespace
 
 namespace jam
 {
 
-bool ModelLoader::Load(AssetManager& _assetMgrRef, const fs::path& _path)
+bool ModelLoader::Load(AssetManager& _assetMgrRef, const fs::path& _path, const bool _bTrustedFile)
+{
+    if (!Load_(_path, _bTrustedFile))
+    {
+        return false;
+    }
+
+    ResolveTextures(_assetMgrRef, false);
+    return true;
+}
+
+bool ModelLoader::Load(const fs::path& _path, const bool _bTrustedFile)
+{
+    return Load_(_path, _bTrustedFile);
+}
+
+bool ModelLoader::Load(const AssetFile& _file, const bool _bTrustedFile)
+{
+    // 초기화
+    Clear_();
+    m_file = _file;
+
+    // 헤더가 없다면 v1 파일 (호환 경로)
+    const std::span<const UInt8> file    = m_file.GetData();
+    const bool                   bResult = HasModelFileHeader(file) ? LoadV2_(file, _bTrustedFile) : LoadV1_(file);
+    if (!bResult)
+    {
+        Clear_();
+        return false;
+    }
+    return true;
+}
+
+void ModelLoader::ResolveTextures(AssetManager& _assetMgrRef, const bool _bAsync)
+{
+    // 노드들은 대부분 같은 텍스처를 공유하므로 경로마다 한 번만 요청하며, 모두 먼저 요청해 워커 스레드에서 병렬로 디코딩
+    std::unordered_map<std::string_view, AssetHandle<TextureAsset>> handles;
+    for (const TextureReference& reference: m_textureReferences)
+    {
+        auto [iterator, bInserted] = handles.try_emplace(reference.path);
+        if (bInserted)
+        {
+            iterator->second = _assetMgrRef.LoadAsync<TextureAsset>(reference.path);
+        }
+    }
+
+    // 동기 로드라면 진행 중인 요청을 기다려서 마무리
+    if (!_bAsync)
+    {
+        for (const auto& [path, handle]: handles)
+        {
+            if (!handle.IsDone())
+            {
+                _assetMgrRef.Load(eAssetType::Texture, fs::path(path));
+            }
+        }
+    }
+
+    // 실패한 텍스처는 비워둠 (아직 진행 중인 텍스처는 에셋을 먼저 채우며 GPU 리소스는 로드가 끝난 뒤에 유효함)
+    for (const TextureReference& reference: m_textureReferences)
+    {
+        const AssetHandle<TextureAsset>& handle = handles[reference.path];
+        Ref<TextureAsset>                pTexture;
+        if (!handle.IsFailed())
+        {
+            pTexture = handle.GetAsset();
+        }
+        m_modelNodes[reference.nodeIndex].material.*reference.pSlot = pTexture;
+    }
+    m_textureReferences.clear();
+}
+
+bool ModelLoader::ReadTexturePaths(const std::span<const UInt8> _file, std::vector<std::string>& _out_paths)
+{
+    // v2 는 헤더 뒤의 페이로드, v1 은 파일 전체가 FlatBuffers 버퍼
+    std::span<const UInt8> payload = _file;
+    if (HasModelFileHeader(payload))
+    {
+        auto [header, bResult] = ReadModelFileHeader(payload);
+        if (!bResult)
+        {
+            return false;
+        }
+        payload = payload.subspan(header.payloadOffset, static_cast<size_t>(header.payloadByteWidth));
+    }
+
+    // 스트림은 바이트 벡터이므로 검증 비용은 노드 수에 비례
+    flatbuffers::Verifier verifier(payload.data(), payload.size());
+    if (!fbs::VerifyModelDataBuffer(verifier))
+    {
+        return false;
+    }
+
+    const fbs::ModelData* fbsModelData = fbs::GetModelData(payload.data());
+    if (!fbsModelData || !fbsModelData->nodes())
+    {
+        return false;
+    }
+
+    for (const fbs::ModelNodeData* fbsNodeData: *fbsModelData->nodes())
+    {
+        if (fbsNodeData->material())
+        {
+            AppendTexturePaths(fbsNodeData->material(), _out_paths);
+        }
+    }
+
+    std::ranges::sort(_out_paths);
+    const auto duplicates = std::ranges::unique(_out_paths);
+    _out_paths.erase(duplicates.begin(), duplicates.end());
+    return true;
+}
+
+bool ModelLoader::Load_(const fs::path& _path, const bool _bTrustedFile)
 {
     // 유효성 검사
     if (!IsCompatibleFromPath(eAssetType::Model, _path))
@@ -64,49 +279,45 @@ bool ModelLoader::Load(AssetManager& _assetMgrRef, const fs::path& _path)
         return false;
     }
 
-    // 파일 읽기
-    std::ifstream fs(_path, std::ios::binary);
-    if (!fs.is_open())
+    // 파일 매핑
+    auto [file, bOpened] = AssetFile::OpenLoose(_path);
+    if (!bOpened)
     {
         JAM_ERROR("Failed to open model file: {}", _path.string());
         return false;
     }
 
-    // 초기화
-    Clear_();
-
-    // 파일 크기 확인 및 읽기
-    fs.seekg(0, std::ios::end);
-    const std::streamsize size = fs.tellg();
-    fs.seekg(0, std::ios::beg);
-    std::vector<char> buffer(size);
-    if (!fs.read(buffer.data(), size))
+    if (!Load(file, _bTrustedFile))
     {
-        JAM_ERROR("Failed to read model file: {}", _path.string());
+        JAM_ERROR("Failed to load model file: {}", _path.string());
         return false;
     }
+    return true;
+}
 
+bool ModelLoader::LoadV1_(const std::span<const UInt8> _file)
+{
     // FlatBuffers 버퍼 검증
-    const uint8_t*        pBuffer = reinterpret_cast<const uint8_t*>(buffer.data());
-    flatbuffers::Verifier verifier(pBuffer, static_cast<size_t>(size));
+    flatbuffers::Verifier verifier(_file.data(), _file.size());
     if (!fbs::VerifyModelDataBuffer(verifier))
     {
-        JAM_ERROR("Model file verification failed: {}", _path.string());
+        JAM_ERROR("ModelLoader::LoadV1_() - Model file verification failed");
         return false;
     }
 
-    const fbs::ModelData* fbsModelData = fbs::GetModelData(buffer.data());
-    if (!fbsModelData)
+    const fbs::ModelData* fbsModelData = fbs::GetModelData(_file.data());
+    if (!fbsModelData || !fbsModelData->nodes())
     {
-        JAM_ERROR("Failed to parse model file: {}", _path.string());
+        JAM_ERROR("ModelLoader::LoadV1_() - Failed to parse model file");
         return false;
     }
 
-    m_modelNodes.reserve(fbsModelData->nodes()->size());
-    for (const fbs::ModelNodeData* fbsNodeData: *fbsModelData->nodes())
-    {
-        // jam model data
-        ModelNodeData modelNodeData;
+    // 노드끼리는 독립적이므로 기하 데이터는 병렬로 디코딩 (결과는 파일 순서대로 기록)
+    const flatbuffers::Vector<flatbuffers::Offset<fbs::ModelNodeData>>* fbsNodes = fbsModelData->nodes();
+    m_modelNodes.resize(fbsNodes->size());
+    ThreadPool::GetGlobal().ParallelFor(fbsNodes->size(), [&](const UInt32 _index) {
+        const fbs::ModelNodeData* fbsNodeData   = fbsNodes->Get(_index);
+        ModelNodeData&            modelNodeData = m_modelNodes[_index];
 
         // name
         {
@@ -139,60 +350,240 @@ bool ModelLoader::Load(AssetManager& _assetMgrRef, const fs::path& _path)
             modelNodeData.vertexType = ToJamVertexType(fbsNodeData->vertex_type());
         }
 
-        // Material
+        // bounds - v1 파일에는 경계가 없으므로 노드를 디코딩한 스레드에서 바로 계산
+        modelNodeData.bounds = ComputeNodeBounds(modelNodeData);
+    });
+
+    // Material - 텍스처 참조가 파일 순서대로 기록되도록 순서대로 처리
+    for (UInt32 i = 0; i < fbsNodes->size(); ++i)
+    {
+        m_modelNodes[i].material = ToJamMaterial(fbsNodes->Get(i)->material(), i, m_textureReferences);
+    }
+
+    // v1 은 모든 데이터를 복사했으므로 파일을 유지할 필요가 없음
+    m_file = AssetFile();
+    return true;
+}
+
+bool ModelLoader::LoadV2_(const std::span<const UInt8> _file, const bool _bTrustedFile)
+{
+    // 헤더 검증 (체크섬, 파일 크기)
+    auto [header, bResult] = ReadModelFileHeader(_file);
+    if (!bResult)
+    {
+        JAM_ERROR("ModelLoader::LoadV2_() - Invalid model file header");
+        return false;
+    }
+
+    const std::span<const UInt8> payload = _file.subspan(header.payloadOffset, static_cast<size_t>(header.payloadByteWidth));
+
+    // 신뢰할 수 없는 파일만 전체 검증
+    if (!_bTrustedFile)
+    {
+        flatbuffers::Verifier verifier(payload.data(), payload.size());
+        if (!fbs::VerifyModelDataBuffer(verifier))
+        {
+            JAM_ERROR("ModelLoader::LoadV2_() - Model file verification failed");
+            return false;
+        }
+    }
+
+    const fbs::ModelData* fbsModelData = fbs::GetModelData(payload.data());
+    if (!fbsModelData || !fbsModelData->nodes())
+    {
+        JAM_ERROR("ModelLoader::LoadV2_() - Failed to parse model file");
+        return false;
+    }
+
+    const bool                  bChunked = (header.flags & eModelFileFlags_Chunked) != 0;
+    std::vector<ChunkDecodeJob> decodeJobs;
+    size_t                      decodedByteWidth = 0;
+
+    // 청크 헤더를 읽고 해제 버퍼에서의 위치를 예약
+    auto reserveChunk = [&](const flatbuffers::Vector<UInt8>* _pChunk, const size_t _nodeIndex, const bool _bIndexStream) -> Result<size_t> {
+        const std::span<const UInt8> chunk = std::span(_pChunk->data(), _pChunk->size());
+        auto [chunkHeader, bChunkResult]   = ReadModelChunkHeader(chunk);
+        if (!bChunkResult)
+        {
+            return Fail;
+        }
+
+        const size_t offset = decodedByteWidth;
+        decodedByteWidth    = AlignModelStream(offset + chunkHeader.rawByteWidth);
+        decodeJobs.emplace_back(chunk, offset, chunkHeader.rawByteWidth, _nodeIndex, _bIndexStream);
+        return static_cast<size_t>(chunkHeader.rawByteWidth);
+    };
+
+    m_modelNodes.reserve(fbsModelData->nodes()->size());
+    for (const fbs::ModelNodeData* fbsNodeData: *fbsModelData->nodes())
+    {
+        ModelNodeData modelNodeData;
+        modelNodeData.name       = fbsNodeData->name() ? fbsNodeData->name()->str() : std::string();
+        modelNodeData.topology   = ToJamTopology(fbsNodeData->topology());
+        modelNodeData.vertexType = ToJamVertexType(fbsNodeData->vertex_type());
+
+        // Mesh - 매핑된 메모리를 그대로 참조 (정점 단위 작업 없음)
+        const fbs::MeshData* fbsMeshData = fbsNodeData->mesh_data();
+        const eIndexFormat   indexFormat = fbsMeshData ? ToJamIndexFormat(fbsMeshData->index_format()) : eIndexFormat::UInt32;
+        const UInt32         indexStride = GetIndexStride(indexFormat);
+        size_t               indexCount  = 0;
+
+        if (fbsMeshData && MatchesVertexLayout(fbsMeshData->vertex_layout(), modelNodeData.vertexType) == false)
         {
-            const fbs::Material* material        = fbsNodeData->material();
-            modelNodeData.material.ambientColor  = ToJamVec3(*material->ambient_color());
-            modelNodeData.material.diffuseColor  = ToJamVec3(*material->diffuse_color());
-            modelNodeData.material.specularColor = ToJamVec3(*material->specular_color());
-            modelNodeData.material.shininess     = material->shininess();
-            modelNodeData.material.albedoColor   = ToJamVec3(*material->albedo_color());
-            modelNodeData.material.metallic      = material->metallic();
-            modelNodeData.material.roughness     = material->roughness();
-            modelNodeData.material.ao            = material->ao();
-            modelNodeData.material.emissive      = material->emissive();
-            modelNodeData.material.emissiveColor = ToJamVec3(*material->emissive_color());
-            modelNodeData.material.emissiveScale = material->emissive_scale();
-
-            // textures load
-            if (material->albedo_texture())
+            JAM_ERROR("ModelLoader::LoadV2_() - Vertex layout mismatch in node: {}", modelNodeData.name);
+            return false;
+        }
+
+        modelNodeData.packedMeshData.indexFormat = indexFormat;
+        if (bChunked)
+        {
+            // 압축된 스트림 - 해제는 모든 노드를 읽은 뒤 병렬로 처리
+            if (fbsMeshData && fbsMeshData->vertex_chunk() && fbsMeshData->index_chunk())
             {
-                auto [asset, _]                      = _assetMgrRef.GetOrLoad<TextureAsset>(material->albedo_texture()->str());
-                modelNodeData.material.albedoTexture = asset;
+                auto [vertexByteWidth, bVertexResult] = reserveChunk(fbsMeshData->vertex_chunk(), m_modelNodes.size(), false);
+                auto [indexByteWidth, bIndexResult]   = reserveChunk(fbsMeshData->index_chunk(), m_modelNodes.size(), true);
+                if (!bVertexResult || !bIndexResult)
+                {
+                    JAM_ERROR("ModelLoader::LoadV2_() - Invalid stream chunk in node: {}", modelNodeData.name);
+                    return false;
+                }
+
+                if (vertexByteWidth % GetVertexStride(modelNodeData.vertexType) != 0 || indexByteWidth % indexStride != 0)
+                {
+                    JAM_ERROR("ModelLoader::LoadV2_() - Vertex stream size mismatch in node: {}", modelNodeData.name);
+                    return false;
+                }
+                indexCount = indexByteWidth / indexStride;
             }
-            if (material->normal_texture())
+        }
+        else if (fbsMeshData && fbsMeshData->vertex_stream())
+        {
+            // 인덱스는 포맷에 맞는 벡터에 저장되어 있음
+            const flatbuffers::Vector<UInt8>* fbsVertexStream = fbsMeshData->vertex_stream();
+            std::span<const UInt8>            indexStream;
+            if (indexFormat == eIndexFormat::UInt16 && fbsMeshData->indices16())
             {
-                auto [asset, _]                      = _assetMgrRef.GetOrLoad<TextureAsset>(material->normal_texture()->str());
-                modelNodeData.material.normalTexture = asset;
+                indexStream = std::span(reinterpret_cast<const UInt8*>(fbsMeshData->indices16()->data()), fbsMeshData->indices16()->size() * sizeof(UInt16));
             }
-            if (material->metallic_texture())
+            else if (indexFormat == eIndexFormat::UInt32 && fbsMeshData->indices())
             {
-                auto [asset, _]                        = _assetMgrRef.GetOrLoad<TextureAsset>(material->metallic_texture()->str());
-                modelNodeData.material.metallicTexture = asset;
+                indexStream = std::span(reinterpret_cast<const UInt8*>(fbsMeshData->indices()->data()), fbsMeshData->indices()->size() * sizeof(UInt32));
             }
-            if (material->roughness_texture())
+
+            if (fbsVertexStream->size() % GetVertexStride(modelNodeData.vertexType) != 0 || indexStream.empty())
             {
-                auto [asset, _]                         = _assetMgrRef.GetOrLoad<TextureAsset>(material->roughness_texture()->str());
-                modelNodeData.material.roughnessTexture = asset;
+                JAM_ERROR("ModelLoader::LoadV2_() - Vertex stream size mismatch in node: {}", modelNodeData.name);
+                return false;
             }
-            if (material->ao_texture())
+
+            modelNodeData.packedMeshData.vertices = std::span(fbsVertexStream->data(), fbsVertexStream->size());
+            modelNodeData.packedMeshData.indices  = indexStream;
+            indexCount                            = indexStream.size() / indexStride;
+        }
+
+        // 양자화 위치 복원 변환
+        if (IsQuantizedVertexType(modelNodeData.vertexType))
+        {
+            if (!fbsMeshData || !fbsMeshData->position_offset() || !fbsMeshData->position_scale())
             {
-                auto [asset, _]                  = _assetMgrRef.GetOrLoad<TextureAsset>(material->ao_texture()->str());
-                modelNodeData.material.aoTexture = asset;
+                JAM_ERROR("ModelLoader::LoadV2_() - Missing position quantization in node: {}", modelNodeData.name);
+                return false;
             }
-            if (material->emissive_texture())
+            modelNodeData.quantization.positionOffset = ToJamVec3(*fbsMeshData->position_offset());
+            modelNodeData.quantization.positionScale  = ToJamVec3(*fbsMeshData->position_scale());
+        }
+
+        // Meshlet
+        if (fbsMeshData && fbsMeshData->meshlets())
+        {
+            modelNodeData.meshlets.reserve(fbsMeshData->meshlets()->size());
+            for (const fbs::Meshlet* fbsMeshlet: *fbsMeshData->meshlets())
             {
-                auto [asset, _]                        = _assetMgrRef.GetOrLoad<TextureAsset>(material->emissive_texture()->str());
-                modelNodeData.material.emissiveTexture = asset;
+                Meshlet meshlet;
+                meshlet.startIndex = fbsMeshlet->start_index();
+                meshlet.indexCount = fbsMeshlet->index_count();
+                meshlet.center     = ToJamVec3(fbsMeshlet->center());
+                meshlet.radius     = fbsMeshlet->radius();
+                meshlet.coneAxis   = ToJamVec3(fbsMeshlet->cone_axis());
+                meshlet.coneCutoff = fbsMeshlet->cone_cutoff();
+                if (static_cast<size_t>(meshlet.startIndex) + meshlet.indexCount > indexCount)
+                {
+                    JAM_ERROR("ModelLoader::LoadV2_() - Meshlet exceeds index stream in node: {}", modelNodeData.name);
+                    return false;
+                }
+                modelNodeData.meshlets.push_back(meshlet);
             }
-            if (material->lightmap_texture())
+        }
+
+        // LOD
+        if (fbsMeshData && fbsMeshData->lods())
+        {
+            modelNodeData.lods.reserve(fbsMeshData->lods()->size());
+            for (const fbs::MeshLod* fbsLod: *fbsMeshData->lods())
             {
-                auto [asset, _]                        = _assetMgrRef.GetOrLoad<TextureAsset>(material->lightmap_texture()->str());
-                modelNodeData.material.lightmapTexture = asset;
+                MeshLod lod;
+                lod.startIndex = fbsLod->start_index();
+                lod.indexCount = fbsLod->index_count();
+                lod.error      = fbsLod->error();
+                if (static_cast<size_t>(lod.startIndex) + lod.indexCount > indexCount)
+                {
+                    JAM_ERROR("ModelLoader::LoadV2_() - LOD exceeds index stream in node: {}", modelNodeData.name);
+                    return false;
+                }
+                modelNodeData.lods.push_back(lod);
             }
         }
+
+        // Bounds (경계가 기록되기 전의 파일은 스트림을 모두 읽은 뒤 계산)
+        if (fbsNodeData->bounds())
+        {
+            modelNodeData.bounds = ToJamBounds(*fbsNodeData->bounds());
+        }
+
+        // Material
+        if (fbsNodeData->material())
+        {
+            modelNodeData.material = ToJamMaterial(fbsNodeData->material(), m_modelNodes.size(), m_textureReferences);
+        }
         m_modelNodes.emplace_back(std::move(modelNodeData));
     }
+
+    // 모든 청크를 하나의 업로드 버퍼에 병렬로 해제
+    if (!decodeJobs.empty())
+    {
+        m_decodedStreams = std::make_unique_for_overwrite<UInt8[]>(decodedByteWidth);
+
+        std::atomic<bool> bFailed = false;
+        ThreadPool::GetGlobal().ParallelFor(static_cast<UInt32>(decodeJobs.size()), [&](const UInt32 _index) {
+            const ChunkDecodeJob& job = decodeJobs[_index];
+            if (!DecodeModelChunk(job.chunk, std::span(m_decodedStreams.get() + job.offset, job.byteWidth)))
+            {
+                bFailed = true;
+            }
+        });
+
+        if (bFailed)
+        {
+            JAM_ERROR("ModelLoader::LoadV2_() - Failed to decompress stream chunks");
+            return false;
+        }
+
+        for (const ChunkDecodeJob& job: decodeJobs)
+        {
+            PackedMeshData& packedMeshData = m_modelNodes[job.nodeIndex].packedMeshData;
+            const UInt8*    pStream        = m_decodedStreams.get() + job.offset;
+            if (job.bIndexStream)
+            {
+                packedMeshData.indices = std::span(pStream, job.byteWidth);
+            }
+            else
+            {
+                packedMeshData.vertices = std::span(pStream, job.byteWidth);
+            }
+        }
+    }
+
+    ComputeMissingNodeBounds(m_modelNodes);
     return true;
 }
 
@@ -1,21 +1,53 @@
 #pragma once
+#include "AssetFile.h"
 #include "Model.h"
 
 namespace jam
 {
 class AssetManager;
 
+// .jmodel 로더
+// v2 파일은 메모리 맵 (또는 마운트된 팩의 항목) 의 정점/인덱스 스트림을 복사 없이 ModelNodeData::packedMeshData 로 노출함
+// 압축된 스트림은 하나의 버퍼에 병렬로 해제되며 마찬가지로 로더가 소유함
+// 따라서 GetLoadData() 의 결과는 로더가 살아있는 동안에만 유효함
+// 머티리얼 텍스처는 경로만 기록해 두었다가 ResolveTextures() 에서 에셋으로 바꿈
+// 따라서 에셋 매니저 없이 호출하는 Load 는 워커 스레드에서도 안전함 (AssetManager::LoadAsync)
 class ModelLoader
 {
 public:
-    bool           Load(AssetManager& _assetMgrRef, const fs::path& _path);
+    // 머티리얼이 참조하는 텍스처 (노드, 머티리얼 슬롯, 경로)
+    struct TextureReference
+    {
+        size_t                                       nodeIndex = 0;
+        std::optional<Ref<TextureAsset>> Material::* pSlot     = nullptr;
+        std::string                                  path;
+    };
+
+    // _bTrustedFile: 신뢰할 수 있는 파일 (엔진이 쿠킹한 파일)이라면 flatbuffers 검증을 생략하고 헤더 체크섬만 확인함
+    bool           Load(AssetManager& _assetMgrRef, const fs::path& _path, bool _bTrustedFile = false);
+    bool           Load(const fs::path& _path, bool _bTrustedFile = false);    // 텍스처는 ResolveTextures() 전까지 로드하지 않음
+    bool           Load(const AssetFile& _file, bool _bTrustedFile = false);   // 파일 내용을 공유하며 스트림은 그대로 가리킴
     NODISCARD auto GetLoadData() const { return std::span<const ModelNodeData>(m_modelNodes); }
     NODISCARD bool IsLoaded() const { return !m_modelNodes.empty(); }
 
+    // 머티리얼이 참조하는 텍스처 경로만 읽음 (스트림은 해제하지 않음, 중복 제거됨)
+    NODISCARD static bool ReadTexturePaths(std::span<const UInt8> _file, std::vector<std::string>& _out_paths);
+
+    // 기록된 텍스처를 로드해 머티리얼에 채움 (메인 스레드)
+    // _bAsync 라면 LoadAsync 로 요청만 하고 기다리지 않음 (텍스처는 로드가 끝나야 유효)
+    void                                        ResolveTextures(AssetManager& _assetMgrRef, bool _bAsync);
+    NODISCARD std::span<const TextureReference> GetTextureReferences() const { return m_textureReferences; }
+
 private:
+    bool Load_(const fs::path& _path, bool _bTrustedFile);
+    bool LoadV1_(std::span<const UInt8> _file);
+    bool LoadV2_(std::span<const UInt8> _file, bool _bTrustedFile);
     void Clear_();
 
-    std::vector<ModelNodeData> m_modelNodes;
+    AssetFile                     m_file;             // v2 스트림이 가리키는 메모리
+    std::unique_ptr<UInt8[]>      m_decodedStreams;   // 압축 해제된 스트림이 가리키는 메모리
+    std::vector<ModelNodeData>    m_modelNodes;
+    std::vector<TextureReference> m_textureReferences;   // 아직 로드하지 않은 머티리얼 텍스처
 };
 
 }   // namespace jam
\ No newline at end of file
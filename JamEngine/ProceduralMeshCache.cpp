@@ -0,0 +1,154 @@
+#include "pch.h"
+
+#include "ProceduralMeshCache.h"
+
+#include "MeshFactory.h"
+
+#include <bit>
+#include <xxhash.h>
+
+namespace
+{
+
+using namespace jam;
+
+// 크기는 비트 패턴으로 해시하고 비교함 (-0 은 0 으로 정규화, NaN 은 같은 비트끼리 같음)
+// 숫자 비교를 쓰면 -0 == 0 이지만 해시가 다르고 NaN 은 자기 자신과도 달라 unordered_map 의 규칙이 깨짐
+NODISCARD UInt32 GetSizeBits(const float _value)
+{
+    return std::bit_cast<UInt32>(_value == 0.f ? 0.f : _value);
+}
+
+}   // namespace
+
+namespace jam
+{
+
+PrimitiveDesc PrimitiveDesc::Plane(const float _width, const float _height, const eVertexType _vertexType)
+{
+    return { ePrimitiveType::Plane, _vertexType, { _width, _height, 0.f }, { 0, 0 } };
+}
+
+PrimitiveDesc PrimitiveDesc::Cube(const float _width, const float _height, const float _depth, const eVertexType _vertexType)
+{
+    return { ePrimitiveType::Cube, _vertexType, { _width, _height, _depth }, { 0, 0 } };
+}
+
+PrimitiveDesc PrimitiveDesc::Sphere(const float _radius, const UInt32 _segments, const UInt32 _rings, const eVertexType _vertexType)
+{
+    return { ePrimitiveType::Sphere, _vertexType, { _radius, 0.f, 0.f }, { _segments, _rings } };
+}
+
+PrimitiveDesc PrimitiveDesc::Cylinder(const float _radius, const float _height, const UInt32 _segments, const eVertexType _vertexType)
+{
+    return { ePrimitiveType::Cylinder, _vertexType, { _radius, _height, 0.f }, { _segments, 0 } };
+}
+
+PrimitiveDesc PrimitiveDesc::Cone(const float _radius, const float _height, const UInt32 _segments, const eVertexType _vertexType)
+{
+    return { ePrimitiveType::Cone, _vertexType, { _radius, _height, 0.f }, { _segments, 0 } };
+}
+
+PrimitiveDesc PrimitiveDesc::Capsule(const float _radius, const float _height, const UInt32 _segments, const UInt32 _rings, const eVertexType _vertexType)
+{
+    return { ePrimitiveType::Capsule, _vertexType, { _radius, _height, 0.f }, { _segments, _rings } };
+}
+
+PrimitiveDesc PrimitiveDesc::Grid(const float _width, const float _height, const UInt32 _rows, const UInt32 _columns, const eVertexType _vertexType)
+{
+    return { ePrimitiveType::Grid, _vertexType, { _width, _height, 0.f }, { _rows, _columns } };
+}
+
+MeshData PrimitiveDesc::CreateMeshData() const
+{
+    switch (type)
+    {
+        case ePrimitiveType::Plane: return CreatePlaneMesh(size[0], size[1]);
+        case ePrimitiveType::Cube: return CreateCubeMesh(size[0], size[1], size[2]);
+        case ePrimitiveType::Sphere: return CreateSphereMesh(size[0], count[0], count[1]);
+        case ePrimitiveType::Cylinder: return CreateCylinderMesh(size[0], size[1], count[0]);
+        case ePrimitiveType::Cone: return CreateConeMesh(size[0], size[1], count[0]);
+        case ePrimitiveType::Capsule: return CreateCapsuleMesh(size[0], size[1], count[0], count[1]);
+        case ePrimitiveType::Grid: return CreateGridMesh(size[0], size[1], count[0], count[1]);
+        default:
+            JAM_ASSERT(false, "Unknown primitive type");
+            return MeshData();
+    }
+}
+
+UInt64 PrimitiveDesc::GetHash() const
+{
+    const UInt8  types[2]    = { EnumToInt(type), static_cast<UInt8>(EnumToInt(vertexType)) };
+    const UInt32 sizeBits[3] = { GetSizeBits(size[0]), GetSizeBits(size[1]), GetSizeBits(size[2]) };
+
+    XXH3_state_t state;
+    XXH3_64bits_reset(&state);
+    XXH3_64bits_update(&state, types, sizeof(types));
+    XXH3_64bits_update(&state, sizeBits, sizeof(sizeBits));
+    XXH3_64bits_update(&state, count, sizeof(count));
+    return XXH3_64bits_digest(&state);
+}
+
+bool PrimitiveDesc::operator==(const PrimitiveDesc& _other) const
+{
+    return type == _other.type && vertexType == _other.vertexType && std::ranges::equal(size, _other.size, {}, GetSizeBits, GetSizeBits) && std::equal(std::begin(count), std::end(count), std::begin(_other.count));
+}
+
+ProceduralMeshCache::ProceduralMeshCache(const size_t _maxUnusedCount)
+    : m_maxUnusedCount(_maxUnusedCount)
+{
+}
+
+Ref<const Mesh> ProceduralMeshCache::GetOrCreate(const PrimitiveDesc& _desc)
+{
+    if (auto iter = m_entries.find(_desc); iter != m_entries.end())
+    {
+        ++m_stats.hitCount;
+        iter->second.lastUse = ++m_useClock;
+        return iter->second.pMesh;
+    }
+
+    ++m_stats.missCount;
+    Ref<Mesh> pMesh = MakeRef<Mesh>();
+    if (!pMesh->Initialize(_desc.CreateMeshData(), _desc.vertexType, eTopology::TriangleList))
+    {
+        return nullptr;   // 실패한 메쉬는 캐시하지 않음
+    }
+    m_entries.emplace(_desc, Entry { pMesh, ++m_useClock });
+
+    Trim();
+    return pMesh;
+}
+
+void ProceduralMeshCache::Trim()
+{
+    // 캐시만 참조하는 메쉬가 제거 후보
+    std::vector<std::pair<UInt64, PrimitiveDesc>> unusedEntries;
+    for (const auto& [desc, entry]: m_entries)
+    {
+        if (entry.pMesh.use_count() == 1)
+        {
+            unusedEntries.emplace_back(entry.lastUse, desc);
+        }
+    }
+
+    if (unusedEntries.size() <= m_maxUnusedCount)
+    {
+        return;
+    }
+
+    const size_t evictCount = unusedEntries.size() - m_maxUnusedCount;
+    std::partial_sort(unusedEntries.begin(), unusedEntries.begin() + evictCount, unusedEntries.end(), [](const auto& _lhs, const auto& _rhs) { return _lhs.first < _rhs.first; });
+    for (size_t i = 0; i < evictCount; ++i)
+    {
+        m_entries.erase(unusedEntries[i].second);
+    }
+    m_stats.evictionCount += evictCount;
+}
+
+void ProceduralMeshCache::Clear()
+{
+    m_entries.clear();
+}
+
+}   // namespace jam
\ No newline at end of file
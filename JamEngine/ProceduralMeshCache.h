@@ -0,0 +1,89 @@
+#pragma once
+#include "Mesh.h"
+
+namespace jam
+{
+
+enum class ePrimitiveType : UInt8
+{
+    Plane,
+    Cube,
+    Sphere,
+    Cylinder,
+    Cone,
+    Capsule,
+    Grid,
+};
+
+// 프리미티브 종류와 MeshFactory 파라미터 (변환은 포함하지 않으므로 월드 행렬로 배치)
+struct PrimitiveDesc
+{
+    ePrimitiveType type       = ePrimitiveType::Cube;
+    eVertexType    vertexType = eVertexType::Vertex3;
+    float          size[3]    = {};   // Plane/Grid: width, height | Cube: width, height, depth | 그 외: radius, height
+    UInt32         count[2]   = {};   // Sphere/Capsule: segments, rings | Cylinder/Cone: segments | Grid: rows, columns
+
+    NODISCARD static PrimitiveDesc Plane(float _width, float _height, eVertexType _vertexType = eVertexType::Vertex3);
+    NODISCARD static PrimitiveDesc Cube(float _width, float _height, float _depth, eVertexType _vertexType = eVertexType::Vertex3);
+    NODISCARD static PrimitiveDesc Sphere(float _radius, UInt32 _segments, UInt32 _rings, eVertexType _vertexType = eVertexType::Vertex3);
+    NODISCARD static PrimitiveDesc Cylinder(float _radius, float _height, UInt32 _segments, eVertexType _vertexType = eVertexType::Vertex3);
+    NODISCARD static PrimitiveDesc Cone(float _radius, float _height, UInt32 _segments, eVertexType _vertexType = eVertexType::Vertex3);
+    NODISCARD static PrimitiveDesc Capsule(float _radius, float _height, UInt32 _segments, UInt32 _rings, eVertexType _vertexType = eVertexType::Vertex3);
+    NODISCARD static PrimitiveDesc Grid(float _width, float _height, UInt32 _rows, UInt32 _columns, eVertexType _vertexType = eVertexType::Vertex3);
+
+    NODISCARD MeshData CreateMeshData() const;
+    NODISCARD UInt64   GetHash() const;
+
+    NODISCARD bool operator==(const PrimitiveDesc& _other) const;
+};
+
+struct ProceduralMeshCacheStats
+{
+    UInt64 hitCount      = 0;
+    UInt64 missCount     = 0;
+    UInt64 evictionCount = 0;
+};
+
+// 같은 파라미터의 프리미티브 메쉬를 한 번만 생성/업로드하고 공유하는 캐시
+// 메쉬는 불변이며 참조 카운트로 수명을 관리함 (캐시 외부에서 참조 중인 메쉬는 제거되지 않음)
+// 외부 참조가 없는 메쉬는 최대 k_defaultMaxUnusedCount 개까지 유지하고 넘으면 가장 오래 사용하지 않은 것부터 제거
+// GPU 리소스를 생성하므로 메인 스레드에서 사용
+class ProceduralMeshCache
+{
+public:
+    static constexpr size_t k_defaultMaxUnusedCount = 64;
+
+    explicit ProceduralMeshCache(size_t _maxUnusedCount = k_defaultMaxUnusedCount);
+
+    NODISCARD Ref<const Mesh> GetOrCreate(const PrimitiveDesc& _desc);   // GeometryPool 할당에 실패하면 nullptr
+
+    // 외부 참조가 없는 메쉬가 최대 개수를 넘는다면 가장 오래 사용하지 않은 것부터 제거
+    void Trim();
+    void Clear();   // 외부 참조 중인 메쉬는 참조가 끝날 때 해제됨
+
+    void                               SetMaxUnusedCount(const size_t _maxUnusedCount) { m_maxUnusedCount = _maxUnusedCount; }
+    NODISCARD size_t                   GetMaxUnusedCount() const { return m_maxUnusedCount; }
+    NODISCARD size_t                   GetMeshCount() const { return m_entries.size(); }
+    NODISCARD ProceduralMeshCacheStats GetStats() const { return m_stats; }
+    void                               ResetStats() { m_stats = ProceduralMeshCacheStats(); }
+
+private:
+    struct Entry
+    {
+        Ref<Mesh> pMesh;
+        UInt64    lastUse = 0;
+    };
+
+    struct DescHasher
+    {
+        size_t operator()(const PrimitiveDesc& _desc) const { return static_cast<size_t>(_desc.GetHash()); }
+    };
+
+    std::unordered_map<PrimitiveDesc, Entry, DescHasher> m_entries;
+
+    size_t                   m_maxUnusedCount = k_defaultMaxUnusedCount;
+    UInt64                   m_useClock       = 0;
+    ProceduralMeshCacheStats m_stats;
+};
+
+}   // namespace jam
\ No newline at end of file
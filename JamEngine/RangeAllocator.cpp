@@ -0,0 +1,174 @@
+#include "pch.h"
+
+#include "RangeAllocator.h"
+
+namespace jam
+{
+
+RangeAllocator::RangeAllocator(const UInt32 _capacity)
+{
+    Reset(_capacity);
+}
+
+Result<UInt32> RangeAllocator::Allocate(const UInt32 _size)
+{
+    JAM_ASSERT(_size > 0, "RangeAllocator::Allocate() - Size must be greater than 0");
+
+    // 요청 크기 이상인 가장 작은 빈 구간
+    auto bestIter = m_freeBySize.lower_bound(_size);
+    if (bestIter == m_freeBySize.end())
+    {
+        return Fail;
+    }
+
+    const UInt32 offset    = bestIter->second;
+    const UInt32 blockSize = bestIter->first;
+    EraseFreeBlock_(m_freeByOffset.find(offset));
+    if (blockSize > _size)
+    {
+        InsertFreeBlock_(offset + _size, blockSize - _size);
+    }
+
+    m_allocations.emplace(offset, _size);
+    m_usedSize += _size;
+    return offset;
+}
+
+void RangeAllocator::Free(const UInt32 _offset)
+{
+    auto allocIter = m_allocations.find(_offset);
+    if (allocIter == m_allocations.end())
+    {
+        JAM_ERROR("RangeAllocator::Free() - Unknown offset: {}", _offset);
+        return;
+    }
+
+    UInt32 offset = _offset;
+    UInt32 size   = allocIter->second;
+    m_usedSize -= size;
+    m_allocations.erase(allocIter);
+
+    // 뒤쪽 빈 구간과 병합
+    auto nextIter = m_freeByOffset.find(offset + size);
+    if (nextIter != m_freeByOffset.end())
+    {
+        size += nextIter->second;
+        EraseFreeBlock_(nextIter);
+    }
+
+    // 앞쪽 빈 구간과 병합
+    auto prevIter = m_freeByOffset.lower_bound(offset);
+    if (prevIter != m_freeByOffset.begin())
+    {
+        --prevIter;
+        if (prevIter->first + prevIter->second == offset)
+        {
+            offset = prevIter->first;
+            size += prevIter->second;
+            EraseFreeBlock_(prevIter);
+        }
+    }
+
+    InsertFreeBlock_(offset, size);
+}
+
+std::vector<RangeMove> RangeAllocator::Defragment()
+{
+    std::vector<RangeMove> moves;
+    moves.reserve(m_allocations.size());
+
+    std::map<UInt32, UInt32> allocations;
+    UInt32                   offset = 0;
+    for (const auto& [from, size]: m_allocations)
+    {
+        moves.push_back({ from, offset, size });
+        allocations.emplace_hint(allocations.end(), offset, size);
+        offset += size;
+    }
+
+    m_allocations = std::move(allocations);
+    m_freeByOffset.clear();
+    m_freeBySize.clear();
+    if (offset < m_capacity)
+    {
+        InsertFreeBlock_(offset, m_capacity - offset);
+    }
+    return moves;
+}
+
+void RangeAllocator::Grow(const UInt32 _capacity)
+{
+    if (_capacity <= m_capacity)
+    {
+        return;
+    }
+
+    // 마지막 빈 구간이 끝에 붙어있다면 그 구간을 늘림
+    UInt32 offset = m_capacity;
+    UInt32 size   = _capacity - m_capacity;
+    if (!m_freeByOffset.empty())
+    {
+        auto lastIter = std::prev(m_freeByOffset.end());
+        if (lastIter->first + lastIter->second == m_capacity)
+        {
+            offset = lastIter->first;
+            size += lastIter->second;
+            EraseFreeBlock_(lastIter);
+        }
+    }
+
+    InsertFreeBlock_(offset, size);
+    m_capacity = _capacity;
+}
+
+void RangeAllocator::Reset(const UInt32 _capacity)
+{
+    m_freeByOffset.clear();
+    m_freeBySize.clear();
+    m_allocations.clear();
+    m_capacity = _capacity;
+    m_usedSize = 0;
+    if (_capacity > 0)
+    {
+        InsertFreeBlock_(0, _capacity);
+    }
+}
+
+UInt32 RangeAllocator::GetAllocationSize(const UInt32 _offset) const
+{
+    auto iter = m_allocations.find(_offset);
+    return iter == m_allocations.end() ? 0 : iter->second;
+}
+
+float RangeAllocator::GetFragmentation() const
+{
+    const UInt32 freeSize = GetFreeSize();
+    if (freeSize == 0)
+    {
+        return 0.f;
+    }
+    return 1.f - static_cast<float>(GetLargestFreeSize()) / static_cast<float>(freeSize);
+}
+
+void RangeAllocator::InsertFreeBlock_(const UInt32 _offset, const UInt32 _size)
+{
+    m_freeByOffset.emplace(_offset, _size);
+    m_freeBySize.emplace(_size, _offset);
+}
+
+void RangeAllocator::EraseFreeBlock_(const std::map<UInt32, UInt32>::iterator _iter)
+{
+    // 같은 크기의 구간이 여럿일 수 있으므로 오프셋까지 일치하는 항목을 찾음
+    auto [first, last] = m_freeBySize.equal_range(_iter->second);
+    for (auto iter = first; iter != last; ++iter)
+    {
+        if (iter->second == _iter->first)
+        {
+            m_freeBySize.erase(iter);
+            break;
+        }
+    }
+    m_freeByOffset.erase(_iter);
+}
+
+}   // namespace jam
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+#include <map>
+
+namespace jam
+{
+
+// 조각 모음으로 구간이 옮겨진 위치
+struct RangeMove
+{
+    UInt32 from = 0;
+    UInt32 to   = 0;
+    UInt32 size = 0;
+};
+
+// 연속 구간 하나를 [0, capacity) 안에서 나눠주는 할당기
+// best-fit 빈 구간 목록을 사용하며 해제 시 인접한 빈 구간을 병합함
+// 단위는 호출자가 정하며 (정점, 인덱스, 바이트 등) GPU 리소스와 무관하므로 디바이스 없이 사용할 수 있음
+class RangeAllocator
+{
+public:
+    explicit RangeAllocator(UInt32 _capacity = 0);
+
+    NODISCARD Result<UInt32> Allocate(UInt32 _size);   // 할당된 구간의 시작 오프셋
+    void                     Free(UInt32 _offset);
+
+    // 사용 중인 구간을 오프셋 순서대로 앞쪽에 채움 - 모든 구간의 이전/이후 위치를 반환
+    NODISCARD std::vector<RangeMove> Defragment();
+
+    void Grow(UInt32 _capacity);   // 늘어난 부분은 빈 구간으로 추가
+    void Reset(UInt32 _capacity);  // 모든 할당을 버림
+
+    NODISCARD UInt32 GetCapacity() const { return m_capacity; }
+    NODISCARD UInt32 GetUsedSize() const { return m_usedSize; }
+    NODISCARD UInt32 GetFreeSize() const { return m_capacity - m_usedSize; }
+    NODISCARD UInt32 GetLargestFreeSize() const { return m_freeBySize.empty() ? 0 : m_freeBySize.rbegin()->first; }
+    NODISCARD size_t GetAllocationCount() const { return m_allocations.size(); }
+    NODISCARD size_t GetFreeBlockCount() const { return m_freeByOffset.size(); }
+    NODISCARD UInt32 GetAllocationSize(UInt32 _offset) const;
+
+    // 0 이면 빈 공간이 하나로 모여있고 1 에 가까울수록 잘게 흩어져 있음
+    NODISCARD float GetFragmentation() const;
+
+private:
+    void InsertFreeBlock_(UInt32 _offset, UInt32 _size);
+    void EraseFreeBlock_(std::map<UInt32, UInt32>::iterator _iter);
+
+    std::map<UInt32, UInt32>      m_freeByOffset;   // offset -> size
+    std::multimap<UInt32, UInt32> m_freeBySize;     // size -> offset
+    std::map<UInt32, UInt32>      m_allocations;    // offset -> size
+
+    UInt32 m_capacity = 0;
+    UInt32 m_usedSize = 0;
+};
+
+}   // namespace jam
\ No newline at end of file
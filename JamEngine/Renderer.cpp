@@ -22,6 +22,12 @@ struct RendererContext
     // pipeline
     D3D11_PRIMITIVE_TOPOLOGY topology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
 
+    // 같은 기하 풀 페이지를 쓰는 연속된 드로우는 버퍼를 다시 바인딩하지 않음 (Present 마다 초기화)
+    ID3D11Buffer* pBoundVertexBuffer = nullptr;
+    jam::UInt32   boundVertexStride  = 0;
+    ID3D11Buffer* pBoundIndexBuffer  = nullptr;
+    DXGI_FORMAT   boundIndexFormat   = DXGI_FORMAT_UNKNOWN;
+
     // for full screen quad
     jam::VertexBuffer fullScreenQuadVB;
     jam::IndexBuffer  fullScreenQuadIB;
@@ -146,6 +152,10 @@ void Renderer::Present(const bool _bVSync)
     {
         JAM_CRASH("Failed to present swap chain. HRESULT: {}", GetSystemErrorMessage(hr));
     }
+
+    // 외부 코드 (ImGui 등) 가 바인딩을 바꿨을 수 있으므로 캐시를 비움
+    g_renderer.pBoundVertexBuffer = nullptr;
+    g_renderer.pBoundIndexBuffer  = nullptr;
 }
 
 ID3D11Device* Renderer::GetDevice()
@@ -433,6 +443,13 @@ void Renderer::BindTopology(const D3D11_PRIMITIVE_TOPOLOGY _topology)
 
 void Renderer::BindVertexBuffer(ID3D11Buffer* _pVertexBuffer, const UInt32 _stride)
 {
+    if (g_renderer.pBoundVertexBuffer == _pVertexBuffer && g_renderer.boundVertexStride == _stride)
+    {
+        return;
+    }
+    g_renderer.pBoundVertexBuffer = _pVertexBuffer;
+    g_renderer.boundVertexStride  = _stride;
+
     const UInt32   stride[] = { _stride };
     constexpr UINT offset[] = { 0 };
 
@@ -440,10 +457,17 @@ void Renderer::BindVertexBuffer(ID3D11Buffer* _pVertexBuffer, const UInt32 _stri
     ctx->IASetVertexBuffers(0, 1, &_pVertexBuffer, stride, offset);
 }
 
-void Renderer::BindIndexBuffer(ID3D11Buffer* _pIndexBuffer)
+void Renderer::BindIndexBuffer(ID3D11Buffer* _pIndexBuffer, const DXGI_FORMAT _format)
 {
+    if (g_renderer.pBoundIndexBuffer == _pIndexBuffer && g_renderer.boundIndexFormat == _format)
+    {
+        return;
+    }
+    g_renderer.pBoundIndexBuffer = _pIndexBuffer;
+    g_renderer.boundIndexFormat  = _format;
+
     ID3D11DeviceContext* ctx = g_renderer.pDeviceContext.Get();
-    ctx->IASetIndexBuffer(_pIndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+    ctx->IASetIndexBuffer(_pIndexBuffer, _format, 0);
 }
 
 void Renderer::BindInputLayout(ID3D11InputLayout* _pInputLayout)
@@ -55,7 +55,7 @@ public:
     // pipeline interface
     static void BindTopology(D3D11_PRIMITIVE_TOPOLOGY _topology);
     static void BindVertexBuffer(ID3D11Buffer* _pVertexBuffer, UInt32 _stride);
-    static void BindIndexBuffer(ID3D11Buffer* _pIndexBuffer);
+    static void BindIndexBuffer(ID3D11Buffer* _pIndexBuffer, DXGI_FORMAT _format = DXGI_FORMAT_R32_UINT);
 
     static void BindInputLayout(ID3D11InputLayout* _pInputLayout);
     static void BindVertexShader(ID3D11VertexShader* _pVertexShader);
@@ -10,7 +10,7 @@ struct BufferInitData
 
 struct IndexBufferInitData
 {
-    const Index* pData = nullptr;
+    const void* pData = nullptr;   // eIndexFormat 에 맞는 인덱스 배열
 };
 
 struct Texture2DInitData
@@ -53,4 +53,10 @@ enum class eTopology : char
     TriangleStrip = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP,
 };
 
+enum class eIndexFormat : char
+{
+    UInt16 = DXGI_FORMAT_R16_UINT,   // 정점이 65536 개 이하인 메쉬
+    UInt32 = DXGI_FORMAT_R32_UINT,
+};
+
 }   // namespace jam
\ No newline at end of file
@@ -6,9 +6,12 @@
 #include "Components.h"
 #include "Config.h"
 #include "Entity.h"
+#include "ModelAsset.h"
 #include "SceneSerializer.h"
 #include "ShaderBridge.h"
 
+#include <unordered_set>
+
 namespace jam
 {
 
@@ -89,6 +92,27 @@ void Scene::Clear()
     m_assetManager.ClearAll();
 }
 
+GeometryMemoryStats Scene::GetGeometryMemoryStats() const
+{
+    // 중복 제거로 여러 키가 공유하는 모델은 한 번만 합산
+    GeometryMemoryStats              stats;
+    std::unordered_set<const Asset*> visitedAssets;
+    for (const Ref<Asset>& pAsset: m_assetManager.GetContainer(eAssetType::Model) | std::views::values)
+    {
+        if (visitedAssets.insert(pAsset.get()).second)
+        {
+            stats += std::static_pointer_cast<ModelAsset>(pAsset)->GetModel().GetMemoryStats();
+        }
+    }
+    return stats;
+}
+
+void Scene::LogGeometryMemoryStats() const
+{
+    const GeometryMemoryStats stats = GetGeometryMemoryStats();
+    Log::Info("Scene '{}' geometry memory - vertex: {} bytes, index: {} bytes (32-bit: {} bytes, saved: {} bytes)", m_name, stats.vertexByteWidth, stats.indexByteWidth, stats.wideIndexByteWidth, stats.wideIndexByteWidth - stats.indexByteWidth);
+}
+
 Entity Scene::CreateEntity()
 {
     entt::entity handle = m_registry.create();
@@ -1,5 +1,7 @@
 #pragma once
 #include "AssetManager.h"
+#include "LodSelector.h"
+#include "ProceduralMeshCache.h"
 
 namespace jam
 {
@@ -7,6 +9,7 @@ namespace jam
 class Texture2D;
 class Entity;
 class Event;
+struct GeometryMemoryStats;
 
 class Scene
 {
@@ -79,10 +82,24 @@ public:
     NODISCARD AssetManager&       GetAssetManagerRef() { return m_assetManager; }
     NODISCARD const AssetManager& GetAssetManager() const { return m_assetManager; }
 
+    // 씬이 로드한 모델들의 GPU 기하 메모리 (16비트 인덱스로 절약한 크기를 포함)
+    NODISCARD GeometryMemoryStats GetGeometryMemoryStats() const;
+    void                          LogGeometryMemoryStats() const;
+
+    // LOD selection interface (SceneLayer 가 매 프레임 스크립트 이후에 갱신)
+    NODISCARD LodSelector&       GetLodSelectorRef() { return m_lodSelector; }
+    NODISCARD const LodSelector& GetLodSelector() const { return m_lodSelector; }
+
+    // procedural mesh interface (같은 파라미터의 프리미티브는 GPU 메쉬 하나를 공유)
+    NODISCARD ProceduralMeshCache&       GetProceduralMeshCacheRef() { return m_proceduralMeshCache; }
+    NODISCARD const ProceduralMeshCache& GetProceduralMeshCache() const { return m_proceduralMeshCache; }
+
 protected:
-    AssetManager   m_assetManager;
-    std::string    m_name;
-    entt::registry m_registry;
+    AssetManager        m_assetManager;
+    std::string         m_name;
+    entt::registry      m_registry;
+    LodSelector         m_lodSelector;
+    ProceduralMeshCache m_proceduralMeshCache;
 };
 
 }   // namespace jam
\ No newline at end of file
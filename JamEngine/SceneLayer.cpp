@@ -40,6 +40,12 @@ void SceneLayer::OnUpdate(const float _deltaSec)
                     scriptRef->OnUpdate(_deltaSec);
                 }
             });
+
+        // 스크립트로 이동한 엔티티까지 반영하여 LOD 를 선택
+        m_pActiveScene->GetLodSelectorRef().Update(*m_pActiveScene);
+
+        // 이번 프레임에 참조가 풀린 에셋까지 포함해 상주 메모리 예산을 적용
+        m_pActiveScene->GetAssetManagerRef().EnforceResidencyBudgets();
     }
 }
 
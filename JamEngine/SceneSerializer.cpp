@@ -6,10 +6,8 @@
 #include "Config.h"
 #include "Entity.h"
 #include "JsonUtilities.h"
-#include "ModelAsset.h"
 #include "Scene.h"
 #include "StringUtilities.h"
-#include "TextureAsset.h"
 
 namespace
 {
@@ -144,9 +142,13 @@ Json SceneSerializer::SerializeAssetManager(const AssetManager& _assetMgr) const
     {
         Json        json;
         const auto& container = _assetMgr.GetContainer(type);
-        for (const fs::path& key: container | std::views::keys)
+        for (const AssetID id: container | std::views::keys)
         {
-            json.push_back(key);
+            // 중복 제거로 공유되는 에셋은 키마다 기록 (Asset::GetPath 는 처음 로드한 키만 가리킴)
+            if (auto [path, bResult] = _assetMgr.GetAssetPath(id); bResult)
+            {
+                json.push_back(path);   // 정규화된 키 경로
+            }
         }
 
         if (IsValidJson(json))
@@ -219,6 +221,7 @@ void SceneSerializer::DeserializeAssetManager(const Json& _json, AssetManager* _
         return;
     }
 
+    std::vector<AssetHandle<Asset>> handles;
     for (const eAssetType& type: EnumRange<eAssetType>())
     {
         std::string_view typeName = EnumToString(type);
@@ -238,16 +241,18 @@ void SceneSerializer::DeserializeAssetManager(const Json& _json, AssetManager* _
         {
             std::filesystem::path path = item.get<std::filesystem::path>();
 
-            switch (type)
-            {
-                static_assert(EnumCount<eAssetType>() == 2, "Add new asset type to SceneSerializer::DeserializeAssetManager()");
+            // 모든 에셋을 먼저 요청해 워커 스레드에서 병렬로 로드 (모델이 참조하는 텍스처도 함께 요청됨)
+            handles.push_back(_pAssetMgr->LoadAsync(type, path));
+        }
+    }
 
-                case eAssetType::Model: _pAssetMgr->Load<ModelAsset>(path); break;
-                case eAssetType::Texture: _pAssetMgr->Load<TextureAsset>(path); break;
-                default:
-                    JAM_ERROR("DeserializeAssetManager() - Unsupported asset type: {}", typeName);
-                    break;
-            }
+    // 컴포넌트가 에셋을 찾을 수 있도록 의존 순서대로 모두 마무리
+    _pAssetMgr->FinishPendingLoads();
+    for (const AssetHandle<Asset>& handle: handles)
+    {
+        if (handle.IsFailed())
+        {
+            JAM_ERROR("DeserializeAssetManager() - Failed to load asset: {}", handle.GetRequest()->path.string());
         }
     }
 }
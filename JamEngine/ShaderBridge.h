@@ -263,7 +263,7 @@ struct VS_INPUT_VERTEX3
     JAM_FLOAT3 normal    JAM_SEMANTIC(NORMAL);
     JAM_FLOAT2 uv0       JAM_SEMANTIC(TEXCOORD0);
     JAM_FLOAT2 uv1       JAM_SEMANTIC(TEXCOORD1);
-    JAM_FLOAT3 tangentL  JAM_SEMANTIC(TANGENT);
+    JAM_FLOAT4 tangentL  JAM_SEMANTIC(TANGENT);   // w 는 종법선 부호
 };
 
 struct VS_INPUT_VERTEX3_POSONLY
@@ -271,6 +271,26 @@ struct VS_INPUT_VERTEX3_POSONLY
     JAM_FLOAT3 positionL JAM_SEMANTIC(POSITION);
 };
 
+// 압축 정점 - ShaderCommon.hlsl 의 UnpackHalf2 / DecodeOctahedral / DecodeOctahedralTangent / DecodeQuantizedPosition 으로 복원
+struct VS_INPUT_VERTEX3_COMPACT
+{
+    JAM_FLOAT3 positionL JAM_SEMANTIC(POSITION);
+    JAM_UINT32 uv0       JAM_SEMANTIC(TEXCOORD0);   // half2
+    JAM_UINT32 uv1       JAM_SEMANTIC(TEXCOORD1);   // half2
+    JAM_UINT32 normal    JAM_SEMANTIC(NORMAL);      // octahedral snorm16x2
+    JAM_UINT32 tangentL  JAM_SEMANTIC(TANGENT);     // octahedral snorm16x2 + 종법선 부호
+};
+
+struct VS_INPUT_VERTEX3_QUANTIZED
+{
+    JAM_UINT32 positionXY JAM_SEMANTIC(POSITION0);   // unorm16x2, [0, 1] (dequantize matrix * world)
+    JAM_UINT32 positionZ  JAM_SEMANTIC(POSITION1);   // unorm16
+    JAM_UINT32 uv0        JAM_SEMANTIC(TEXCOORD0);   // half2
+    JAM_UINT32 uv1        JAM_SEMANTIC(TEXCOORD1);   // half2
+    JAM_UINT32 normal     JAM_SEMANTIC(NORMAL);      // octahedral snorm16x2
+    JAM_UINT32 tangentL   JAM_SEMANTIC(TANGENT);     // octahedral snorm16x2 + 종법선 부호
+};
+
 //===================================================
 // Resource Texture
 //===================================================
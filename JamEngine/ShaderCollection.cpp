@@ -14,11 +14,15 @@ struct ShaderProgramManagerState
     ShaderProgramManagerState();
 
     // vs
-    jam::ComPtr<ID3DBlob> pbrVS                                                = nullptr;
-    jam::ComPtr<ID3DBlob> screenSpaceEffectVS                                  = nullptr;
-    jam::ComPtr<ID3DBlob> shadowMappingCasterShaderVS                          = nullptr;
-    jam::ComPtr<ID3DBlob> omniDirectionalAndCascadeShadowMappingCasterShaderVS = nullptr;
-    jam::ComPtr<ID3DBlob> skyboxShaderVS                                       = nullptr;
+    jam::ComPtr<ID3DBlob> pbrVS                                                         = nullptr;
+    jam::ComPtr<ID3DBlob> pbrCompactVS                                                  = nullptr;
+    jam::ComPtr<ID3DBlob> pbrQuantizedVS                                                = nullptr;
+    jam::ComPtr<ID3DBlob> screenSpaceEffectVS                                           = nullptr;
+    jam::ComPtr<ID3DBlob> shadowMappingCasterShaderVS                                   = nullptr;
+    jam::ComPtr<ID3DBlob> shadowMappingCasterShaderQuantizedVS                          = nullptr;
+    jam::ComPtr<ID3DBlob> omniDirectionalAndCascadeShadowMappingCasterShaderVS          = nullptr;
+    jam::ComPtr<ID3DBlob> omniDirectionalAndCascadeShadowMappingCasterShaderQuantizedVS = nullptr;
+    jam::ComPtr<ID3DBlob> skyboxShaderVS                                                = nullptr;
 
     // ps
     jam::ComPtr<ID3DBlob> bloomCombineFilterPS                 = nullptr;
@@ -59,6 +63,26 @@ struct ShaderProgramManagerState
 
 } g_shaderState;
 
+// 메쉬 정점 타입 (Vertex3, Vertex3Compact, Vertex3Quantized) 별 셰이더 프로그램
+struct VertexTypeShaderPrograms
+{
+    jam::ShaderProgram vertex3;
+    jam::ShaderProgram vertex3Compact;
+    jam::ShaderProgram vertex3Quantized;
+
+    NODISCARD const jam::ShaderProgram& Get(const jam::eVertexType _vertexType) const
+    {
+        switch (_vertexType)
+        {
+            case jam::eVertexType::Vertex3Compact: return vertex3Compact;
+            case jam::eVertexType::Vertex3Quantized: return vertex3Quantized;
+            default:
+                JAM_ASSERT(_vertexType == jam::eVertexType::Vertex3, "Mesh shaders need Vertex3, Vertex3Compact or Vertex3Quantized");
+                return vertex3;
+        }
+    }
+};
+
 ShaderProgramManagerState::ShaderProgramManagerState()
 {
     using namespace jam;
@@ -67,15 +91,27 @@ ShaderProgramManagerState::ShaderProgramManagerState()
     compiler.LoadCSO(k_pbrVS, k_pbrVSSize);
     compiler.GetCompiledShader(pbrVS.GetAddressOf());
 
+    compiler.LoadCSO(k_pbrCompactVS, k_pbrCompactVSSize);
+    compiler.GetCompiledShader(pbrCompactVS.GetAddressOf());
+
+    compiler.LoadCSO(k_pbrQuantizedVS, k_pbrQuantizedVSSize);
+    compiler.GetCompiledShader(pbrQuantizedVS.GetAddressOf());
+
     compiler.LoadCSO(k_screenSpaceEffectVS, k_screenSpaceEffectVSSize);
     compiler.GetCompiledShader(screenSpaceEffectVS.GetAddressOf());
 
     compiler.LoadCSO(k_shadowMappingCasterShaderVS, k_shadowMappingCasterShaderVSSize);
     compiler.GetCompiledShader(shadowMappingCasterShaderVS.GetAddressOf());
 
+    compiler.LoadCSO(k_shadowMappingCasterShaderQuantizedVS, k_shadowMappingCasterShaderQuantizedVSSize);
+    compiler.GetCompiledShader(shadowMappingCasterShaderQuantizedVS.GetAddressOf());
+
     compiler.LoadCSO(k_omniDirectionalAndCascadeShadowMappingCasterShaderVS, k_omniDirectionalAndCascadeShadowMappingCasterShaderVSSize);
     compiler.GetCompiledShader(omniDirectionalAndCascadeShadowMappingCasterShaderVS.GetAddressOf());
 
+    compiler.LoadCSO(k_omniDirectionalAndCascadeShadowMappingCasterShaderQuantizedVS, k_omniDirectionalAndCascadeShadowMappingCasterShaderQuantizedVSSize);
+    compiler.GetCompiledShader(omniDirectionalAndCascadeShadowMappingCasterShaderQuantizedVS.GetAddressOf());
+
     compiler.LoadCSO(k_skyboxShaderVS, k_skyboxShaderVSSize);
     compiler.GetCompiledShader(skyboxShaderVS.GetAddressOf());
 
@@ -183,26 +219,30 @@ ShaderProgramManagerState::ShaderProgramManagerState()
 namespace jam
 {
 
-ShaderProgram ShaderCollection::PBRGBufferShader()
+ShaderProgram ShaderCollection::PBRGBufferShader(const eVertexType _vertexType)
 {
-    static ShaderProgram s_shader = []
+    static VertexTypeShaderPrograms s_shaders = []
     {
-        ShaderProgram shader;
-        shader.Initialize(g_shaderState.pbrVS.Get(), g_shaderState.pbrGBufferPS.Get());
-        return shader;
+        VertexTypeShaderPrograms shaders;
+        shaders.vertex3.Initialize(eVertexType::Vertex3, g_shaderState.pbrVS.Get(), g_shaderState.pbrGBufferPS.Get());
+        shaders.vertex3Compact.Initialize(eVertexType::Vertex3Compact, g_shaderState.pbrCompactVS.Get(), g_shaderState.pbrGBufferPS.Get());
+        shaders.vertex3Quantized.Initialize(eVertexType::Vertex3Quantized, g_shaderState.pbrQuantizedVS.Get(), g_shaderState.pbrGBufferPS.Get());
+        return shaders;
     }();
-    return s_shader;
+    return s_shaders.Get(_vertexType);
 }
 
-ShaderProgram ShaderCollection::PBRForwardShader()
+ShaderProgram ShaderCollection::PBRForwardShader(const eVertexType _vertexType)
 {
-    static ShaderProgram s_shader = []
+    static VertexTypeShaderPrograms s_shaders = []
     {
-        ShaderProgram shader;
-        shader.Initialize(g_shaderState.pbrVS.Get(), g_shaderState.pbrForwardPS.Get());
-        return shader;
+        VertexTypeShaderPrograms shaders;
+        shaders.vertex3.Initialize(eVertexType::Vertex3, g_shaderState.pbrVS.Get(), g_shaderState.pbrForwardPS.Get());
+        shaders.vertex3Compact.Initialize(eVertexType::Vertex3Compact, g_shaderState.pbrCompactVS.Get(), g_shaderState.pbrForwardPS.Get());
+        shaders.vertex3Quantized.Initialize(eVertexType::Vertex3Quantized, g_shaderState.pbrQuantizedVS.Get(), g_shaderState.pbrForwardPS.Get());
+        return shaders;
     }();
-    return s_shader;
+    return s_shaders.Get(_vertexType);
 }
 
 ShaderProgram ShaderCollection::PBRLightingShader()
@@ -446,37 +486,43 @@ ShaderProgram ShaderCollection::FXAAFilterQuality5Shader()
     return s_shader;
 }
 
-ShaderProgram ShaderCollection::CascadeShadowMappingShader()
+ShaderProgram ShaderCollection::CascadeShadowMappingShader(const eVertexType _vertexType)
 {
-    static ShaderProgram s_shader = []
+    static VertexTypeShaderPrograms s_shaders = []
     {
-        ShaderProgram shader;
-        shader.Initialize(g_shaderState.omniDirectionalAndCascadeShadowMappingCasterShaderVS.Get(), g_shaderState.cascadeShadowMappingAndShadowMappingCastShaderPS.Get(), g_shaderState.cascadeShaderMappingCasterShaderGSSize.Get());
-        return shader;
+        VertexTypeShaderPrograms shaders;
+        shaders.vertex3.Initialize(eVertexType::Vertex3, g_shaderState.omniDirectionalAndCascadeShadowMappingCasterShaderVS.Get(), g_shaderState.cascadeShadowMappingAndShadowMappingCastShaderPS.Get(), g_shaderState.cascadeShaderMappingCasterShaderGSSize.Get());
+        shaders.vertex3Compact.Initialize(eVertexType::Vertex3Compact, g_shaderState.omniDirectionalAndCascadeShadowMappingCasterShaderVS.Get(), g_shaderState.cascadeShadowMappingAndShadowMappingCastShaderPS.Get(), g_shaderState.cascadeShaderMappingCasterShaderGSSize.Get());
+        shaders.vertex3Quantized.Initialize(eVertexType::Vertex3Quantized, g_shaderState.omniDirectionalAndCascadeShadowMappingCasterShaderQuantizedVS.Get(), g_shaderState.cascadeShadowMappingAndShadowMappingCastShaderPS.Get(), g_shaderState.cascadeShaderMappingCasterShaderGSSize.Get());
+        return shaders;
     }();
-    return s_shader;
+    return s_shaders.Get(_vertexType);
 }
 
-ShaderProgram ShaderCollection::OmniShadowMappingShader()
+ShaderProgram ShaderCollection::OmniShadowMappingShader(const eVertexType _vertexType)
 {
-    static ShaderProgram s_shader = []
+    static VertexTypeShaderPrograms s_shaders = []
     {
-        ShaderProgram shader;
-        shader.Initialize(g_shaderState.omniDirectionalAndCascadeShadowMappingCasterShaderVS.Get(), g_shaderState.omniShadowMappingShadowCasterShaderPS.Get(), g_shaderState.omniDirectionalShaderMappingCasterShaderGS.Get());
-        return shader;
+        VertexTypeShaderPrograms shaders;
+        shaders.vertex3.Initialize(eVertexType::Vertex3, g_shaderState.omniDirectionalAndCascadeShadowMappingCasterShaderVS.Get(), g_shaderState.omniShadowMappingShadowCasterShaderPS.Get(), g_shaderState.omniDirectionalShaderMappingCasterShaderGS.Get());
+        shaders.vertex3Compact.Initialize(eVertexType::Vertex3Compact, g_shaderState.omniDirectionalAndCascadeShadowMappingCasterShaderVS.Get(), g_shaderState.omniShadowMappingShadowCasterShaderPS.Get(), g_shaderState.omniDirectionalShaderMappingCasterShaderGS.Get());
+        shaders.vertex3Quantized.Initialize(eVertexType::Vertex3Quantized, g_shaderState.omniDirectionalAndCascadeShadowMappingCasterShaderQuantizedVS.Get(), g_shaderState.omniShadowMappingShadowCasterShaderPS.Get(), g_shaderState.omniDirectionalShaderMappingCasterShaderGS.Get());
+        return shaders;
     }();
-    return s_shader;
+    return s_shaders.Get(_vertexType);
 }
 
-ShaderProgram ShaderCollection::ShadowMappingShader()
+ShaderProgram ShaderCollection::ShadowMappingShader(const eVertexType _vertexType)
 {
-    static ShaderProgram s_shader = []
+    static VertexTypeShaderPrograms s_shaders = []
     {
-        ShaderProgram shader;
-        shader.Initialize(g_shaderState.shadowMappingCasterShaderVS.Get(), g_shaderState.cascadeShadowMappingAndShadowMappingCastShaderPS.Get());
-        return shader;
+        VertexTypeShaderPrograms shaders;
+        shaders.vertex3.Initialize(eVertexType::Vertex3, g_shaderState.shadowMappingCasterShaderVS.Get(), g_shaderState.cascadeShadowMappingAndShadowMappingCastShaderPS.Get());
+        shaders.vertex3Compact.Initialize(eVertexType::Vertex3Compact, g_shaderState.shadowMappingCasterShaderVS.Get(), g_shaderState.cascadeShadowMappingAndShadowMappingCastShaderPS.Get());
+        shaders.vertex3Quantized.Initialize(eVertexType::Vertex3Quantized, g_shaderState.shadowMappingCasterShaderQuantizedVS.Get(), g_shaderState.cascadeShadowMappingAndShadowMappingCastShaderPS.Get());
+        return shaders;
     }();
-    return s_shader;
+    return s_shaders.Get(_vertexType);
 }
 
 ShaderProgram ShaderCollection::SSAOBlurHorizontalShader()
@@ -9,8 +9,9 @@ class ShaderCollection
 public:
     ShaderCollection() = delete;
 
-    static ShaderProgram PBRGBufferShader();
-    static ShaderProgram PBRForwardShader();
+    // 메쉬를 그리는 셰이더는 Mesh::GetVertexType() 으로 정점 타입별 퍼뮤테이션을 선택 (Vertex3, Vertex3Compact, Vertex3Quantized)
+    static ShaderProgram PBRGBufferShader(eVertexType _vertexType = eVertexType::Vertex3);
+    static ShaderProgram PBRForwardShader(eVertexType _vertexType = eVertexType::Vertex3);
     static ShaderProgram PBRLightingShader();
     static ShaderProgram LightVolumeShader();
     static ShaderProgram SkyboxShader();
@@ -35,9 +36,9 @@ public:
     static ShaderProgram FXAAFilterQuality4Shader();
     static ShaderProgram FXAAFilterQuality5Shader();
 
-    static ShaderProgram CascadeShadowMappingShader();
-    static ShaderProgram OmniShadowMappingShader();
-    static ShaderProgram ShadowMappingShader();
+    static ShaderProgram CascadeShadowMappingShader(eVertexType _vertexType = eVertexType::Vertex3);
+    static ShaderProgram OmniShadowMappingShader(eVertexType _vertexType = eVertexType::Vertex3);
+    static ShaderProgram ShadowMappingShader(eVertexType _vertexType = eVertexType::Vertex3);
 
     static ShaderProgram SSAOBlurHorizontalShader();
     static ShaderProgram SSAOBlurVerticalShader();
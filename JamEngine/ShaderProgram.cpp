@@ -58,6 +58,19 @@ void ShaderProgram::Initialize(ID3DBlob* _pVScodeOrNull, ID3DBlob* _pPScodeOrNul
     }
 }
 
+void ShaderProgram::Initialize(const eVertexType _vertexType, ID3DBlob* _pVScode, ID3DBlob* _pPScodeOrNull, ID3DBlob* _pGScodeOrNull)
+{
+    JAM_ASSERT(_pVScode, "Vertex shader is required to create the input layout of a vertex type");
+    Initialize(nullptr, _pPScodeOrNull, _pGScodeOrNull);
+
+    ShaderCreateInfo data;
+    data.pBytecode      = _pVScode->GetBufferPointer();
+    data.bytecodeLength = _pVScode->GetBufferSize();
+
+    Renderer::CreateVertexShader(data, m_pVertexShader.GetAddressOf());
+    CreateInputLayout_(_pVScode, GetVertexInputElements(_vertexType));   // 정점 타입의 실제 오프셋으로 인풋 레이아웃 생성
+}
+
 void ShaderProgram::Bind() const
 {
     Renderer::BindInputLayout(m_pInputLayout.Get());
@@ -152,10 +165,15 @@ void ShaderProgram::CreateInputLayout_(ID3DBlob* _pVSCode)
         elems.emplace_back(elementDesc);
     }
 
+    CreateInputLayout_(_pVSCode, elems);
+}
+
+void ShaderProgram::CreateInputLayout_(ID3DBlob* _pVSCode, const std::span<const D3D11_INPUT_ELEMENT_DESC> _elements)
+{
     // input layouy 생성
     ID3D11Device* pDevice = Renderer::GetDevice();
-    hr                    = pDevice->CreateInputLayout(elems.data(),
-                                    static_cast<UINT>(elems.size()),
+    HRESULT       hr      = pDevice->CreateInputLayout(_elements.data(),
+                                    static_cast<UINT>(_elements.size()),
                                     _pVSCode->GetBufferPointer(),
                                     _pVSCode->GetBufferSize(),
                                     m_pInputLayout.GetAddressOf());
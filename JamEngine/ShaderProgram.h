@@ -1,4 +1,5 @@
 #pragma once
+#include "Vertex.h"
 
 namespace jam
 {
@@ -12,6 +13,13 @@ public:
                     ID3DBlob* _pHScodeOrNull = nullptr,
                     ID3DBlob* _pDScodeOrNull = nullptr);
 
+    // 인풋 레이아웃을 VS 리플렉션 대신 정점 타입의 레이아웃 (GetVertexInputElements) 으로 생성
+    // 압축 정점처럼 셰이더 입력 순서와 버퍼 오프셋이 다른 정점 타입에 사용
+    void Initialize(eVertexType _vertexType,
+                    ID3DBlob*   _pVScode,
+                    ID3DBlob*   _pPScodeOrNull = nullptr,
+                    ID3DBlob*   _pGScodeOrNull = nullptr);
+
     void Bind() const;
 
     // accessor
@@ -24,6 +32,7 @@ public:
 
 private:
     void CreateInputLayout_(ID3DBlob* _pVSCode);
+    void CreateInputLayout_(ID3DBlob* _pVSCode, std::span<const D3D11_INPUT_ELEMENT_DESC> _elements);
 
     ComPtr<ID3D11InputLayout>    m_pInputLayout;
     ComPtr<ID3D11VertexShader>   m_pVertexShader;
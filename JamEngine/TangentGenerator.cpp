@@ -0,0 +1,230 @@
+#include "pch.h"
+
+#include "TangentGenerator.h"
+
+#include "ThreadPool.h"
+
+namespace
+{
+
+using namespace jam;
+
+constexpr UInt32 k_unassigned = std::numeric_limits<UInt32>::max();
+
+// 삼각형 단위 탄젠트 공간 (모델 공간, 정규화됨)
+struct TriangleTangentSpace
+{
+    Vec3  tangent     = Vec3::Zero;   // dP/du
+    Vec3  bitangent   = Vec3::Zero;   // dP/dv
+    float angles[3]   = {};           // 모서리 각도 (가중치)
+    Int8  orientation = 0;            // UV 방향 (+1, -1), 0 이라면 퇴화 삼각형
+};
+
+// 정점 -> 모서리 (인덱스 버퍼 위치) 목록 (CSR, 모서리 순서 유지)
+struct CornerAdjacency
+{
+    std::vector<UInt32> offsets;   // 정점별 시작 위치 (vertexCount + 1)
+    std::vector<UInt32> corners;
+};
+
+NODISCARD CornerAdjacency BuildCornerAdjacency(const std::span<const Index> _indices, const UInt32 _vertexCount)
+{
+    CornerAdjacency adjacency;
+    adjacency.offsets.assign(_vertexCount + 1, 0);
+    for (const Index index: _indices)
+    {
+        ++adjacency.offsets[index + 1];
+    }
+    for (UInt32 i = 0; i < _vertexCount; ++i)
+    {
+        adjacency.offsets[i + 1] += adjacency.offsets[i];
+    }
+
+    std::vector<UInt32> cursors(adjacency.offsets.begin(), adjacency.offsets.end() - 1);
+    adjacency.corners.resize(_indices.size());
+    for (size_t i = 0; i < _indices.size(); ++i)
+    {
+        adjacency.corners[cursors[_indices[i]]++] = static_cast<UInt32>(i);
+    }
+    return adjacency;
+}
+
+NODISCARD float ComputeCornerAngle(const Vec3& _corner, const Vec3& _a, const Vec3& _b)
+{
+    Vec3 edgeA = _a - _corner;
+    Vec3 edgeB = _b - _corner;
+    edgeA.Normalize();
+    edgeB.Normalize();
+    return std::acos(std::clamp(edgeA.Dot(edgeB), -1.f, 1.f));
+}
+
+NODISCARD TriangleTangentSpace ComputeTriangleTangentSpace(const VertexAttribute& _v0, const VertexAttribute& _v1, const VertexAttribute& _v2)
+{
+    TriangleTangentSpace space;
+
+    const Vec3  edge1 = _v1.position - _v0.position;
+    const Vec3  edge2 = _v2.position - _v0.position;
+    const Vec2  uv1   = _v1.uv0 - _v0.uv0;
+    const Vec2  uv2   = _v2.uv0 - _v0.uv0;
+    const float det   = uv1.x * uv2.y - uv2.x * uv1.y;
+    if (std::abs(det) <= std::numeric_limits<float>::min() || edge1.Cross(edge2).LengthSquared() <= 0.f)
+    {
+        return space;
+    }
+
+    // 부호는 orientation 으로 따로 보관하므로 방향만 사용
+    space.tangent   = (edge1 * uv2.y - edge2 * uv1.y) / det;
+    space.bitangent = (edge2 * uv1.x - edge1 * uv2.x) / det;
+    if (space.tangent.LengthSquared() <= 0.f || space.bitangent.LengthSquared() <= 0.f)
+    {
+        return TriangleTangentSpace();
+    }
+    space.tangent.Normalize();
+    space.bitangent.Normalize();
+
+    space.angles[0]   = ComputeCornerAngle(_v0.position, _v1.position, _v2.position);
+    space.angles[1]   = ComputeCornerAngle(_v1.position, _v2.position, _v0.position);
+    space.angles[2]   = ComputeCornerAngle(_v2.position, _v0.position, _v1.position);
+    space.orientation = det > 0.f ? 1 : -1;
+    return space;
+}
+
+// _normal 에 수직인 단위 벡터로 투영 (평행하다면 0)
+NODISCARD Vec3 ProjectOnPlane(const Vec3& _vector, const Vec3& _normal)
+{
+    Vec3 projected = _vector - _normal * _normal.Dot(_vector);
+    if (projected.LengthSquared() <= std::numeric_limits<float>::min())
+    {
+        return Vec3::Zero;
+    }
+    projected.Normalize();
+    return projected;
+}
+
+// 탄젠트를 정할 수 없는 정점은 법선에 수직인 임의의 축을 사용
+NODISCARD Vec3 CreateFallbackTangent(const Vec3& _normal)
+{
+    const Vec3 axis = std::abs(_normal.x) < 0.9f ? Vec3::UnitX : Vec3::UnitY;
+    return ProjectOnPlane(axis, _normal);
+}
+
+template<typename Func>
+void ParallelForBatches(const UInt32 _count, const UInt32 _batchSize, Func&& _func)
+{
+    const UInt32 batchSize  = std::max(_batchSize, 1u);
+    const UInt32 batchCount = (_count + batchSize - 1) / batchSize;
+    ThreadPool::GetGlobal().ParallelFor(batchCount, [&](const UInt32 _batch) {
+        const UInt32 begin = _batch * batchSize;
+        const UInt32 end   = std::min(begin + batchSize, _count);
+        for (UInt32 i = begin; i < end; ++i)
+        {
+            _func(i);
+        }
+    });
+}
+
+}   // namespace
+
+namespace jam
+{
+
+TangentGenerateReport GenerateTangents(MeshData& _meshData, const TangentGenerateDesc& _desc)
+{
+    JAM_ASSERT(_meshData.indices.size() % 3 == 0, "GenerateTangents() - Triangle list is required");
+
+    TangentGenerateReport         report;
+    std::vector<VertexAttribute>& vertices      = _meshData.vertices;
+    std::vector<Index>&           indices       = _meshData.indices;
+    const UInt32                  triangleCount = static_cast<UInt32>(indices.size() / 3);
+
+    // 1. 삼각형 단위 탄젠트 공간
+    std::vector<TriangleTangentSpace> triangles(triangleCount);
+    ParallelForBatches(triangleCount, _desc.batchSize, [&](const UInt32 _triangle) {
+        const Index* pIndices = indices.data() + _triangle * 3;
+        triangles[_triangle]  = ComputeTriangleTangentSpace(vertices[pIndices[0]], vertices[pIndices[1]], vertices[pIndices[2]]);
+    });
+
+    // 2. 미러링 경계의 정점 복제 - 인덱스 순서대로 처음 만난 삼각형의 방향이 정점의 방향
+    if (_desc.bSplitMirroredVertices)
+    {
+        const UInt32        sourceVertexCount = static_cast<UInt32>(vertices.size());
+        std::vector<Int8>   orientations(sourceVertexCount, 0);
+        std::vector<UInt32> mirrors(sourceVertexCount, k_unassigned);
+        for (UInt32 triangle = 0; triangle < triangleCount; ++triangle)
+        {
+            const Int8 orientation = triangles[triangle].orientation;
+            if (orientation == 0)
+            {
+                ++report.degenerateTriangleCount;
+                continue;
+            }
+
+            for (UInt32 corner = triangle * 3; corner < triangle * 3 + 3; ++corner)
+            {
+                const Index vertex = indices[corner];
+                if (orientations[vertex] == 0)
+                {
+                    orientations[vertex] = orientation;
+                }
+                else if (orientations[vertex] != orientation)
+                {
+                    if (mirrors[vertex] == k_unassigned)
+                    {
+                        mirrors[vertex] = static_cast<UInt32>(vertices.size());
+                        vertices.push_back(vertices[vertex]);
+                        orientations.push_back(orientation);
+                    }
+                    indices[corner] = mirrors[vertex];
+                }
+            }
+        }
+        report.splitVertexCount = static_cast<UInt32>(vertices.size()) - sourceVertexCount;
+    }
+    else
+    {
+        report.degenerateTriangleCount = static_cast<UInt32>(std::ranges::count(triangles, Int8(0), &TriangleTangentSpace::orientation));
+    }
+
+    // 3. 정점 단위 합산 (모서리는 인덱스 순서로 합산되므로 결정적)
+    const UInt32          vertexCount = static_cast<UInt32>(vertices.size());
+    const CornerAdjacency adjacency   = BuildCornerAdjacency(indices, vertexCount);
+    std::vector<UInt8>    bFallbacks(vertexCount, 0);
+    ParallelForBatches(vertexCount, _desc.batchSize, [&](const UInt32 _vertex) {
+        VertexAttribute& vertex = vertices[_vertex];
+        Vec3             normal = vertex.normal;
+        normal.Normalize();
+
+        Vec3 tangentSum   = Vec3::Zero;
+        Vec3 bitangentSum = Vec3::Zero;
+        for (UInt32 i = adjacency.offsets[_vertex]; i < adjacency.offsets[_vertex + 1]; ++i)
+        {
+            const UInt32                corner = adjacency.corners[i];
+            const TriangleTangentSpace& space  = triangles[corner / 3];
+            if (space.orientation == 0)
+            {
+                continue;
+            }
+
+            const float weight = space.angles[corner % 3];
+            tangentSum += ProjectOnPlane(space.tangent, normal) * weight;
+            bitangentSum += ProjectOnPlane(space.bitangent, normal) * weight;
+        }
+
+        // 그람-슈미트 직교화
+        Vec3 tangent = ProjectOnPlane(tangentSum, normal);
+        if (tangent == Vec3::Zero)
+        {
+            tangent             = CreateFallbackTangent(normal);
+            bFallbacks[_vertex] = 1;
+        }
+
+        const Vec3  crossed = normal.Cross(tangent);
+        const float sign    = crossed.Dot(bitangentSum) < 0.f ? -1.f : 1.f;
+        vertex.tangent      = tangent;
+        vertex.bitangent    = crossed * sign;
+    });
+    report.fallbackVertexCount = static_cast<UInt32>(std::ranges::count(bFallbacks, UInt8(1)));
+    return report;
+}
+
+}   // namespace jam
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+#include "Mesh.h"
+
+namespace jam
+{
+
+// MikkTSpace 방식의 탄젠트 공간 생성 (삼각형 리스트 전용)
+// 1. 삼각형마다 UV 미분으로 탄젠트/종법선 방향과 UV 방향(미러링 여부)을 계산
+// 2. UV 방향이 다른 삼각형이 공유하는 정점은 복제 (미러링된 UV 의 경계)
+// 3. 정점마다 법선 평면에 투영한 삼각형 탄젠트를 모서리 각도로 가중 합산 후 그람-슈미트 직교화
+// 정점 단위 합산은 인덱스 순서대로 이루어지므로 결과는 스레드 수와 무관하게 동일함
+// 법선과 uv0 가 채워져 있어야 하며 bitangent 는 sign * cross(normal, tangent) 로 기록됨
+// GPU 정점에는 sign 만 저장됨 (Vertex3 탄젠트의 w, 압축 타입은 옥타헤드럴 탄젠트의 부호 비트)
+
+struct TangentGenerateDesc
+{
+    UInt32 batchSize              = 4096;   // 병렬 처리 단위 (삼각형 / 정점 수)
+    bool   bSplitMirroredVertices = true;   // false 라면 정점을 복제하지 않고 다수의 방향을 따름
+};
+
+struct TangentGenerateReport
+{
+    UInt32 splitVertexCount        = 0;   // 미러링 경계에서 복제된 정점 수
+    UInt32 degenerateTriangleCount = 0;   // UV 또는 위치가 퇴화되어 기여하지 않은 삼각형 수
+    UInt32 fallbackVertexCount     = 0;   // 기여한 삼각형이 없어 법선으로부터 임의의 기저를 만든 정점 수
+};
+
+TangentGenerateReport GenerateTangents(MeshData& _meshData, const TangentGenerateDesc& _desc = TangentGenerateDesc());
+
+}   // namespace jam
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include "TextureAsset.h"
 
+#include "ImageUtilities.h"
+
 namespace jam
 {
 
@@ -28,6 +30,41 @@ bool TextureAsset::Load(MAYBE_UNUSED AssetManager& _assetMgrRef, const fs::path&
     return true;
 }
 
+bool TextureAsset::PrepareLoad(const fs::path& _path, const AssetFile& _file)
+{
+    // WIC 는 스레드마다 COM 초기화가 필요함. 워커 스레드는 COM 을 쓰는 다른 코드가 없으므로 MTA 로 초기화
+    MAYBE_UNUSED thread_local const HRESULT s_comResult = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+    // 형식은 키 경로의 확장자로 판별 (팩 항목은 디스크에 파일이 없으므로 항상 읽은 바이트에서 디코딩)
+    const eImageFormat format = GetImageFormatFromPath(_path);
+    m_pPendingImage           = MakeScope<TextureImage>();
+
+    if (!Texture2D::DecodeFromMemory(_file.GetData(), format, *m_pPendingImage))
+    {
+        JAM_ERROR("Failed to decode texture from file: {}", _path.string());
+        m_pPendingImage.reset();
+        return false;
+    }
+    return true;
+}
+
+bool TextureAsset::FinalizeLoad(MAYBE_UNUSED AssetManager& _assetMgrRef, const fs::path& _path)
+{
+    JAM_ASSERT(m_pPendingImage, "TextureAsset::FinalizeLoad() - PrepareLoad() must succeed first");
+
+    const bool bResult = m_texture.LoadFromImage(std::move(*m_pPendingImage));
+    m_pPendingImage.reset();
+    if (!bResult)
+    {
+        JAM_ERROR("Failed to create texture from file: {}", _path.string());
+        return false;
+    }
+
+    m_texture.AttachSRV();
+    m_path = _path;
+    return true;
+}
+
 void TextureAsset::Unload()
 {
     m_texture.Reset();
@@ -38,4 +75,9 @@ eAssetType TextureAsset::GetType() const
     return s_type;
 }
 
+UInt64 TextureAsset::GetResidentByteSize() const
+{
+    return m_texture.GetByteSize();
+}
+
 }   // namespace jam
\ No newline at end of file
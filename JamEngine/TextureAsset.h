@@ -21,7 +21,11 @@ public:
     bool Save(const fs::path& _path) const override;
     void Unload() override;
 
+    bool PrepareLoad(const fs::path& _path, const AssetFile& _file) override;        // 워커 스레드: 이미지 디코딩
+    bool FinalizeLoad(AssetManager& _assetMgrRef, const fs::path& _path) override;   // 메인 스레드: 텍스처 생성
+
     NODISCARD eAssetType       GetType() const override;
+    NODISCARD UInt64           GetResidentByteSize() const override;
     NODISCARD const Texture2D& GetTexture() const { return m_texture; }
 
     void BindAsShaderResource(const eShader _shader, const UInt32 _slot) const { m_texture.BindAsShaderResource(_shader, _slot); }
@@ -29,7 +33,8 @@ public:
     constexpr static eAssetType s_type = eAssetType::Texture;
 
 private:
-    Texture2D m_texture;
+    Texture2D           m_texture;
+    Scope<TextureImage> m_pPendingImage;   // PrepareLoad 에서 디코딩된 이미지 (FinalizeLoad 에서 해제)
 };
 
 }   // namespace jam
\ No newline at end of file
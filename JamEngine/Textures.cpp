@@ -10,7 +10,9 @@
 #include <DirectXTex.h>
 #include <DirectXTex.inl>
 #include <DirectXTexEXR.h>
+#include <tinyexr.h>
 #pragma comment(lib, "DirectXTex.lib")
+#pragma comment(lib, "tinyexr.lib")
 
 namespace
 {
@@ -30,6 +32,38 @@ DirectX::WICCodecs GetWICCodecsFromImageFormat(const jam::eImageFormat _format)
     }
 }
 
+// DirectXTexEXR 은 파일 디코더만 있으므로 tinyexr 로 디코딩 (팩 항목처럼 파일 경로가 없는 데이터)
+// LoadFromEXRFile 과 같은 R16G16B16A16_FLOAT 로 변환
+HRESULT LoadFromEXRMemory(const std::span<const jam::UInt8> _data, DirectX::TexMetadata* _pMetadata, DirectX::ScratchImage& _out_image)
+{
+    float*      pRGBA  = nullptr;
+    int         width  = 0;
+    int         height = 0;
+    const char* pError = nullptr;
+    if (LoadEXRFromMemory(&pRGBA, &width, &height, _data.data(), _data.size(), &pError) != TINYEXR_SUCCESS)
+    {
+        JAM_ERROR("Failed to decode EXR from memory: {}", pError ? pError : "unknown error");
+        FreeEXRErrorMessage(pError);
+        return E_FAIL;
+    }
+
+    DirectX::Image image;
+    image.width      = static_cast<size_t>(width);
+    image.height     = static_cast<size_t>(height);
+    image.format     = DXGI_FORMAT_R32G32B32A32_FLOAT;
+    image.rowPitch   = image.width * sizeof(float) * 4;
+    image.slicePitch = image.rowPitch * image.height;
+    image.pixels     = reinterpret_cast<uint8_t*>(pRGBA);
+
+    const HRESULT hr = DirectX::Convert(image, DXGI_FORMAT_R16G16B16A16_FLOAT, DirectX::TEX_FILTER_DEFAULT, DirectX::TEX_THRESHOLD_DEFAULT, _out_image);
+    std::free(pRGBA);   // tinyexr 는 malloc 으로 할당
+    if (SUCCEEDED(hr) && _pMetadata)
+    {
+        *_pMetadata = _out_image.GetMetadata();
+    }
+    return hr;
+}
+
 }   // namespace
 
 namespace jam
@@ -187,9 +221,20 @@ void Texture2D::SetMemberFieldFromDesc(const D3D11_TEXTURE2D_DESC& _desc)
 
 bool Texture2D::LoadFromFile(const fs::path& _filePath, const eResourceAccess _access, const eViewFlags _viewFlags, const bool _bGenrateMips, const bool _bInverseGamma, const bool _bCubeMap)
 {
-    DirectX::TexMetadata  metadata;
-    DirectX::ScratchImage scratchImage;
-    HRESULT               hr;
+    TextureImage image;
+    if (!DecodeFromFile(_filePath, image))
+    {
+        return false;
+    }
+
+    return LoadFromImage(std::move(image), _access, _viewFlags, _bGenrateMips, _bInverseGamma, _bCubeMap);
+}
+
+bool Texture2D::DecodeFromFile(const fs::path& _filePath, TextureImage& _out_image)
+{
+    DirectX::TexMetadata&  metadata     = _out_image.metadata;
+    DirectX::ScratchImage& scratchImage = _out_image.scratchImage;
+    HRESULT                hr;
 
     eImageFormat format = GetImageFormatFromPath(_filePath);
     switch (format)
@@ -227,35 +272,42 @@ bool Texture2D::LoadFromFile(const fs::path& _filePath, const eResourceAccess _a
         return false;
     }
 
-    return InitializeFromImage_(std::move(scratchImage), std::move(metadata), _access, _viewFlags, _bGenrateMips, _bInverseGamma, _bCubeMap);
+    return true;
 }
 
-bool Texture2D::LoadFromMemory(const UInt8* _pData, const size_t _dataSize, const eImageFormat _imageFormat, const eResourceAccess _access, const eViewFlags _viewFlags, const bool _bGenerateMips, const bool _bInverseGamma, const bool _bCubemap)
+bool Texture2D::LoadFromImage(TextureImage&& _image, const eResourceAccess _access, const eViewFlags _viewFlags, const bool _bGenerateMips, const bool _bInverseGamma, const bool _bCubemap)
 {
-    JAM_ASSERT(_pData, "Texture2D::LoadFromMemory: Data pointer is s_null.");
+    return InitializeFromImage_(std::move(_image.scratchImage), std::move(_image.metadata), _access, _viewFlags, _bGenerateMips, _bInverseGamma, _bCubemap);
+}
 
-    DirectX::ScratchImage scratchImage;
-    DirectX::TexMetadata  metadata;
-    HRESULT               hr;
+bool Texture2D::DecodeFromMemory(const std::span<const UInt8> _data, const eImageFormat _imageFormat, TextureImage& _out_image)
+{
+    DirectX::TexMetadata&  metadata     = _out_image.metadata;
+    DirectX::ScratchImage& scratchImage = _out_image.scratchImage;
+    HRESULT                hr;
 
     switch (_imageFormat)
     {
         case eImageFormat::HDR:
-            hr = DirectX::LoadFromHDRMemory(_pData, _dataSize, &metadata, scratchImage);
+            hr = DirectX::LoadFromHDRMemory(_data.data(), _data.size(), &metadata, scratchImage);
             break;
 
         case eImageFormat::TGA:
-            hr = DirectX::LoadFromTGAMemory(_pData, _dataSize, &metadata, scratchImage);
+            hr = DirectX::LoadFromTGAMemory(_data.data(), _data.size(), &metadata, scratchImage);
+            break;
+
+        case eImageFormat::EXR:
+            hr = LoadFromEXRMemory(_data, &metadata, scratchImage);
             break;
 
         case eImageFormat::DDS:
-            hr = DirectX::LoadFromDDSMemory(_pData, _dataSize, DirectX::DDS_FLAGS_NONE, &metadata, scratchImage);
+            hr = DirectX::LoadFromDDSMemory(_data.data(), _data.size(), DirectX::DDS_FLAGS_NONE, &metadata, scratchImage);
             break;
 
         default:
             if (IsWICFormat(_imageFormat))
             {
-                hr = DirectX::LoadFromWICMemory(_pData, _dataSize, DirectX::WIC_FLAGS_NONE, &metadata, scratchImage);
+                hr = DirectX::LoadFromWICMemory(_data.data(), _data.size(), DirectX::WIC_FLAGS_NONE, &metadata, scratchImage);
             }
             else
             {
@@ -269,7 +321,20 @@ bool Texture2D::LoadFromMemory(const UInt8* _pData, const size_t _dataSize, cons
         return false;
     }
 
-    return InitializeFromImage_(std::move(scratchImage), std::move(metadata), _access, _viewFlags, _bGenerateMips, _bInverseGamma, _bCubemap);
+    return true;
+}
+
+bool Texture2D::LoadFromMemory(const UInt8* _pData, const size_t _dataSize, const eImageFormat _imageFormat, const eResourceAccess _access, const eViewFlags _viewFlags, const bool _bGenerateMips, const bool _bInverseGamma, const bool _bCubemap)
+{
+    JAM_ASSERT(_pData, "Texture2D::LoadFromMemory: Data pointer is s_null.");
+
+    TextureImage image;
+    if (!DecodeFromMemory({ _pData, _dataSize }, _imageFormat, image))
+    {
+        return false;
+    }
+
+    return LoadFromImage(std::move(image), _access, _viewFlags, _bGenerateMips, _bInverseGamma, _bCubemap);
 }
 
 bool Texture2D::SaveToFile(const fs::path& _filePath) const
@@ -599,6 +664,31 @@ UInt32 Texture2D::Reset()
     return refCount;
 }
 
+UInt64 Texture2D::GetByteSize() const
+{
+    if (!m_pTexture)
+    {
+        return 0;
+    }
+
+    D3D11_TEXTURE2D_DESC desc = {};
+    m_pTexture->GetDesc(&desc);
+
+    UInt64 byteSize = 0;
+    for (UInt32 mip = 0; mip < desc.MipLevels; ++mip)
+    {
+        size_t  rowPitch   = 0;
+        size_t  slicePitch = 0;
+        HRESULT hr         = DirectX::ComputePitch(desc.Format, std::max(desc.Width >> mip, 1u), std::max(desc.Height >> mip, 1u), rowPitch, slicePitch);
+        if (FAILED(hr))
+        {
+            break;
+        }
+        byteSize += slicePitch;
+    }
+    return byteSize * desc.ArraySize * desc.SampleDesc.Count;
+}
+
 ID3D11ShaderResourceView* Texture2D::GetSRV() const
 {
     JAM_ASSERT(m_pSRV, "Shader Resource View is not attached to this texture.");
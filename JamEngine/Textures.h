@@ -15,6 +15,13 @@ enum eViewFlags_ : Int32
 };
 using eViewFlags = std::underlying_type_t<eViewFlags_>;
 
+// GPU 리소스를 만들기 전의 디코딩된 이미지
+struct TextureImage
+{
+    DirectX::ScratchImage scratchImage;
+    DirectX::TexMetadata  metadata = {};
+};
+
 class Texture2D
 {
 public:
@@ -41,6 +48,16 @@ public:
                       bool            _bInverseGamma = false,
                       bool            _bCubeMap      = false);
 
+    // 디코딩과 GPU 리소스 생성을 나누어 처리 (디코딩은 GPU 에 접근하지 않으므로 워커 스레드에서 호출할 수 있음)
+    NODISCARD static bool DecodeFromFile(const fs::path& _filePath, TextureImage& _out_image);
+    NODISCARD static bool DecodeFromMemory(std::span<const UInt8> _data, eImageFormat _imageFormat, TextureImage& _out_image);
+    bool                  LoadFromImage(TextureImage&&  _image,
+                                        eResourceAccess _access        = eResourceAccess::Immutable,
+                                        eViewFlags      _viewFlags     = eViewFlags_ShaderResource,
+                                        bool            _bGenerateMips = false,
+                                        bool            _bInverseGamma = false,
+                                        bool            _bCubemap      = false);
+
     bool LoadFromMemory(const UInt8*    _pData,
                         size_t          _dataSize,
                         eImageFormat    _imageFormat,
@@ -92,6 +109,7 @@ public:
     NODISCARD UInt32                    GetArraySize() const { return m_arraySize; }
     NODISCARD UInt32                    GetSampleCount() const { return m_samples; }
     NODISCARD DXGI_FORMAT               GetFormat() const { return m_format; }
+    NODISCARD UInt64                    GetByteSize() const;   // 모든 밉 / 배열 / 샘플을 포함한 GPU 메모리 크기 (추정치)
 
     // d3d11 accessors
     NODISCARD ID3D11Texture2D*          Get() const { return m_pTexture.Get(); }
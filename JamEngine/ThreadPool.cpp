@@ -0,0 +1,145 @@
+#include "pch.h"
+
+#include "ThreadPool.h"
+
+namespace jam
+{
+
+ThreadPool::ThreadPool(UInt32 _threadCount)
+{
+    if (_threadCount == 0)
+    {
+        const UInt32 hardwareThreads = std::thread::hardware_concurrency();
+        _threadCount                 = hardwareThreads > 1 ? hardwareThreads - 1 : 1;   // 메인 스레드 몫을 남겨둠
+    }
+
+    m_workers.reserve(_threadCount);
+    for (UInt32 i = 0; i < _threadCount; ++i)
+    {
+        m_workers.emplace_back(&ThreadPool::WorkerLoop_, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_bStop = true;
+    }
+    m_condition.notify_all();
+
+    for (std::thread& worker: m_workers)
+    {
+        worker.join();
+    }
+}
+
+void ThreadPool::ParallelFor(const UInt32 _count, const std::function<void(UInt32)>& _job)
+{
+    if (_count == 0)
+    {
+        return;
+    }
+
+    if (_count == 1 || m_workers.empty())   // 병렬화할 필요가 없음
+    {
+        for (UInt32 i = 0; i < _count; ++i)
+        {
+            _job(i);
+        }
+        return;
+    }
+
+    // 헬퍼 작업은 호출이 끝난 뒤에 실행될 수도 있으므로 상태는 공유 포인터로 관리
+    struct ParallelForState
+    {
+        std::function<void(UInt32)> job;
+        std::atomic<UInt32>         next      = 0;
+        std::atomic<UInt32>         completed = 0;
+        UInt32                      count     = 0;
+        std::mutex                  mutex;
+        std::condition_variable     condition;
+    };
+
+    auto pState   = std::make_shared<ParallelForState>();
+    pState->job   = _job;
+    pState->count = _count;
+
+    auto drain = [](ParallelForState& _state)
+    {
+        UInt32 index;
+        while ((index = _state.next.fetch_add(1)) < _state.count)
+        {
+            _state.job(index);
+            if (_state.completed.fetch_add(1) + 1 == _state.count)   // 마지막 작업
+            {
+                std::lock_guard<std::mutex> lock(_state.mutex);
+                _state.condition.notify_all();
+            }
+        }
+    };
+
+    const UInt32 helperCount = std::min(_count - 1, GetThreadCount());
+    for (UInt32 i = 0; i < helperCount; ++i)
+    {
+        Enqueue_(
+            [pState, drain]
+            {
+                drain(*pState);
+            });
+    }
+
+    // 호출 스레드도 참여
+    drain(*pState);
+
+    // 다른 스레드가 처리중인 작업 대기
+    std::unique_lock<std::mutex> lock(pState->mutex);
+    pState->condition.wait(lock,
+                           [&pState]
+                           {
+                               return pState->completed.load() == pState->count;
+                           });
+}
+
+ThreadPool& ThreadPool::GetGlobal()
+{
+    static ThreadPool s_globalPool;
+    return s_globalPool;
+}
+
+void ThreadPool::Enqueue_(std::function<void()>&& _job)
+{
+    JAM_ASSERT(_job, "Job cannot be null");
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_jobs.emplace_back(std::move(_job));
+    }
+    m_condition.notify_one();
+}
+
+void ThreadPool::WorkerLoop_()
+{
+    while (true)
+    {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock,
+                             [this]
+                             {
+                                 return m_bStop || !m_jobs.empty();
+                             });
+
+            if (m_bStop && m_jobs.empty())
+            {
+                return;
+            }
+
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+        job();
+    }
+}
+
+}   // namespace jam
\ No newline at end of file
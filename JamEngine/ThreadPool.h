@@ -0,0 +1,60 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <thread>
+
+namespace jam
+{
+
+// 범용 워커 스레드 풀
+// 엔진 전역에서 공유하는 풀은 GetGlobal() 로 접근합니다. (첫 호출 시 생성)
+class ThreadPool
+{
+public:
+    explicit ThreadPool(UInt32 _threadCount = 0);   // 0 이면 (하드웨어 스레드 수 - 1)
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&)                = delete;
+    ThreadPool& operator=(const ThreadPool&)     = delete;
+    ThreadPool(ThreadPool&&) noexcept            = delete;
+    ThreadPool& operator=(ThreadPool&&) noexcept = delete;
+
+    // 작업을 큐에 넣고 결과를 future 로 반환합니다. 해당 함수는 thread-safe 합니다
+    template<typename F>
+    auto Submit(F&& _job) -> std::future<std::invoke_result_t<std::decay_t<F>>>
+    {
+        using ReturnType = std::invoke_result_t<std::decay_t<F>>;
+
+        auto pTask   = std::make_shared<std::packaged_task<ReturnType()>>(std::forward<F>(_job));
+        auto pFuture = pTask->get_future();
+        Enqueue_(
+            [pTask]
+            {
+                (*pTask)();
+            });
+        return pFuture;
+    }
+
+    // [0, _count) 구간을 병렬로 처리하고 모두 끝날 때까지 대기합니다.
+    // 호출한 스레드도 작업에 참여하므로 워커 스레드 안에서 호출해도 교착되지 않습니다.
+    // 각 인덱스의 결과를 인덱스 위치에 기록하면 출력 순서는 스레드 수와 무관하게 결정적입니다.
+    void ParallelFor(UInt32 _count, const std::function<void(UInt32)>& _job);
+
+    NODISCARD UInt32 GetThreadCount() const { return static_cast<UInt32>(m_workers.size()); }
+
+    NODISCARD static ThreadPool& GetGlobal();
+
+private:
+    void Enqueue_(std::function<void()>&& _job);
+    void WorkerLoop_();
+
+    std::vector<std::thread>          m_workers;
+    std::deque<std::function<void()>> m_jobs;
+    std::mutex                        m_mutex;
+    std::condition_variable           m_condition;
+    bool                              m_bStop = false;
+};
+
+}   // namespace jam
\ No newline at end of file
@@ -2,96 +2,209 @@
 
 #include "Vertex.h"
 
+#include "VertexLayout.h"
+
+#include <DirectXPackedVector.h>
+
+namespace
+{
+
+using namespace jam;
+
+NODISCARD UInt32 QuantizeSnorm16(const float _value)
+{
+    const float rounded = std::round(std::clamp(_value, -1.f, 1.f) * 32767.f);
+    return static_cast<UInt16>(static_cast<Int16>(rounded));
+}
+
+NODISCARD float DequantizeSnorm16(const UInt32 _value)
+{
+    return std::max(static_cast<float>(static_cast<Int16>(static_cast<UInt16>(_value))) / 32767.f, -1.f);
+}
+
+// VertexLayouts 에서 만든 타입별 디스패치 테이블
+struct VertexLayoutEntry
+{
+    UInt32                                    stride;
+    std::span<const VertexElementDesc>        elements;
+    std::span<const D3D11_INPUT_ELEMENT_DESC> inputElements;
+    void (*pack)(std::span<const VertexAttribute>, void*, const VertexQuantization&);
+    void (*unpack)(const void*, std::span<VertexAttribute>, const VertexQuantization&);
+};
+
+template<typename Layout>
+constexpr VertexLayoutEntry MakeVertexLayoutEntry()
+{
+    return { Layout::k_stride, Layout::k_elements, Layout::k_inputElements, &Layout::Pack, &Layout::Unpack };
+}
+
+template<typename... Layouts>
+constexpr std::array<VertexLayoutEntry, sizeof...(Layouts)> MakeVertexLayoutTable(std::tuple<Layouts...>*)
+{
+    return { MakeVertexLayoutEntry<Layouts>()... };
+}
+
+constexpr auto k_vertexLayouts = MakeVertexLayoutTable(static_cast<VertexLayouts*>(nullptr));
+static_assert(k_vertexLayouts.size() == EnumCount<eVertexType>(), "VertexLayouts must declare every eVertexType");
+
+NODISCARD const VertexLayoutEntry& GetVertexLayout(const eVertexType _type)
+{
+    JAM_ASSERT(IsValidEnum(_type), "Unknown vertex type");
+    return k_vertexLayouts[EnumToInt(_type)];
+}
+
+NODISCARD float AngleBetween(const Vec3& _a, const Vec3& _b)
+{
+    const float lengthSquare = _a.LengthSquared() * _b.LengthSquared();
+    if (lengthSquare <= 0.f)
+    {
+        return 0.f;
+    }
+    return std::acos(std::clamp(_a.Dot(_b) / std::sqrt(lengthSquare), -1.f, 1.f));
+}
+
+}   // namespace
+
 namespace jam
 {
 
+VertexQuantization VertexQuantization::FromBounds(const Vec3& _min, const Vec3& _max)
+{
+    // 축의 크기가 0 이면 모든 값이 0 으로 양자화되므로 배율은 1 로 둠
+    const Vec3 extent = _max - _min;
+
+    VertexQuantization quantization;
+    quantization.positionOffset = _min;
+    quantization.positionScale  = Vec3(extent.x > 0.f ? extent.x : 1.f, extent.y > 0.f ? extent.y : 1.f, extent.z > 0.f ? extent.z : 1.f);
+    return quantization;
+}
+
+Mat4 VertexQuantization::CreateDequantizeMatrix() const
+{
+    return Mat4::CreateScale(positionScale) * Mat4::CreateTranslation(positionOffset);
+}
+
 UInt32 GetVertexStride(const eVertexType _type)
 {
-    switch (_type)
-    {
-        case eVertexType::Vertex2:
-            return sizeof(Vertex2);
+    return GetVertexLayout(_type).stride;
+}
+
+void PackVertex(const VertexAttribute& _vertex, const eVertexType _type, void* _out_vertex, const VertexQuantization& _quantization)
+{
+    GetVertexLayout(_type).pack(std::span(&_vertex, 1), _out_vertex, _quantization);
+}
+
+void UnpackVertex(const eVertexType _type, const void* _in_vertex, VertexAttribute& _out_vertex, const VertexQuantization& _quantization)
+{
+    GetVertexLayout(_type).unpack(_in_vertex, std::span(&_out_vertex, 1), _quantization);
+}
 
-        case eVertexType::Vertex3:
-            return sizeof(Vertex3);
+void PackVertices(const std::span<const VertexAttribute> _vertices, const eVertexType _type, void* _out_vertices, const VertexQuantization& _quantization)
+{
+    GetVertexLayout(_type).pack(_vertices, _out_vertices, _quantization);
+}
 
-        case eVertexType::Vertex3PosOnly:
-            return sizeof(Vertex3PosOnly);
+void UnpackVertices(const eVertexType _type, const void* _in_vertices, const std::span<VertexAttribute> _out_vertices, const VertexQuantization& _quantization)
+{
+    GetVertexLayout(_type).unpack(_in_vertices, _out_vertices, _quantization);
+}
 
-        default:
-            JAM_ASSERT(false, "Unknown vertex type");
-            return 0;
-    }
+std::span<const VertexElementDesc> GetVertexElements(const eVertexType _type)
+{
+    return GetVertexLayout(_type).elements;
+}
+
+std::span<const D3D11_INPUT_ELEMENT_DESC> GetVertexInputElements(const eVertexType _type)
+{
+    return GetVertexLayout(_type).inputElements;
+}
+
+float GetTangentSign(const VertexAttribute& _vertex)
+{
+    // 종법선이 없다면 (0 벡터) 오른손 기저로 취급
+    return _vertex.normal.Cross(_vertex.tangent).Dot(_vertex.bitangent) < 0.f ? -1.f : 1.f;
+}
+
+bool IsQuantizedVertexType(const eVertexType _type)
+{
+    return _type == eVertexType::Vertex3Quantized;
 }
 
-void PackVertex(const VertexAttribute& _vertex, const eVertexType _type, void* _out_vertex)
+VertexQuantizationError MeasureQuantizationError(const std::span<const VertexAttribute> _vertices, const eVertexType _type, const VertexQuantization& _quantization)
 {
-    switch (_type)
+    std::vector<UInt8>           packed(_vertices.size() * GetVertexStride(_type));
+    std::vector<VertexAttribute> restored(_vertices.size());
+    PackVertices(_vertices, _type, packed.data(), _quantization);
+    UnpackVertices(_type, packed.data(), restored, _quantization);
+
+    VertexQuantizationError error;
+    for (size_t i = 0; i < _vertices.size(); ++i)
     {
-        case eVertexType::Vertex2:
-        {
-            Vertex2* vertex  = static_cast<Vertex2*>(_out_vertex);
-            vertex->position = ToVec2(_vertex.position);
-            vertex->uv0      = _vertex.uv0;
-        }
-        break;
-
-        case eVertexType::Vertex3:
-        {
-            Vertex3* vertex  = static_cast<Vertex3*>(_out_vertex);
-            vertex->position = _vertex.position;
-            vertex->uv0      = _vertex.uv0;
-            vertex->uv1      = _vertex.uv1;
-            vertex->normal   = _vertex.normal;
-            vertex->tangent  = _vertex.tangent;
-        }
-        break;
-
-        case eVertexType::Vertex3PosOnly:
-        {
-            Vertex3PosOnly* vertex = static_cast<Vertex3PosOnly*>(_out_vertex);
-            vertex->position       = _vertex.position;
-        }
-        break;
-
-        default:
-            JAM_ASSERT(false, "Unknown vertex type");
+        const VertexAttribute& vertex = _vertices[i];
+        error.position                = std::max(error.position, Vec3::Distance(vertex.position, restored[i].position));
+        error.normal                  = std::max(error.normal, AngleBetween(vertex.normal, restored[i].normal));
+        error.tangent                 = std::max(error.tangent, AngleBetween(vertex.tangent, restored[i].tangent));
+        error.uv                      = std::max({ error.uv, Vec2::Distance(vertex.uv0, restored[i].uv0), Vec2::Distance(vertex.uv1, restored[i].uv1) });
     }
+    return error;
 }
 
-void UnpackVertex(const eVertexType _type, const void* _in_vertex, VertexAttribute& _out_vertex)
+UInt32 EncodeOctahedral(const Vec3& _direction)
 {
-    switch (_type)
+    const float sum = std::abs(_direction.x) + std::abs(_direction.y) + std::abs(_direction.z);
+    if (sum <= 0.f)
     {
-        case eVertexType::Vertex2:
-        {
-            const Vertex2* vertex = static_cast<const Vertex2*>(_in_vertex);
-            _out_vertex.position  = ToVec3(vertex->position);
-            _out_vertex.uv0       = vertex->uv0;
-        }
-        break;
-
-        case eVertexType::Vertex3:
-        {
-            const Vertex3* vertex = static_cast<const Vertex3*>(_in_vertex);
-            _out_vertex.position  = vertex->position;
-            _out_vertex.uv0       = vertex->uv0;
-            _out_vertex.uv1       = vertex->uv1;
-            _out_vertex.normal    = vertex->normal;
-            _out_vertex.tangent   = vertex->tangent;
-        }
-        break;
-
-        case eVertexType::Vertex3PosOnly:
-        {
-            const Vertex3PosOnly* vertex = static_cast<const Vertex3PosOnly*>(_in_vertex);
-            _out_vertex.position         = vertex->position;
-        }
-        break;
-
-        default:
-            JAM_ASSERT(false, "Unknown vertex type");
+        return 0;   // 길이가 0 인 벡터는 +Z 로 인코딩됨
     }
+
+    // 팔면체에 투영 후 아래쪽 반구는 바깥 삼각형으로 접음
+    float x = _direction.x / sum;
+    float y = _direction.y / sum;
+    if (_direction.z < 0.f)
+    {
+        const float foldedX = (1.f - std::abs(y)) * (x >= 0.f ? 1.f : -1.f);
+        const float foldedY = (1.f - std::abs(x)) * (y >= 0.f ? 1.f : -1.f);
+        x                   = foldedX;
+        y                   = foldedY;
+    }
+    return QuantizeSnorm16(x) | QuantizeSnorm16(y) << 16;
+}
+
+Vec3 DecodeOctahedral(const UInt32 _encoded)
+{
+    Vec3        direction(DequantizeSnorm16(_encoded), DequantizeSnorm16(_encoded >> 16), 0.f);
+    direction.z   = 1.f - std::abs(direction.x) - std::abs(direction.y);
+    const float t = std::max(-direction.z, 0.f);
+    direction.x += direction.x >= 0.f ? -t : t;
+    direction.y += direction.y >= 0.f ? -t : t;
+    direction.Normalize();
+    return direction;
+}
+
+UInt32 EncodeOctahedralTangent(const Vec3& _tangent, const float _sign)
+{
+    // y 의 최하위 비트를 부호로 사용 (y 의 정밀도는 15비트)
+    constexpr UInt32 signBit = 1u << 16;
+    return (EncodeOctahedral(_tangent) & ~signBit) | (_sign < 0.f ? signBit : 0u);
+}
+
+Vec3 DecodeOctahedralTangent(const UInt32 _encoded, float& _out_sign)
+{
+    constexpr UInt32 signBit = 1u << 16;
+    _out_sign                = (_encoded & signBit) ? -1.f : 1.f;
+    return DecodeOctahedral(_encoded & ~signBit);
+}
+
+UInt32 PackHalf2(const Vec2& _value)
+{
+    using namespace DirectX::PackedVector;
+    return static_cast<UInt32>(XMConvertFloatToHalf(_value.x)) | static_cast<UInt32>(XMConvertFloatToHalf(_value.y)) << 16;
+}
+
+Vec2 UnpackHalf2(const UInt32 _packed)
+{
+    using namespace DirectX::PackedVector;
+    return Vec2(XMConvertHalfToFloat(static_cast<HALF>(_packed & 0xffff)), XMConvertHalfToFloat(static_cast<HALF>(_packed >> 16)));
 }
 
 }   // namespace jam
\ No newline at end of file
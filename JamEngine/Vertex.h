@@ -19,12 +19,87 @@ enum class eVertexType
 {
     Vertex2,
     Vertex3,
-    Vertex3PosOnly
+    Vertex3PosOnly,
+    Vertex3Compact,     // half UV + 옥타헤드럴 노멀/탄젠트 (28 bytes)
+    Vertex3Quantized,   // Vertex3Compact + 노드 AABB 기준 16비트 위치 (24 bytes)
+};
+
+// 양자화된 위치의 복원 변환 : position = positionOffset + quantized * positionScale (quantized 는 [0, 1])
+struct VertexQuantization
+{
+    Vec3 positionOffset = Vec3::Zero;
+    Vec3 positionScale  = Vec3::One;
+
+    NODISCARD static VertexQuantization FromBounds(const Vec3& _min, const Vec3& _max);
+    NODISCARD Mat4                      CreateDequantizeMatrix() const;   // 월드 행렬 앞에 곱하면 셰이더는 [0, 1] 위치만 복원하면 됨
+};
+
+// 종법선 부호 : bitangent 가 cross(normal, tangent) 의 반대 방향이면 -1 (미러링된 UV)
+// GPU 레이아웃은 종법선 대신 이 부호만 저장하며 셰이더는 cross(N, T) * sign 으로 종법선을 복원함
+NODISCARD float GetTangentSign(const VertexAttribute& _vertex);
+
+// 패킹으로 인한 최대 오차 (메쉬 단위로 리포트하여 양자화 제외 여부를 판단)
+struct VertexQuantizationError
+{
+    float position = 0.f;   // 모델 공간 거리
+    float normal   = 0.f;   // 라디안
+    float tangent  = 0.f;   // 라디안
+    float uv       = 0.f;   // UV 공간 거리
+};
+
+// 정점 레이아웃을 구성하는 속성과 저장 포맷 (VertexLayout.h 에서 타입별로 선언)
+enum class eVertexAttribute : UInt8
+{
+    Position,
+    Normal,
+    Tangent,
+    UV0,
+    UV1,
+};
+
+enum class eVertexFormat : UInt8
+{
+    Float2,                // 위치는 xy 만 저장
+    Float3,
+    Half2,                 // half2 를 UInt32 하나에 저장
+    Octahedral,            // snorm16x2
+    QuantizedPositionXY,   // unorm16x2 (VertexQuantization 기준)
+    QuantizedPositionZ,    // unorm16 (상위 16비트는 사용하지 않음)
+    Float4,                // 탄젠트 전용 : xyz + 종법선 부호 (w = ±1)
+    OctahedralTangent,     // 탄젠트 전용 : snorm16x2, y 의 최하위 비트는 종법선 부호 (1 이면 -1)
+};
+
+struct VertexElementDesc
+{
+    eVertexAttribute attribute;
+    eVertexFormat    format;
+    UInt32           offset;
+
+    NODISCARD bool operator==(const VertexElementDesc&) const = default;
 };
 
 UInt32 GetVertexStride(eVertexType _type);
-void   PackVertex(const VertexAttribute& _vertex, eVertexType _type, void* _out_vertex);
-void   UnpackVertex(eVertexType _type, const void* _in_vertex, VertexAttribute& _out_vertex);
+void   PackVertex(const VertexAttribute& _vertex, eVertexType _type, void* _out_vertex, const VertexQuantization& _quantization = {});
+void   UnpackVertex(eVertexType _type, const void* _in_vertex, VertexAttribute& _out_vertex, const VertexQuantization& _quantization = {});
+
+// 벌크 패킹 - 타입 분기는 호출당 한 번이며 정점 루프는 레이아웃별로 특수화됨
+void PackVertices(std::span<const VertexAttribute> _vertices, eVertexType _type, void* _out_vertices, const VertexQuantization& _quantization = {});
+void UnpackVertices(eVertexType _type, const void* _in_vertices, std::span<VertexAttribute> _out_vertices, const VertexQuantization& _quantization = {});
+
+// 레이아웃 서술자 (.jmodel 스트림 레이아웃 및 D3D 인풋 레이아웃)
+NODISCARD std::span<const VertexElementDesc>        GetVertexElements(eVertexType _type);
+NODISCARD std::span<const D3D11_INPUT_ELEMENT_DESC> GetVertexInputElements(eVertexType _type);
+
+NODISCARD bool                    IsQuantizedVertexType(eVertexType _type);   // VertexQuantization 이 필요한 타입
+NODISCARD VertexQuantizationError MeasureQuantizationError(std::span<const VertexAttribute> _vertices, eVertexType _type, const VertexQuantization& _quantization = {});
+
+// 압축 인코딩 (ShaderCommon.hlsl 의 디코딩 함수와 대응)
+NODISCARD UInt32 EncodeOctahedral(const Vec3& _direction);   // snorm16x2
+NODISCARD Vec3   DecodeOctahedral(UInt32 _encoded);
+NODISCARD UInt32 EncodeOctahedralTangent(const Vec3& _tangent, float _sign);   // y 의 최하위 비트에 종법선 부호
+NODISCARD Vec3   DecodeOctahedralTangent(UInt32 _encoded, float& _out_sign);
+NODISCARD UInt32 PackHalf2(const Vec2& _value);
+NODISCARD Vec2   UnpackHalf2(UInt32 _packed);
 
 struct Vertex2
 {
@@ -38,7 +113,7 @@ struct Vertex3
     Vec2 uv0;
     Vec2 uv1;
     Vec3 normal;
-    Vec3 tangent;
+    Vec4 tangent;   // w 는 종법선 부호
 };
 
 struct Vertex3PosOnly
@@ -46,4 +121,26 @@ struct Vertex3PosOnly
     Vec3 position;
 };
 
+struct Vertex3Compact
+{
+    Vec3   position;
+    UInt32 uv0;       // half2
+    UInt32 uv1;       // half2
+    UInt32 normal;    // octahedral snorm16x2
+    UInt32 tangent;   // octahedral snorm16x2 + 종법선 부호
+};
+
+struct Vertex3Quantized
+{
+    UInt32 positionXY;   // unorm16x2 (VertexQuantization 기준)
+    UInt32 positionZ;    // unorm16 (상위 16비트는 사용하지 않음)
+    UInt32 uv0;          // half2
+    UInt32 uv1;          // half2
+    UInt32 normal;       // octahedral snorm16x2
+    UInt32 tangent;      // octahedral snorm16x2 + 종법선 부호
+};
+
+static_assert(sizeof(Vertex3Compact) == 28);
+static_assert(sizeof(Vertex3Quantized) == 24);
+
 }   // namespace jam
\ No newline at end of file
@@ -0,0 +1,276 @@
+#pragma once
+#include "Vertex.h"
+
+#include <array>
+#include <tuple>
+
+namespace jam
+{
+
+// 컴파일 타임 정점 레이아웃 서술자
+// 정점 타입은 VertexLayout<정점 구조체, VertexElement<속성, 포맷, 오프셋>...> 선언 하나로 정의되며
+// 벌크 패킹/언패킹 루프, D3D 인풋 레이아웃, .jmodel 스트림 레이아웃이 모두 이 선언에서 만들어짐
+
+NODISCARD constexpr UInt32 GetVertexFormatByteWidth(const eVertexFormat _format)
+{
+    switch (_format)
+    {
+        case eVertexFormat::Float2: return sizeof(float) * 2;
+        case eVertexFormat::Float3: return sizeof(float) * 3;
+        case eVertexFormat::Float4: return sizeof(float) * 4;
+        default: return sizeof(UInt32);
+    }
+}
+
+NODISCARD constexpr DXGI_FORMAT GetVertexFormatDXGIFormat(const eVertexFormat _format)
+{
+    switch (_format)
+    {
+        case eVertexFormat::Float2: return DXGI_FORMAT_R32G32_FLOAT;
+        case eVertexFormat::Float3: return DXGI_FORMAT_R32G32B32_FLOAT;
+        case eVertexFormat::Float4: return DXGI_FORMAT_R32G32B32A32_FLOAT;
+        default: return DXGI_FORMAT_R32_UINT;   // 셰이더에서 직접 디코딩 (ShaderCommon.hlsl)
+    }
+}
+
+NODISCARD constexpr LPCSTR GetVertexAttributeSemanticName(const eVertexAttribute _attribute)
+{
+    switch (_attribute)
+    {
+        case eVertexAttribute::Position: return "POSITION";
+        case eVertexAttribute::Normal: return "NORMAL";
+        case eVertexAttribute::Tangent: return "TANGENT";
+        default: return "TEXCOORD";
+    }
+}
+
+NODISCARD inline UInt32 QuantizeUnorm16(const float _value)
+{
+    return static_cast<UInt32>(std::clamp(_value, 0.f, 1.f) * 65535.f + 0.5f);
+}
+
+NODISCARD inline float DequantizeUnorm16(const UInt32 _value)
+{
+    return static_cast<float>(_value & 0xffff) / 65535.f;
+}
+
+template<eVertexAttribute Attribute, eVertexFormat Format, UInt32 Offset>
+struct VertexElement
+{
+    static constexpr eVertexAttribute k_attribute     = Attribute;
+    static constexpr eVertexFormat    k_format        = Format;
+    static constexpr UInt32           k_offset        = Offset;
+    static constexpr UInt32           k_byteWidth     = GetVertexFormatByteWidth(Format);
+    static constexpr bool             k_bPosition     = Attribute == eVertexAttribute::Position;
+    static constexpr UInt32           k_semanticIndex = (Attribute == eVertexAttribute::UV1 || Format == eVertexFormat::QuantizedPositionZ) ? 1 : 0;
+    static constexpr bool             k_bTangentSign  = Format == eVertexFormat::Float4 || Format == eVertexFormat::OctahedralTangent;   // 종법선 부호를 함께 저장
+
+    static_assert(k_bPosition || (Format != eVertexFormat::QuantizedPositionXY && Format != eVertexFormat::QuantizedPositionZ), "Quantized formats are for positions");
+    static_assert(!k_bTangentSign || Attribute == eVertexAttribute::Tangent, "Signed tangent formats are for tangents");
+
+    NODISCARD static auto& GetAttributeRef(VertexAttribute& _vertex)
+    {
+        if constexpr (Attribute == eVertexAttribute::Position) return _vertex.position;
+        else if constexpr (Attribute == eVertexAttribute::Normal) return _vertex.normal;
+        else if constexpr (Attribute == eVertexAttribute::Tangent) return _vertex.tangent;
+        else if constexpr (Attribute == eVertexAttribute::UV0) return _vertex.uv0;
+        else return _vertex.uv1;
+    }
+
+    NODISCARD static const auto& GetAttribute(const VertexAttribute& _vertex)
+    {
+        return GetAttributeRef(const_cast<VertexAttribute&>(_vertex));
+    }
+
+    static void Pack(const VertexAttribute& _vertex, UInt8* _pVertex, const VertexQuantization& _quantization)
+    {
+        UInt8*      pElement = _pVertex + Offset;
+        const auto& value    = GetAttribute(_vertex);
+        UInt32      packed   = 0;
+
+        if constexpr (Format == eVertexFormat::Float2)
+        {
+            const float xy[2] = { value.x, value.y };
+            std::memcpy(pElement, xy, sizeof(xy));
+            return;
+        }
+        else if constexpr (Format == eVertexFormat::Float3)
+        {
+            const float xyz[3] = { value.x, value.y, value.z };
+            std::memcpy(pElement, xyz, sizeof(xyz));
+            return;
+        }
+        else if constexpr (Format == eVertexFormat::Float4)
+        {
+            const float xyzw[4] = { value.x, value.y, value.z, GetTangentSign(_vertex) };
+            std::memcpy(pElement, xyzw, sizeof(xyzw));
+            return;
+        }
+        else if constexpr (Format == eVertexFormat::Half2)
+        {
+            packed = PackHalf2(value);
+        }
+        else if constexpr (Format == eVertexFormat::Octahedral)
+        {
+            packed = EncodeOctahedral(value);
+        }
+        else if constexpr (Format == eVertexFormat::OctahedralTangent)
+        {
+            packed = EncodeOctahedralTangent(value, GetTangentSign(_vertex));
+        }
+        else if constexpr (Format == eVertexFormat::QuantizedPositionXY)
+        {
+            packed = QuantizeUnorm16((value.x - _quantization.positionOffset.x) / _quantization.positionScale.x) |
+                     QuantizeUnorm16((value.y - _quantization.positionOffset.y) / _quantization.positionScale.y) << 16;
+        }
+        else if constexpr (Format == eVertexFormat::QuantizedPositionZ)
+        {
+            packed = QuantizeUnorm16((value.z - _quantization.positionOffset.z) / _quantization.positionScale.z);
+        }
+        std::memcpy(pElement, &packed, sizeof(packed));
+    }
+
+    static void Unpack(const UInt8* _pVertex, VertexAttribute& _out_vertex, const VertexQuantization& _quantization)
+    {
+        const UInt8* pElement = _pVertex + Offset;
+        auto&        value    = GetAttributeRef(_out_vertex);
+
+        if constexpr (Format == eVertexFormat::Float2)
+        {
+            float xy[2];
+            std::memcpy(xy, pElement, sizeof(xy));
+            value.x = xy[0];
+            value.y = xy[1];
+            if constexpr (k_bPosition)
+            {
+                value.z = 0.f;
+            }
+        }
+        else if constexpr (Format == eVertexFormat::Float3)
+        {
+            std::memcpy(&value.x, pElement, sizeof(float) * 3);
+        }
+        else if constexpr (Format == eVertexFormat::Float4)
+        {
+            float xyzw[4];
+            std::memcpy(xyzw, pElement, sizeof(xyzw));
+            value                 = Vec3(xyzw[0], xyzw[1], xyzw[2]);
+            _out_vertex.bitangent = _out_vertex.normal.Cross(value) * (xyzw[3] < 0.f ? -1.f : 1.f);   // 법선이 먼저 복원됨 (VertexLayout)
+        }
+        else
+        {
+            UInt32 packed;
+            std::memcpy(&packed, pElement, sizeof(packed));
+            if constexpr (Format == eVertexFormat::Half2)
+            {
+                value = UnpackHalf2(packed);
+            }
+            else if constexpr (Format == eVertexFormat::Octahedral)
+            {
+                value = DecodeOctahedral(packed);
+            }
+            else if constexpr (Format == eVertexFormat::OctahedralTangent)
+            {
+                float sign            = 1.f;
+                value                 = DecodeOctahedralTangent(packed, sign);
+                _out_vertex.bitangent = _out_vertex.normal.Cross(value) * sign;   // 법선이 먼저 복원됨 (VertexLayout)
+            }
+            else if constexpr (Format == eVertexFormat::QuantizedPositionXY)
+            {
+                value.x = _quantization.positionOffset.x + DequantizeUnorm16(packed) * _quantization.positionScale.x;
+                value.y = _quantization.positionOffset.y + DequantizeUnorm16(packed >> 16) * _quantization.positionScale.y;
+            }
+            else if constexpr (Format == eVertexFormat::QuantizedPositionZ)
+            {
+                value.z = _quantization.positionOffset.z + DequantizeUnorm16(packed) * _quantization.positionScale.z;
+            }
+        }
+    }
+};
+
+// 종법선 부호를 저장하는 탄젠트는 언패킹할 때 법선으로 종법선을 복원하므로 법선보다 뒤에 선언되어야 함
+template<typename... Elements>
+NODISCARD constexpr bool IsNormalBeforeSignedTangent()
+{
+    bool bNormal = false;
+    bool bResult = true;
+    ((bResult = bResult && (!Elements::k_bTangentSign || bNormal), bNormal = bNormal || Elements::k_attribute == eVertexAttribute::Normal), ...);
+    return bResult;
+}
+
+template<typename Vertex, typename... Elements>
+struct VertexLayout
+{
+    static constexpr UInt32 k_stride       = sizeof(Vertex);
+    static constexpr UInt32 k_elementCount = sizeof...(Elements);
+
+    static_assert((Elements::k_byteWidth + ...) == sizeof(Vertex), "Vertex layout must cover the whole vertex");
+    static_assert(((Elements::k_offset + Elements::k_byteWidth <= sizeof(Vertex)) && ...), "Vertex element exceeds the vertex");
+    static_assert(IsNormalBeforeSignedTangent<Elements...>(), "Signed tangent must be declared after the normal");
+
+    static constexpr std::array<VertexElementDesc, k_elementCount> k_elements = {
+        VertexElementDesc { Elements::k_attribute, Elements::k_format, Elements::k_offset }...
+    };
+
+    static constexpr std::array<D3D11_INPUT_ELEMENT_DESC, k_elementCount> k_inputElements = {
+        D3D11_INPUT_ELEMENT_DESC { GetVertexAttributeSemanticName(Elements::k_attribute), Elements::k_semanticIndex, GetVertexFormatDXGIFormat(Elements::k_format), 0, Elements::k_offset, D3D11_INPUT_PER_VERTEX_DATA, 0 }...
+    };
+
+    static void Pack(const std::span<const VertexAttribute> _vertices, void* _out_vertices, const VertexQuantization& _quantization)
+    {
+        UInt8* pVertex = static_cast<UInt8*>(_out_vertices);
+        for (const VertexAttribute& vertex: _vertices)
+        {
+            (Elements::Pack(vertex, pVertex, _quantization), ...);
+            pVertex += k_stride;
+        }
+    }
+
+    static void Unpack(const void* _in_vertices, const std::span<VertexAttribute> _out_vertices, const VertexQuantization& _quantization)
+    {
+        const UInt8* pVertex = static_cast<const UInt8*>(_in_vertices);
+        for (VertexAttribute& vertex: _out_vertices)
+        {
+            (Elements::Unpack(pVertex, vertex, _quantization), ...);
+            pVertex += k_stride;
+        }
+    }
+};
+
+//===================================================
+// Vertex Layouts (eVertexType 순서)
+//===================================================
+
+using Vertex2Layout = VertexLayout<Vertex2,
+                                   VertexElement<eVertexAttribute::Position, eVertexFormat::Float2, offsetof(Vertex2, position)>,
+                                   VertexElement<eVertexAttribute::UV0, eVertexFormat::Float2, offsetof(Vertex2, uv0)>>;
+
+using Vertex3Layout = VertexLayout<Vertex3,
+                                   VertexElement<eVertexAttribute::Position, eVertexFormat::Float3, offsetof(Vertex3, position)>,
+                                   VertexElement<eVertexAttribute::UV0, eVertexFormat::Float2, offsetof(Vertex3, uv0)>,
+                                   VertexElement<eVertexAttribute::UV1, eVertexFormat::Float2, offsetof(Vertex3, uv1)>,
+                                   VertexElement<eVertexAttribute::Normal, eVertexFormat::Float3, offsetof(Vertex3, normal)>,
+                                   VertexElement<eVertexAttribute::Tangent, eVertexFormat::Float4, offsetof(Vertex3, tangent)>>;
+
+using Vertex3PosOnlyLayout = VertexLayout<Vertex3PosOnly,
+                                          VertexElement<eVertexAttribute::Position, eVertexFormat::Float3, offsetof(Vertex3PosOnly, position)>>;
+
+using Vertex3CompactLayout = VertexLayout<Vertex3Compact,
+                                          VertexElement<eVertexAttribute::Position, eVertexFormat::Float3, offsetof(Vertex3Compact, position)>,
+                                          VertexElement<eVertexAttribute::UV0, eVertexFormat::Half2, offsetof(Vertex3Compact, uv0)>,
+                                          VertexElement<eVertexAttribute::UV1, eVertexFormat::Half2, offsetof(Vertex3Compact, uv1)>,
+                                          VertexElement<eVertexAttribute::Normal, eVertexFormat::Octahedral, offsetof(Vertex3Compact, normal)>,
+                                          VertexElement<eVertexAttribute::Tangent, eVertexFormat::OctahedralTangent, offsetof(Vertex3Compact, tangent)>>;
+
+using Vertex3QuantizedLayout = VertexLayout<Vertex3Quantized,
+                                            VertexElement<eVertexAttribute::Position, eVertexFormat::QuantizedPositionXY, offsetof(Vertex3Quantized, positionXY)>,
+                                            VertexElement<eVertexAttribute::Position, eVertexFormat::QuantizedPositionZ, offsetof(Vertex3Quantized, positionZ)>,
+                                            VertexElement<eVertexAttribute::UV0, eVertexFormat::Half2, offsetof(Vertex3Quantized, uv0)>,
+                                            VertexElement<eVertexAttribute::UV1, eVertexFormat::Half2, offsetof(Vertex3Quantized, uv1)>,
+                                            VertexElement<eVertexAttribute::Normal, eVertexFormat::Octahedral, offsetof(Vertex3Quantized, normal)>,
+                                            VertexElement<eVertexAttribute::Tangent, eVertexFormat::OctahedralTangent, offsetof(Vertex3Quantized, tangent)>>;
+
+// eVertexType 의 값이 인덱스
+using VertexLayouts = std::tuple<Vertex2Layout, Vertex3Layout, Vertex3PosOnlyLayout, Vertex3CompactLayout, Vertex3QuantizedLayout>;
+
+}   // namespace jam
\ No newline at end of file
@@ -0,0 +1,364 @@
+#include "pch.h"
+
+#include "VertexTransform.h"
+
+#include <atomic>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define JAM_VERTEX_TRANSFORM_SIMD 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define JAM_TARGET_AVX2
+#else
+#include <cpuid.h>
+#define JAM_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#else
+#define JAM_VERTEX_TRANSFORM_SIMD 0
+#endif
+
+namespace
+{
+
+using namespace jam;
+
+constexpr size_t k_blockSize = 64;   // AoS -> SoA 변환 단위
+
+// 행 벡터 규약 (v' = v * M) 의 3x3 + 이동 성분
+struct TransformRows
+{
+    float m[4][3];
+};
+
+NODISCARD TransformRows ToTransformRows(const Mat4& _transform)
+{
+    return {
+        { { _transform._11, _transform._12, _transform._13 },
+         { _transform._21, _transform._22, _transform._23 },
+         { _transform._31, _transform._32, _transform._33 },
+         { _transform._41, _transform._42, _transform._43 } }
+    };
+}
+
+using TransformKernel = void (*)(Vec3Streams, size_t, size_t, const TransformRows&, bool, bool);
+
+//===================================================
+// Scalar
+//===================================================
+
+void TransformScalar(const Vec3Streams _streams, const size_t _begin, const size_t _end, const TransformRows& _rows, const bool _bTranslate, const bool _bNormalize)
+{
+    const auto& m = _rows.m;
+    const float w = _bTranslate ? 1.f : 0.f;
+    for (size_t i = _begin; i < _end; ++i)
+    {
+        const float x = _streams.x[i];
+        const float y = _streams.y[i];
+        const float z = _streams.z[i];
+
+        float rx = x * m[0][0] + y * m[1][0] + z * m[2][0] + w * m[3][0];
+        float ry = x * m[0][1] + y * m[1][1] + z * m[2][1] + w * m[3][1];
+        float rz = x * m[0][2] + y * m[1][2] + z * m[2][2] + w * m[3][2];
+        if (_bNormalize)
+        {
+            // 길이가 0 인 벡터는 0 으로 유지
+            const float lengthSquare = rx * rx + ry * ry + rz * rz;
+            const float inverse      = lengthSquare > 0.f ? 1.f / std::sqrt(lengthSquare) : 0.f;
+            rx *= inverse;
+            ry *= inverse;
+            rz *= inverse;
+        }
+        _streams.x[i] = rx;
+        _streams.y[i] = ry;
+        _streams.z[i] = rz;
+    }
+}
+
+#if JAM_VERTEX_TRANSFORM_SIMD
+
+//===================================================
+// SSE (4 lanes)
+//===================================================
+
+void TransformSSE(const Vec3Streams _streams, const size_t _begin, const size_t _end, const TransformRows& _rows, const bool _bTranslate, const bool _bNormalize)
+{
+    const auto&  m     = _rows.m;
+    const float  w     = _bTranslate ? 1.f : 0.f;
+    const __m128 m00   = _mm_set1_ps(m[0][0]), m01 = _mm_set1_ps(m[0][1]), m02 = _mm_set1_ps(m[0][2]);
+    const __m128 m10   = _mm_set1_ps(m[1][0]), m11 = _mm_set1_ps(m[1][1]), m12 = _mm_set1_ps(m[1][2]);
+    const __m128 m20   = _mm_set1_ps(m[2][0]), m21 = _mm_set1_ps(m[2][1]), m22 = _mm_set1_ps(m[2][2]);
+    const __m128 t0    = _mm_set1_ps(w * m[3][0]), t1 = _mm_set1_ps(w * m[3][1]), t2 = _mm_set1_ps(w * m[3][2]);
+    const __m128 one   = _mm_set1_ps(1.f);
+    const __m128 zero  = _mm_setzero_ps();
+    const size_t count = (_end - _begin) / 4 * 4;
+
+    size_t i = _begin;
+    for (; i < _begin + count; i += 4)
+    {
+        const __m128 x = _mm_loadu_ps(_streams.x + i);
+        const __m128 y = _mm_loadu_ps(_streams.y + i);
+        const __m128 z = _mm_loadu_ps(_streams.z + i);
+
+        __m128 rx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m00), _mm_mul_ps(y, m10)), _mm_mul_ps(z, m20)), t0);
+        __m128 ry = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m01), _mm_mul_ps(y, m11)), _mm_mul_ps(z, m21)), t1);
+        __m128 rz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m02), _mm_mul_ps(y, m12)), _mm_mul_ps(z, m22)), t2);
+        if (_bNormalize)
+        {
+            const __m128 lengthSquare = _mm_add_ps(_mm_add_ps(_mm_mul_ps(rx, rx), _mm_mul_ps(ry, ry)), _mm_mul_ps(rz, rz));
+            const __m128 inverse      = _mm_and_ps(_mm_div_ps(one, _mm_sqrt_ps(lengthSquare)), _mm_cmpgt_ps(lengthSquare, zero));
+            rx                        = _mm_mul_ps(rx, inverse);
+            ry                        = _mm_mul_ps(ry, inverse);
+            rz                        = _mm_mul_ps(rz, inverse);
+        }
+        _mm_storeu_ps(_streams.x + i, rx);
+        _mm_storeu_ps(_streams.y + i, ry);
+        _mm_storeu_ps(_streams.z + i, rz);
+    }
+    TransformScalar(_streams, i, _end, _rows, _bTranslate, _bNormalize);
+}
+
+//===================================================
+// AVX2 (8 lanes)
+//===================================================
+
+JAM_TARGET_AVX2 void TransformAVX2(const Vec3Streams _streams, const size_t _begin, const size_t _end, const TransformRows& _rows, const bool _bTranslate, const bool _bNormalize)
+{
+    const auto&  m     = _rows.m;
+    const float  w     = _bTranslate ? 1.f : 0.f;
+    const __m256 m00   = _mm256_set1_ps(m[0][0]), m01 = _mm256_set1_ps(m[0][1]), m02 = _mm256_set1_ps(m[0][2]);
+    const __m256 m10   = _mm256_set1_ps(m[1][0]), m11 = _mm256_set1_ps(m[1][1]), m12 = _mm256_set1_ps(m[1][2]);
+    const __m256 m20   = _mm256_set1_ps(m[2][0]), m21 = _mm256_set1_ps(m[2][1]), m22 = _mm256_set1_ps(m[2][2]);
+    const __m256 t0    = _mm256_set1_ps(w * m[3][0]), t1 = _mm256_set1_ps(w * m[3][1]), t2 = _mm256_set1_ps(w * m[3][2]);
+    const __m256 one   = _mm256_set1_ps(1.f);
+    const __m256 zero  = _mm256_setzero_ps();
+    const size_t count = (_end - _begin) / 8 * 8;
+
+    // FMA 는 사용하지 않음 (다른 경로와 결과를 맞추기 위해)
+    size_t i = _begin;
+    for (; i < _begin + count; i += 8)
+    {
+        const __m256 x = _mm256_loadu_ps(_streams.x + i);
+        const __m256 y = _mm256_loadu_ps(_streams.y + i);
+        const __m256 z = _mm256_loadu_ps(_streams.z + i);
+
+        __m256 rx = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m00), _mm256_mul_ps(y, m10)), _mm256_mul_ps(z, m20)), t0);
+        __m256 ry = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m01), _mm256_mul_ps(y, m11)), _mm256_mul_ps(z, m21)), t1);
+        __m256 rz = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m02), _mm256_mul_ps(y, m12)), _mm256_mul_ps(z, m22)), t2);
+        if (_bNormalize)
+        {
+            const __m256 lengthSquare = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(rx, rx), _mm256_mul_ps(ry, ry)), _mm256_mul_ps(rz, rz));
+            const __m256 inverse      = _mm256_and_ps(_mm256_div_ps(one, _mm256_sqrt_ps(lengthSquare)), _mm256_cmp_ps(lengthSquare, zero, _CMP_GT_OQ));
+            rx                        = _mm256_mul_ps(rx, inverse);
+            ry                        = _mm256_mul_ps(ry, inverse);
+            rz                        = _mm256_mul_ps(rz, inverse);
+        }
+        _mm256_storeu_ps(_streams.x + i, rx);
+        _mm256_storeu_ps(_streams.y + i, ry);
+        _mm256_storeu_ps(_streams.z + i, rz);
+    }
+    TransformScalar(_streams, i, _end, _rows, _bTranslate, _bNormalize);
+}
+
+NODISCARD eSimdLevel DetectSimdLevel()
+{
+    // x64 는 SSE2 를 항상 지원하므로 AVX2 (+ OS 의 YMM 레지스터 저장 지원) 만 확인
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4] = {};
+    __cpuid(info, 0);
+    if (info[0] < 7)
+    {
+        return eSimdLevel::SSE;
+    }
+
+    __cpuid(info, 1);
+    const bool bOsxsave = (info[2] & (1 << 27)) != 0;
+    const bool bAvx     = (info[2] & (1 << 28)) != 0;
+    __cpuidex(info, 7, 0);
+    const bool bAvx2 = (info[1] & (1 << 5)) != 0;
+    if (bOsxsave && bAvx && bAvx2 && (_xgetbv(0) & 0x6) == 0x6)
+    {
+        return eSimdLevel::AVX2;
+    }
+    return eSimdLevel::SSE;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") ? eSimdLevel::AVX2 : eSimdLevel::SSE;
+#endif
+}
+
+#else
+
+NODISCARD eSimdLevel DetectSimdLevel()
+{
+    return eSimdLevel::Scalar;
+}
+
+#endif   // JAM_VERTEX_TRANSFORM_SIMD
+
+const eSimdLevel        s_maxSimdLevel = DetectSimdLevel();
+std::atomic<eSimdLevel> s_simdLevel    = s_maxSimdLevel;
+
+NODISCARD TransformKernel GetTransformKernel()
+{
+#if JAM_VERTEX_TRANSFORM_SIMD
+    switch (s_simdLevel.load(std::memory_order_relaxed))
+    {
+        case eSimdLevel::AVX2: return &TransformAVX2;
+        case eSimdLevel::SSE: return &TransformSSE;
+        default: break;
+    }
+#endif
+    return &TransformScalar;
+}
+
+// 스트라이드 Vec3 를 SoA 블록으로 모으거나 되돌림
+struct Vec3Block
+{
+    alignas(32) float x[k_blockSize];
+    alignas(32) float y[k_blockSize];
+    alignas(32) float z[k_blockSize];
+
+    NODISCARD Vec3Streams GetStreams() { return { x, y, z }; }
+
+    void Gather(const Vec3* _pFirst, const size_t _stride, const size_t _count)
+    {
+        const UInt8* pBytes = reinterpret_cast<const UInt8*>(_pFirst);
+        for (size_t i = 0; i < _count; ++i)
+        {
+            const Vec3& vec = *reinterpret_cast<const Vec3*>(pBytes + i * _stride);
+            x[i]            = vec.x;
+            y[i]            = vec.y;
+            z[i]            = vec.z;
+        }
+    }
+
+    void Scatter(Vec3* _pFirst, const size_t _stride, const size_t _count) const
+    {
+        UInt8* pBytes = reinterpret_cast<UInt8*>(_pFirst);
+        for (size_t i = 0; i < _count; ++i)
+        {
+            Vec3& vec = *reinterpret_cast<Vec3*>(pBytes + i * _stride);
+            vec.x     = x[i];
+            vec.y     = y[i];
+            vec.z     = z[i];
+        }
+    }
+};
+
+void TransformAoS(const std::span<Vec3> _vectors, const Mat4& _transform, const bool _bTranslate, const bool _bNormalize)
+{
+    const TransformKernel kernel = GetTransformKernel();
+    const TransformRows   rows   = ToTransformRows(_transform);
+
+    Vec3Block block;
+    for (size_t begin = 0; begin < _vectors.size(); begin += k_blockSize)
+    {
+        const size_t count = std::min(k_blockSize, _vectors.size() - begin);
+        block.Gather(_vectors.data() + begin, sizeof(Vec3), count);
+        kernel(block.GetStreams(), 0, count, rows, _bTranslate, _bNormalize);
+        block.Scatter(_vectors.data() + begin, sizeof(Vec3), count);
+    }
+}
+
+}   // namespace
+
+namespace jam
+{
+
+eSimdLevel GetSimdLevel()
+{
+    return s_simdLevel.load(std::memory_order_relaxed);
+}
+
+eSimdLevel GetMaxSimdLevel()
+{
+    return s_maxSimdLevel;
+}
+
+void SetSimdLevel(const eSimdLevel _level)
+{
+    s_simdLevel.store(std::min(_level, s_maxSimdLevel), std::memory_order_relaxed);
+}
+
+void TransformPoints(const Vec3Streams _points, const size_t _count, const Mat4& _transform)
+{
+    GetTransformKernel()(_points, 0, _count, ToTransformRows(_transform), true, false);
+}
+
+void TransformDirections(const Vec3Streams _directions, const size_t _count, const Mat4& _transform, const bool _bNormalize)
+{
+    GetTransformKernel()(_directions, 0, _count, ToTransformRows(_transform), false, _bNormalize);
+}
+
+void TransformPoints(const std::span<Vec3> _points, const Mat4& _transform)
+{
+    TransformAoS(_points, _transform, true, false);
+}
+
+void TransformDirections(const std::span<Vec3> _directions, const Mat4& _transform, const bool _bNormalize)
+{
+    TransformAoS(_directions, _transform, false, _bNormalize);
+}
+
+void TransformVertices(const std::span<VertexAttribute> _vertices, const Mat4& _transform)
+{
+    if (_transform == Mat4::Identity)
+    {
+        return;
+    }
+
+    const TransformKernel kernel     = GetTransformKernel();
+    const TransformRows   rows       = ToTransformRows(_transform);
+    const TransformRows   normalRows = ToTransformRows(CreateNormalMatrix(_transform));
+
+    // 블록 하나에 네 속성을 모아 정점 데이터를 한 번만 순회
+    constexpr size_t stride = sizeof(VertexAttribute);
+    Vec3Block        positions, normals, tangents, bitangents;
+    for (size_t begin = 0; begin < _vertices.size(); begin += k_blockSize)
+    {
+        const size_t     count  = std::min(k_blockSize, _vertices.size() - begin);
+        VertexAttribute& vertex = _vertices[begin];
+
+        positions.Gather(&vertex.position, stride, count);
+        normals.Gather(&vertex.normal, stride, count);
+        tangents.Gather(&vertex.tangent, stride, count);
+        bitangents.Gather(&vertex.bitangent, stride, count);
+
+        kernel(positions.GetStreams(), 0, count, rows, true, false);
+        kernel(normals.GetStreams(), 0, count, normalRows, false, true);
+        kernel(tangents.GetStreams(), 0, count, rows, false, true);
+        kernel(bitangents.GetStreams(), 0, count, rows, false, true);
+
+        positions.Scatter(&vertex.position, stride, count);
+        normals.Scatter(&vertex.normal, stride, count);
+        tangents.Scatter(&vertex.tangent, stride, count);
+        bitangents.Scatter(&vertex.bitangent, stride, count);
+    }
+}
+
+Mat4 CreateNormalMatrix(const Mat4& _transform)
+{
+    // 역전치 행렬 = 여인수 행렬 / det, 정규화할 것이므로 det 의 부호만 반영
+    const Vec3  row0(_transform._11, _transform._12, _transform._13);
+    const Vec3  row1(_transform._21, _transform._22, _transform._23);
+    const Vec3  row2(_transform._31, _transform._32, _transform._33);
+    const Vec3  cofactor0 = row1.Cross(row2);
+    const Vec3  cofactor1 = row2.Cross(row0);
+    const Vec3  cofactor2 = row0.Cross(row1);
+    const float sign      = row0.Dot(cofactor0) < 0.f ? -1.f : 1.f;
+
+    Mat4 normalMatrix = Mat4::Identity;
+    normalMatrix._11  = cofactor0.x * sign;
+    normalMatrix._12  = cofactor0.y * sign;
+    normalMatrix._13  = cofactor0.z * sign;
+    normalMatrix._21  = cofactor1.x * sign;
+    normalMatrix._22  = cofactor1.y * sign;
+    normalMatrix._23  = cofactor1.z * sign;
+    normalMatrix._31  = cofactor2.x * sign;
+    normalMatrix._32  = cofactor2.y * sign;
+    normalMatrix._33  = cofactor2.z * sign;
+    return normalMatrix;
+}
+
+}   // namespace jam
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+#include "Vertex.h"
+
+namespace jam
+{
+
+// 정점 스트림 일괄 변환 커널
+// CPU 가 지원하는 가장 넓은 경로 (AVX2 > SSE > 스칼라) 를 사용하며 모든 경로는 연산 순서가 같아 결과가 동일함
+
+enum class eSimdLevel : UInt8
+{
+    Scalar,
+    SSE,
+    AVX2,
+};
+
+NODISCARD eSimdLevel GetSimdLevel();
+NODISCARD eSimdLevel GetMaxSimdLevel();                 // CPU 가 지원하는 최대 경로
+void                 SetSimdLevel(eSimdLevel _level);   // 지원하지 않는 경로는 최대 경로로 제한 (벤치마크, 검증용)
+
+// SoA 스트림
+struct Vec3Streams
+{
+    float* x = nullptr;
+    float* y = nullptr;
+    float* z = nullptr;
+};
+
+void TransformPoints(Vec3Streams _points, size_t _count, const Mat4& _transform);
+void TransformDirections(Vec3Streams _directions, size_t _count, const Mat4& _transform, bool _bNormalize = true);
+
+// AoS 스트림 (블록 단위로 SoA 로 옮겨 변환)
+void TransformPoints(std::span<Vec3> _points, const Mat4& _transform);
+void TransformDirections(std::span<Vec3> _directions, const Mat4& _transform, bool _bNormalize = true);
+
+// 위치는 _transform, 법선은 역전치 행렬, 탄젠트/종법선은 _transform 으로 변환하고 방향 벡터는 다시 정규화
+void TransformVertices(std::span<VertexAttribute> _vertices, const Mat4& _transform);
+
+NODISCARD Mat4 CreateNormalMatrix(const Mat4& _transform);   // 3x3 역전치 (크기는 보존하지 않으므로 정규화 필요)
+
+}   // namespace jam
\ No newline at end of file
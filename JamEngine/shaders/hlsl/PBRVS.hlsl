@@ -1,22 +1,41 @@
 #include "PBRCommon.hlsli"
 
+// 정점 타입별 퍼뮤테이션 (ShaderCollection::PBRGBufferShader(eVertexType) 가 선택)
+// VERTEX3_COMPACT   : Vertex3Compact
+// VERTEX3_QUANTIZED : Vertex3Quantized (cb_transformWorldMat = 역양자화 행렬 * 월드 행렬)
+#if defined(VERTEX3_COMPACT)
+PBR_PS_INPUT VSmain(VS_INPUT_VERTEX3_COMPACT packedInput)
+#elif defined(VERTEX3_QUANTIZED)
+PBR_PS_INPUT VSmain(VS_INPUT_VERTEX3_QUANTIZED packedInput)
+#else
 PBR_PS_INPUT VSmain(VS_INPUT_VERTEX3 input)
+#endif
 {
+#if defined(VERTEX3_COMPACT) || defined(VERTEX3_QUANTIZED)
+    VS_INPUT_VERTEX3 input = DecodeVertex3(packedInput);
+#endif
+
     PBR_PS_INPUT output;
 
     float heightFactor = (cb_materialTextureBindFlags & JAM_MATERIAL_TEXTURE_BIND_FLAGS_DISPLACEMENT) ?
         ((displacementTexture.SampleLevel(samplerLinearClamp, input.uv0, 0.f).r - 0.5f) * 2.0f * cb_materialDisplacementStrength)
         : 0.0f;
 
-    float3 localPos     = input.positionL + input.normal * heightFactor;
     JAM_MATRIX viewProj = mul(cb_cameraViewMat, cb_cameraProjMat);
 
-    output.posW = mul(float4(localPos, 1.0f), cb_transformWorldMat).xyz;
-    output.posH = mul(float4(output.posW, 1.0f), viewProj);
+    output.normalW = normalize(mul(float4(input.normal, 0.0f), cb_transformWorldInvTransposeMat).xyz);
 
-    output.normalW    = normalize(mul(float4(input.normal, 0.0f), cb_transformWorldInvTransposeMat).xyz);
-    output.tangentW   = normalize(mul(float4(input.tangentL, 0.0f), cb_transformWorldMat).xyz);
-    output.bitangentW = normalize(cross(output.normalW, output.tangentW));
+#if defined(VERTEX3_QUANTIZED)
+    // 양자화 공간은 축마다 스케일이 달라 방향 벡터는 역양자화 행렬이 빠진 역전치 행렬로 변환하고 변위는 월드 공간에서 적용
+    output.posW     = mul(float4(input.positionL, 1.0f), cb_transformWorldMat).xyz + output.normalW * heightFactor;
+    output.tangentW = normalize(mul(float4(input.tangentL.xyz, 0.0f), cb_transformWorldInvTransposeMat).xyz);
+#else
+    float3 localPos = input.positionL + input.normal * heightFactor;
+    output.posW     = mul(float4(localPos, 1.0f), cb_transformWorldMat).xyz;
+    output.tangentW = normalize(mul(float4(input.tangentL.xyz, 0.0f), cb_transformWorldMat).xyz);
+#endif
+    output.posH       = mul(float4(output.posW, 1.0f), viewProj);
+    output.bitangentW = normalize(cross(output.normalW, output.tangentW)) * input.tangentL.w;   // 미러링된 UV 는 w = -1
 
     output.texCoord  = input.uv0;
     output.texCoord2 = input.uv1;
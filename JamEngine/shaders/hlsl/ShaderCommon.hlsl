@@ -53,6 +53,59 @@ float ConvertDepthInNDCToDepthInView(float _depthNDC, JAM_MATRIX _projectionMatr
     return B / (_depthNDC - A);
 }
 
+// Vertex.h 의 PackHalf2 와 대응
+float2 UnpackHalf2(uint _packed)
+{
+    return f16tof32(uint2(_packed, _packed >> 16));
+}
+
+// Vertex.h 의 EncodeOctahedral 과 대응 (snorm16x2)
+float3 DecodeOctahedral(uint _encoded)
+{
+    int2   snorm = asint(uint2(_encoded << 16, _encoded)) >> 16;   // 부호 확장
+    float2 f     = max(float2(snorm) / 32767.f, -1.f);
+    float3 n     = float3(f, 1.f - abs(f.x) - abs(f.y));
+    float  t     = saturate(-n.z);
+    n.xy += (n.xy >= 0.f) ? -t : t;
+    return normalize(n);
+}
+
+// Vertex.h 의 EncodeOctahedralTangent 와 대응 (w 는 종법선 부호, y 의 최하위 비트)
+float4 DecodeOctahedralTangent(uint _encoded)
+{
+    return float4(DecodeOctahedral(_encoded & ~0x10000u), (_encoded & 0x10000u) ? -1.f : 1.f);
+}
+
+// [0, 1] 위치. 원래 위치는 VertexQuantization::CreateDequantizeMatrix 를 곱해 복원
+float3 DecodeQuantizedPosition(uint _positionXY, uint _positionZ)
+{
+    return float3(_positionXY & 0xffff, _positionXY >> 16, _positionZ & 0xffff) / 65535.f;
+}
+
+// 압축 정점을 VS_INPUT_VERTEX3 으로 복원
+VS_INPUT_VERTEX3 DecodeVertex3(VS_INPUT_VERTEX3_COMPACT _input)
+{
+    VS_INPUT_VERTEX3 output;
+    output.positionL = _input.positionL;
+    output.normal    = DecodeOctahedral(_input.normal);
+    output.uv0       = UnpackHalf2(_input.uv0);
+    output.uv1       = UnpackHalf2(_input.uv1);
+    output.tangentL  = DecodeOctahedralTangent(_input.tangentL);
+    return output;
+}
+
+// 위치는 [0, 1] 로만 복원 (cb_transformWorldMat 에 Mesh::CreateTransform 이 역양자화 행렬을 접어 둠)
+VS_INPUT_VERTEX3 DecodeVertex3(VS_INPUT_VERTEX3_QUANTIZED _input)
+{
+    VS_INPUT_VERTEX3 output;
+    output.positionL = DecodeQuantizedPosition(_input.positionXY, _input.positionZ);
+    output.normal    = DecodeOctahedral(_input.normal);
+    output.uv0       = UnpackHalf2(_input.uv0);
+    output.uv1       = UnpackHalf2(_input.uv1);
+    output.tangentL  = DecodeOctahedralTangent(_input.tangentL);
+    return output;
+}
+
 struct SCREENSPACE_EFFECT_PS_INPUT
 {
     float4 positionH : SV_POSITION;
@@ -17,21 +17,39 @@ struct PS_INPUT
 #endif
 };
 
+// 위치만 읽으므로 Vertex3 / Vertex3Compact 는 같은 셰이더를 사용 (인풋 레이아웃만 다름)
+// VERTEX3_QUANTIZED : Vertex3Quantized (cb_transformWorldMat = 역양자화 행렬 * 월드 행렬)
+#if defined(VERTEX3_QUANTIZED)
+typedef VS_INPUT_VERTEX3_QUANTIZED SHADOW_CASTER_VS_INPUT;
+
+float3 GetLocalPosition(SHADOW_CASTER_VS_INPUT _input)
+{
+    return DecodeQuantizedPosition(_input.positionXY, _input.positionZ);
+}
+#else
+typedef VS_INPUT_VERTEX3_POSONLY SHADOW_CASTER_VS_INPUT;
+
+float3 GetLocalPosition(SHADOW_CASTER_VS_INPUT _input)
+{
+    return _input.positionL;
+}
+#endif
+
 #ifdef SHADOW_MAPPING_CASTER
-PS_INPUT VSmain(VS_INPUT_VERTEX3 input)
+PS_INPUT VSmain(SHADOW_CASTER_VS_INPUT input)
 {
     PS_INPUT output;
-    float4 posW = mul(float4(input.positionL, 1.f), cb_transformWorldMat);
+    float4 posW = mul(float4(GetLocalPosition(input), 1.f), cb_transformWorldMat);
 
     JAM_MATRIX viewProj = cb_shadowCasterView * cb_shadowCasterProj;
     output.posH = mul(posW, viewProj);
     return output;
 }
 #else
-GS_Input VSmain(VS_INPUT_VERTEX3 input)
+GS_Input VSmain(SHADOW_CASTER_VS_INPUT input)
 {
     GS_Input output;
-    output.posW = mul(float4(input.positionL, 1.f), cb_transformWorldMat);
+    output.posW = mul(float4(GetLocalPosition(input), 1.f), cb_transformWorldMat);
     return output;
 }
 #endif